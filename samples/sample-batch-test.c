@@ -0,0 +1,1229 @@
+/*
+This sample is a regression test of the batch optimizer, it records scripted scenes
+without a window or a GPU and checks that:
+- the number of draw commands that survive batching matches a known golden count;
+- the batched command queue rasterizes to exactly the same image as the unbatched one,
+  using a tiny CPU rasterizer, so batches never break painter's order.
+
+The image check runs for several batch optimizer depths and move budgets,
+the golden counts are for the default depth of 8 and move budget of 96 vertices.
+Every scene runs twice, with rectangles drawn as 6 vertices and as indexed quads,
+and is also recorded into a command list that must give the same result once submitted,
+and that baked into a static batch must not need more draws.
+Scenes are also recorded with vertices transformed on the GPU, which must cover the same pixels,
+and sorted as done by sorted batching, which must give the same image without more draws.
+Draws packed by multi texture batching must give the same image, sampling the texture slot of each vertex.
+Images packed into an atlas must not overlap and their draws must merge into a single draw per page.
+Rectangles drawn with a color each must give the same image as setting the color before each of them.
+Points and rectangles generated in tasks of a dispatcher must give the same vertices as generated inline.
+It exits with a non zero code when any check fails.
+
+It must be built with the dummy backend, for example:
+    make headless backend=dummy
+    ./build/sample-batch-test
+*/
+
+#define SOKOL_IMPL
+#include "sokol_gfx.h"
+#include "sokol_gp.h"
+#include "sokol_log.h"
+
+#ifndef SOKOL_DUMMY_BACKEND
+#error "The batch test must be built with the dummy backend (backend=dummy)"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    TEST_WIDTH = 128,
+    TEST_HEIGHT = 128,
+    TEST_NUM_IMAGES = 10
+};
+
+static sg_image images[TEST_NUM_IMAGES];
+static sg_shader custom_shader;
+static sg_pipeline custom_pip;
+static sgp_command_list* command_list;
+static int num_sorted_scenes;
+static int num_multi_texture_scenes;
+
+////////////////////////////////////////////////////////////////////////////////
+// scenes
+
+static void draw_sprite(int image, float x, float y, float w, float h) {
+    sgp_set_image(0, images[image]);
+    sgp_draw_filled_rect(x, y, w, h);
+    sgp_reset_image(0);
+}
+
+static void set_custom_color(float r, float g, float b) {
+    float color[4] = {r, g, b, 1.0f};
+    sgp_set_uniform(NULL, 0, color, sizeof(color));
+}
+
+static void scene_sprites(void) {
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            draw_sprite(0, x*16.0f, y*16.0f, 12.0f, 12.0f);
+        }
+    }
+}
+
+static void scene_overlapping_sprites(void) {
+    for (int i = 0; i < 32; ++i) {
+        draw_sprite(0, i*3.0f, i*2.0f, 24.0f, 24.0f);
+    }
+}
+
+static void scene_interleaved_textures(void) {
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            draw_sprite((x + y) % 2, x*16.0f, y*16.0f, 12.0f, 12.0f);
+        }
+    }
+}
+
+static void scene_overlapping_interleaved_textures(void) {
+    for (int i = 0; i < 32; ++i) {
+        draw_sprite(i % 2, i*3.0f, i*2.0f, 24.0f, 24.0f);
+    }
+}
+
+static void scene_interleaved_colors(void) {
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            sgp_set_color((x % 3) == 0 ? 1.0f : 0.0f, (x % 3) == 1 ? 1.0f : 0.0f, (x % 3) == 2 ? 1.0f : 0.0f, 1.0f);
+            sgp_draw_filled_rect(x*16.0f, y*16.0f, 12.0f, 12.0f);
+        }
+    }
+    sgp_reset_color();
+}
+
+static void scene_custom_pipeline_colors(void) {
+    sgp_set_pipeline(custom_pip);
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            set_custom_color((x + y) % 2 == 0 ? 1.0f : 0.0f, (x + y) % 2 == 1 ? 1.0f : 0.0f, 0.0f);
+            sgp_draw_filled_rect(x*16.0f, y*16.0f, 12.0f, 12.0f);
+        }
+    }
+    sgp_reset_uniform();
+    sgp_reset_pipeline();
+}
+
+static void scene_overlapping_custom_pipeline_colors(void) {
+    sgp_set_pipeline(custom_pip);
+    for (int i = 0; i < 32; ++i) {
+        set_custom_color(i % 2 == 0 ? 1.0f : 0.0f, i % 2 == 1 ? 1.0f : 0.0f, 0.0f);
+        sgp_draw_filled_rect(i*3.0f, i*2.0f, 24.0f, 24.0f);
+    }
+    sgp_reset_uniform();
+    sgp_reset_pipeline();
+}
+
+static void scene_viewport_scissor(void) {
+    for (int i = 0; i < 4; ++i) {
+        draw_sprite(i % 2, i*16.0f, 0.0f, 12.0f, 12.0f);
+    }
+    sgp_viewport(32, 32, 64, 64);
+    for (int i = 0; i < 4; ++i) {
+        draw_sprite(i % 2, i*16.0f, 16.0f, 12.0f, 12.0f);
+    }
+    sgp_scissor(8, 8, 40, 40);
+    for (int i = 0; i < 4; ++i) {
+        draw_sprite(i % 2, i*12.0f, i*12.0f, 24.0f, 24.0f);
+    }
+    sgp_reset_scissor();
+    sgp_reset_viewport();
+    for (int i = 0; i < 4; ++i) {
+        draw_sprite(i % 2, i*16.0f, 100.0f, 12.0f, 12.0f);
+    }
+}
+
+static void scene_strips(void) {
+    for (int i = 0; i < 8; ++i) {
+        float x = i*16.0f;
+        sgp_point strip[6] = {{x, 10.0f}, {x + 12.0f, 10.0f}, {x, 40.0f}, {x + 12.0f, 40.0f}, {x, 70.0f}, {x + 12.0f, 70.0f}};
+        sgp_set_color(i % 2 == 0 ? 1.0f : 0.5f, 0.0f, 1.0f, 1.0f);
+        sgp_draw_filled_triangles_strip(strip, 6);
+        sgp_point line_strip[3] = {{x, 80.0f}, {x + 12.0f, 90.0f}, {x, 100.0f}};
+        sgp_draw_lines_strip(line_strip, 3);
+    }
+    sgp_reset_color();
+}
+
+static void scene_lines_points(void) {
+    for (int i = 0; i < 16; ++i) {
+        float x = i*8.0f;
+        sgp_draw_line(x, 4.0f, x + 4.0f, 60.0f);
+        sgp_draw_point(x + 2.0f, 100.0f + (float)(i % 4));
+    }
+}
+
+static void scene_merge_prev(void) {
+    // the third draw does not touch the second, so it is moved into the first
+    draw_sprite(0, 0.0f, 0.0f, 32.0f, 32.0f);
+    draw_sprite(1, 16.0f, 16.0f, 32.0f, 32.0f);
+    draw_sprite(0, 80.0f, 80.0f, 32.0f, 32.0f);
+}
+
+static void scene_merge_next(void) {
+    // the second draw does not touch the first, so the first is moved into the third
+    draw_sprite(0, 0.0f, 0.0f, 32.0f, 32.0f);
+    draw_sprite(1, 80.0f, 80.0f, 32.0f, 32.0f);
+    draw_sprite(0, 64.0f, 64.0f, 32.0f, 32.0f);
+}
+
+static void scene_depth_limit(void) {
+    // the last draw is beyond the lookback depth of the first one
+    for (int i = 0; i < TEST_NUM_IMAGES; ++i) {
+        draw_sprite(i, i*12.0f, 0.0f, 10.0f, 10.0f);
+    }
+    draw_sprite(0, 0.0f, 64.0f, 10.0f, 10.0f);
+}
+
+static void scene_deep_lookback(void) {
+    // the same image is drawn again after all the others, deeper lookbacks check many draws in between,
+    // the wide rows overlap the neighbours of the previous row while the narrow ones don't
+    for (int row = 0; row < 6; ++row) {
+        float w = (row % 2) == 0 ? 10.0f : 14.0f;
+        for (int i = 0; i < TEST_NUM_IMAGES; ++i) {
+            draw_sprite(i, i*12.0f, row*8.0f, w, 10.0f);
+        }
+    }
+}
+
+static void scene_move_budget(void) {
+    // merging the last draw would move more vertices than the budget,
+    // unless rectangles are indexed quads, 20 of them are 80 vertices instead of 120
+    draw_sprite(0, 0.0f, 0.0f, 8.0f, 8.0f);
+    sgp_set_image(0, images[1]);
+    sgp_rect rects[20];
+    for (int i = 0; i < 20; ++i) {
+        rects[i] = (sgp_rect){(float)(i % 10)*12.0f, 32.0f + (float)(i / 10)*12.0f, 8.0f, 8.0f};
+    }
+    sgp_draw_filled_rects(rects, 20);
+    sgp_reset_image(0);
+    draw_sprite(0, 100.0f, 0.0f, 8.0f, 8.0f);
+}
+
+static void scene_clear_and_blend(void) {
+    sgp_set_color(0.1f, 0.1f, 0.1f, 1.0f);
+    sgp_clear();
+    sgp_reset_color();
+    for (int i = 0; i < 16; ++i) {
+        sgp_set_blend_mode(i % 2 == 0 ? SGP_BLENDMODE_NONE : SGP_BLENDMODE_BLEND);
+        draw_sprite(0, (float)(i % 4)*32.0f, (float)(i / 4)*32.0f, 24.0f, 24.0f);
+    }
+    sgp_reset_blend_mode();
+}
+
+static sgp_color_ub4 rect_color(int i) {
+    sgp_color_ub4 color = {(i % 3) == 0 ? 255 : 0, (i % 3) == 1 ? 255 : 0, (i % 3) == 2 ? 255 : 0, 255};
+    return color;
+}
+
+// colored rectangles overlapped by textured ones, each with its own color
+static void scene_colored_rects(void) {
+    sgp_colored_rect rects[64];
+    for (int i = 0; i < 64; ++i) {
+        rects[i].rect = (sgp_rect){(i % 8)*16.0f, (i / 8)*16.0f, 12.0f, 12.0f};
+        rects[i].color = rect_color(i);
+    }
+    sgp_draw_colored_rects(rects, 64);
+    sgp_colored_textured_rect textured_rects[16];
+    for (int i = 0; i < 16; ++i) {
+        textured_rects[i].dst = (sgp_rect){i*6.0f, i*4.0f, 20.0f, 20.0f};
+        textured_rects[i].src = (sgp_rect){0.0f, 0.0f, 2.0f, 2.0f};
+        textured_rects[i].color = rect_color(i + 1);
+    }
+    sgp_set_image(0, images[2]);
+    sgp_draw_colored_textured_rects(0, textured_rects, 16);
+    sgp_reset_image(0);
+}
+
+// draws the same as above, setting the color before each rectangle
+static void scene_colored_rects_loop(void) {
+    for (int i = 0; i < 64; ++i) {
+        sgp_color_ub4 color = rect_color(i);
+        sgp_set_color(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, 1.0f);
+        sgp_draw_filled_rect((i % 8)*16.0f, (i / 8)*16.0f, 12.0f, 12.0f);
+    }
+    sgp_set_image(0, images[2]);
+    for (int i = 0; i < 16; ++i) {
+        sgp_color_ub4 color = rect_color(i + 1);
+        sgp_set_color(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, 1.0f);
+        sgp_draw_textured_rect(0, (sgp_rect){i*6.0f, i*4.0f, 20.0f, 20.0f}, (sgp_rect){0.0f, 0.0f, 2.0f, 2.0f});
+    }
+    sgp_reset_image(0);
+    sgp_reset_color();
+}
+
+typedef struct test_scene {
+    const char* name;
+    void (*draw)(void);
+    uint32_t golden_draws;
+    uint32_t golden_indexed_draws;
+} test_scene;
+
+static const test_scene scenes[] = {
+    {"sprites", scene_sprites, 1, 1},
+    {"overlapping_sprites", scene_overlapping_sprites, 1, 1},
+    {"interleaved_textures", scene_interleaved_textures, 9, 9},
+    {"overlapping_interleaved_textures", scene_overlapping_interleaved_textures, 32, 32},
+    {"interleaved_colors", scene_interleaved_colors, 1, 1},
+    {"custom_pipeline_colors", scene_custom_pipeline_colors, 9, 9},
+    {"overlapping_custom_pipeline_colors", scene_overlapping_custom_pipeline_colors, 32, 32},
+    {"viewport_scissor", scene_viewport_scissor, 10, 10},
+    {"strips", scene_strips, 16, 16},
+    {"lines_points", scene_lines_points, 2, 2},
+    {"merge_prev", scene_merge_prev, 2, 2},
+    {"merge_next", scene_merge_next, 2, 2},
+    {"depth_limit", scene_depth_limit, 11, 11},
+    {"deep_lookback", scene_deep_lookback, 60, 60},
+    {"move_budget", scene_move_budget, 3, 2},
+    {"clear_and_blend", scene_clear_and_blend, 6, 6},
+    {"colored_rects", scene_colored_rects, 2, 2},
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// reference rasterizer
+
+typedef struct raster_target {
+    uint64_t pixels[TEST_WIDTH*TEST_HEIGHT];
+    sgp_irect viewport;
+    sgp_irect scissor;
+} raster_target;
+
+static raster_target reference_target;
+static raster_target gpu_reference_target;
+static raster_target batched_target;
+
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+    // FNV-1a
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// returns the builtin pipeline a multi texture pipeline was made from, or the same pipeline
+static sg_pipeline single_texture_pipeline(sg_pipeline pip) {
+    for (uint32_t i = 0; i < _SGP_BLENDMODE_NUM; ++i) {
+        if (_sgp.multi_texture_quad_pipelines[i].id != SG_INVALID_ID && _sgp.multi_texture_quad_pipelines[i].id == pip.id) {
+            return _sgp.quad_pipelines[i];
+        }
+    }
+    for (uint32_t i = 0; i < _SG_PRIMITIVETYPE_NUM*_SGP_BLENDMODE_NUM; ++i) {
+        if (_sgp.multi_texture_pipelines[i].id != SG_INVALID_ID && _sgp.multi_texture_pipelines[i].id == pip.id) {
+            return _sgp.pipelines[i];
+        }
+    }
+    return pip;
+}
+
+static sg_primitive_type command_primitive_type(sg_pipeline pip) {
+    for (uint32_t i = 0; i < _SG_PRIMITIVETYPE_NUM*_SGP_BLENDMODE_NUM; ++i) {
+        if (_sgp.pipelines[i].id == pip.id || _sgp.transform_pipelines[i].id == pip.id) {
+            return (sg_primitive_type)(i / _SGP_BLENDMODE_NUM);
+        }
+    }
+    const _sg_pipeline_t* p = _sg_lookup_pipeline(&_sg.pools, pip.id);
+    return p ? p->cmn.primitive_type : SG_PRIMITIVETYPE_TRIANGLES;
+}
+
+static bool is_transform_pipeline(sg_pipeline pip) {
+    for (uint32_t i = 0; i < _SG_PRIMITIVETYPE_NUM*_SGP_BLENDMODE_NUM; ++i) {
+        if (_sgp.transform_pipelines[i].id == pip.id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void to_pixel(const raster_target* target, sgp_vec2 ndc, float* x, float* y) {
+    *x = (float)target->viewport.x + (ndc.x + 1.0f) * 0.5f * (float)target->viewport.w;
+    *y = (float)target->viewport.y + (1.0f - ndc.y) * 0.5f * (float)target->viewport.h;
+}
+
+static void put_pixel(raster_target* target, int x, int y, uint64_t value) {
+    const sgp_irect* vp = &target->viewport;
+    const sgp_irect* sc = &target->scissor;
+    if (x < 0 || y < 0 || x >= TEST_WIDTH || y >= TEST_HEIGHT ||
+        x < vp->x || y < vp->y || x >= vp->x + vp->w || y >= vp->y + vp->h ||
+        x < sc->x || y < sc->y || x >= sc->x + sc->w || y >= sc->y + sc->h) {
+        return;
+    }
+    target->pixels[y*TEST_WIDTH + x] = value;
+}
+
+static float edge(float ax, float ay, float bx, float by, float px, float py) {
+    return (bx - ax) * (py - ay) - (by - ay) * (px - ax);
+}
+
+static void raster_triangle(raster_target* target, const sgp_vertex* a, const sgp_vertex* b, const sgp_vertex* c, uint64_t value) {
+    float x0, y0, x1, y1, x2, y2;
+    to_pixel(target, a->position, &x0, &y0);
+    to_pixel(target, b->position, &x1, &y1);
+    to_pixel(target, c->position, &x2, &y2);
+    float area = edge(x0, y0, x1, y1, x2, y2);
+    if (area == 0.0f) {
+        return;
+    }
+    int minx = (int)_sg_max(_sg_min(_sg_min(x0, x1), x2), 0.0f);
+    int miny = (int)_sg_max(_sg_min(_sg_min(y0, y1), y2), 0.0f);
+    int maxx = (int)_sg_min(_sg_max(_sg_max(x0, x1), x2), (float)TEST_WIDTH - 1.0f);
+    int maxy = (int)_sg_min(_sg_max(_sg_max(y0, y1), y2), (float)TEST_HEIGHT - 1.0f);
+    for (int y = miny; y <= maxy; ++y) {
+        for (int x = minx; x <= maxx; ++x) {
+            float px = (float)x + 0.5f, py = (float)y + 0.5f;
+            float w0 = edge(x1, y1, x2, y2, px, py);
+            float w1 = edge(x2, y2, x0, y0, px, py);
+            float w2 = edge(x0, y0, x1, y1, px, py);
+            if (area < 0.0f) {
+                w0 = -w0; w1 = -w1; w2 = -w2;
+            }
+            if (w0 >= 0.0f && w1 >= 0.0f && w2 >= 0.0f) {
+                put_pixel(target, x, y, value);
+            }
+        }
+    }
+}
+
+static uint64_t hash_textures(uint64_t hash, const sg_image* imgs, const sg_sampler* smps, uint32_t count) {
+    hash = hash_bytes(hash, &count, sizeof(uint32_t));
+    for (uint32_t i = 0; i < count; ++i) {
+        hash = hash_bytes(hash, &imgs[i].id, sizeof(uint32_t));
+        hash = hash_bytes(hash, &smps[i].id, sizeof(uint32_t));
+    }
+    return hash;
+}
+
+// per vertex hashes of the texture slots of a draw, a single slot unless the draw was packed by multi texture batching
+typedef struct draw_hashes {
+    uint64_t slots[_SGP_MULTI_TEXTURE_SLOTS];
+    const float* vertex_slots;
+} draw_hashes;
+
+static uint64_t vertex_value(const draw_hashes* hashes, const sgp_vertex* v, uint32_t i) {
+    uint64_t draw_hash = hashes->slots[hashes->vertex_slots ? (uint32_t)hashes->vertex_slots[i] : 0];
+    return hash_bytes(draw_hash, &v[i].color, sizeof(sgp_color_ub4));
+}
+
+static void raster_draw(raster_target* target, const _sgp_draw_args* args) {
+    // pixels are identified by the bindings, uniforms and vertex color that produced them
+    sg_pipeline pip = single_texture_pipeline(args->pip);
+    uint64_t draw_hash = 0xcbf29ce484222325ULL;
+    draw_hash = hash_bytes(draw_hash, &pip.id, sizeof(uint32_t));
+    if (args->uniform_index != _SGP_IMPOSSIBLE_ID) {
+        draw_hash = hash_bytes(draw_hash, &_sgp.uniforms[args->uniform_index], sizeof(sgp_uniform));
+    }
+    draw_hashes hashes = {{0}, NULL};
+    if (pip.id != args->pip.id) {
+        // packed draws sample the texture slot of each vertex
+        for (uint32_t slot = 0; slot < _SGP_MULTI_TEXTURE_SLOTS; ++slot) {
+            hashes.slots[slot] = hash_textures(draw_hash, &args->textures.images[slot], &args->textures.samplers[slot], 1);
+        }
+        hashes.vertex_slots = &_sgp.vertex_slots[args->vertex_index - _sgp.state._base_vertex];
+    } else {
+        hashes.slots[0] = hash_textures(draw_hash, args->textures.images, args->textures.samplers, args->textures.count);
+    }
+    const sgp_vertex* v = &_sgp.vertices[args->vertex_index];
+    uint32_t n = args->num_vertices;
+    sgp_vertex* transformed = NULL;
+    if (is_transform_pipeline(pip)) {
+        // vertices are in local space, transform them like the vertex shader
+        const float* m = _sgp.uniforms[args->uniform_index].data.floats;
+        transformed = (sgp_vertex*)malloc(n * sizeof(sgp_vertex));
+        for (uint32_t i = 0; i < n; ++i) {
+            transformed[i] = v[i];
+            transformed[i].position.x = m[0]*v[i].position.x + m[1]*v[i].position.y + m[2];
+            transformed[i].position.y = m[4]*v[i].position.x + m[5]*v[i].position.y + m[6];
+        }
+        v = transformed;
+    }
+    if (args->indexed) {
+        // quads made of 2 triangles, in the same order as the quad index buffer
+        static const uint32_t quad_indices[6] = {0, 1, 2, 3, 0, 2};
+        for (uint32_t i = 0; i + 3 < n; i += 4) {
+            for (uint32_t j = 0; j < 6; j += 3) {
+                uint32_t a = i + quad_indices[j];
+                raster_triangle(target, &v[a], &v[i + quad_indices[j+1]], &v[i + quad_indices[j+2]], vertex_value(&hashes, v, a));
+            }
+        }
+        return;
+    }
+    switch (command_primitive_type(pip)) {
+        case SG_PRIMITIVETYPE_TRIANGLES:
+            for (uint32_t i = 0; i + 2 < n; i += 3) {
+                raster_triangle(target, &v[i], &v[i+1], &v[i+2], vertex_value(&hashes, v, i));
+            }
+            break;
+        case SG_PRIMITIVETYPE_TRIANGLE_STRIP:
+            for (uint32_t i = 0; i + 2 < n; ++i) {
+                raster_triangle(target, &v[i], &v[i+1], &v[i+2], vertex_value(&hashes, v, i));
+            }
+            break;
+        default: {
+            // points and lines only mark their vertices, enough to track their order
+            for (uint32_t i = 0; i < n; ++i) {
+                float x, y;
+                to_pixel(target, v[i].position, &x, &y);
+                put_pixel(target, (int)x, (int)y, vertex_value(&hashes, v, i));
+            }
+            break;
+        }
+    }
+    free(transformed);
+}
+
+// rasterizes the command queue recorded since sgp_begin, returns the number of draw commands
+static uint32_t raster_queue(raster_target* target) {
+    memset(target->pixels, 0, sizeof(target->pixels));
+    target->viewport = (sgp_irect){0, 0, TEST_WIDTH, TEST_HEIGHT};
+    target->scissor = (sgp_irect){0, 0, TEST_WIDTH, TEST_HEIGHT};
+    uint32_t num_draws = 0;
+    for (uint32_t i = _sgp.state._base_command; i < _sgp.cur_command; ++i) {
+        const _sgp_command* cmd = &_sgp.commands[i];
+        switch (cmd->cmd) {
+            case SGP_COMMAND_VIEWPORT:
+                target->viewport = cmd->args.viewport;
+                break;
+            case SGP_COMMAND_SCISSOR:
+                target->scissor = cmd->args.scissor;
+                break;
+            case SGP_COMMAND_DRAW:
+                raster_draw(target, &cmd->args.draw);
+                num_draws++;
+                break;
+            default:
+                break;
+        }
+    }
+    return num_draws;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// test runner
+
+static void flush_frame(void) {
+    sg_pass pass = {0};
+    pass.swapchain.width = TEST_WIDTH;
+    pass.swapchain.height = TEST_HEIGHT;
+    pass.swapchain.sample_count = 1;
+    pass.swapchain.color_format = SG_PIXELFORMAT_RGBA8;
+    pass.swapchain.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+    sg_begin_pass(&pass);
+    sgp_flush();
+    sgp_end();
+    sg_end_pass();
+    sg_commit();
+}
+
+static uint32_t record_scene(const test_scene* scene, uint32_t depth, uint32_t max_move_vertices, bool gpu_transform, raster_target* target) {
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    sgp_set_batch_optimizer(depth, max_move_vertices);
+    sgp_set_gpu_transform(gpu_transform);
+    scene->draw();
+    uint32_t num_draws = raster_queue(target);
+    flush_frame();
+    if (sgp_get_last_error() != SGP_NO_ERROR) {
+        fprintf(stderr, "Sokol GP error: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        exit(-1);
+    }
+    return num_draws;
+}
+
+static uint32_t record_scene_list(const test_scene* scene, raster_target* target) {
+    sgp_begin_command_list(command_list, TEST_WIDTH, TEST_HEIGHT);
+    sgp_set_batch_optimizer(SGP_BATCH_OPTIMIZER_DEPTH, SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES);
+    scene->draw();
+    sgp_end_command_list();
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    sgp_submit_command_list(command_list);
+    uint32_t num_draws = raster_queue(target);
+    flush_frame();
+    if (sgp_get_last_error() != SGP_NO_ERROR) {
+        fprintf(stderr, "Sokol GP error: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        exit(-1);
+    }
+    return num_draws;
+}
+
+// sorts the scene draws as `sorted_batching` does on flush, returns the number of draw commands
+static uint32_t record_scene_sorted(const test_scene* scene, raster_target* target) {
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    // sorted batching doesn't merge draws while queueing them
+    sgp_set_batch_optimizer(0, 0);
+    scene->draw();
+    sgp_stats stats = {0};
+    if (_sgp_sort_draws(_sgp.state._base_command, &_sgp.cur_command, _sgp.state._base_vertex, &_sgp.cur_vertex, &stats)) {
+        num_sorted_scenes++;
+    }
+    uint32_t num_draws = raster_queue(target);
+    flush_frame();
+    if (sgp_get_last_error() != SGP_NO_ERROR) {
+        fprintf(stderr, "Sokol GP error: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        exit(-1);
+    }
+    return num_draws;
+}
+
+// packs the scene draws as `multi_texture_batching` does on flush, returns the number of draw commands
+static uint32_t record_scene_multi_texture(const test_scene* scene, raster_target* target, uint32_t* num_merged_textures) {
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    sgp_set_batch_optimizer(SGP_BATCH_OPTIMIZER_DEPTH, SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES);
+    scene->draw();
+    sgp_stats stats = {0};
+    if (_sgp_pack_multi_texture_draws(_sgp.state._base_command, _sgp.cur_command, _sgp.state._base_vertex, &stats)) {
+        num_multi_texture_scenes++;
+    }
+    *num_merged_textures = stats.num_merged_textures;
+    uint32_t num_draws = raster_queue(target);
+    // the packed queue was checked, the flush packs the draws of the other recordings
+    _sgp.cur_command = _sgp.state._base_command;
+    flush_frame();
+    if (sgp_get_last_error() != SGP_NO_ERROR) {
+        fprintf(stderr, "Sokol GP error: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        exit(-1);
+    }
+    return num_draws;
+}
+
+// draws the command list baked into a static batch, returns the number of draw commands
+static uint32_t record_static_batch(const sgp_static_batch* batch) {
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    sgp_draw_static_batch(batch);
+    uint32_t num_draws = 0;
+    for (uint32_t i = _sgp.state._base_command; i < _sgp.cur_command; ++i) {
+        if (_sgp.commands[i].cmd == SGP_COMMAND_DRAW_STATIC) {
+            num_draws++;
+        }
+    }
+    flush_frame();
+    if (sgp_get_last_error() != SGP_NO_ERROR) {
+        fprintf(stderr, "Sokol GP error: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        exit(-1);
+    }
+    return num_draws;
+}
+
+static bool check_scene(const test_scene* scene, bool indexed) {
+    static const uint32_t depths[] = {1, 2, 8, 32};
+    static const uint32_t max_moves[] = {0, 96, 1 << 20};
+    bool ok = true;
+
+    record_scene(scene, 0, 0, false, &reference_target);
+
+    // golden draw count with the default settings
+    const char* mode = indexed ? " (indexed)" : "";
+    uint32_t golden_draws = indexed ? scene->golden_indexed_draws : scene->golden_draws;
+    uint32_t num_draws = record_scene(scene, SGP_BATCH_OPTIMIZER_DEPTH, SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES, false, &batched_target);
+    if (num_draws != golden_draws) {
+        printf("FAIL %s%s: %u draw commands, expected %u\n", scene->name, mode, num_draws, golden_draws);
+        ok = false;
+    }
+
+    // same draws when recorded into a command list
+    num_draws = record_scene_list(scene, &batched_target);
+    if (num_draws != golden_draws) {
+        printf("FAIL %s%s: %u draw commands from a command list, expected %u\n", scene->name, mode, num_draws, golden_draws);
+        ok = false;
+    }
+    if (memcmp(reference_target.pixels, batched_target.pixels, sizeof(reference_target.pixels)) != 0) {
+        printf("FAIL %s%s: painter's order broken by a command list\n", scene->name, mode);
+        ok = false;
+    }
+
+    // the same command list baked into a static batch, scenes with custom pipelines or viewports can't be baked
+    sgp_static_batch* batch = sgp_make_static_batch(command_list);
+    if (batch) {
+        uint32_t num_static_draws = record_static_batch(batch);
+        if (num_static_draws > golden_draws) {
+            printf("FAIL %s%s: %u draw commands from a static batch, expected at most %u\n", scene->name, mode, num_static_draws, golden_draws);
+            ok = false;
+        }
+        sgp_destroy_static_batch(batch);
+    } else if (sgp_get_last_error() != SGP_ERROR_STATIC_BATCH_UNSUPPORTED) {
+        printf("FAIL %s%s: static batch error: %s\n", scene->name, mode, sgp_get_error_message(sgp_get_last_error()));
+        ok = false;
+    }
+
+    // vertices transformed on the GPU cover the same pixels, and batching keeps their painter's order
+    record_scene(scene, 0, 0, true, &gpu_reference_target);
+    record_scene(scene, SGP_BATCH_OPTIMIZER_DEPTH, SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES, true, &batched_target);
+    if (memcmp(gpu_reference_target.pixels, batched_target.pixels, sizeof(gpu_reference_target.pixels)) != 0) {
+        printf("FAIL %s%s: painter's order broken with GPU transform\n", scene->name, mode);
+        ok = false;
+    }
+    for (int i = 0; i < TEST_WIDTH*TEST_HEIGHT; ++i) {
+        if ((reference_target.pixels[i] == 0) != (gpu_reference_target.pixels[i] == 0)) {
+            printf("FAIL %s%s: different pixels covered with GPU transform\n", scene->name, mode);
+            ok = false;
+            break;
+        }
+    }
+
+    // draws sorted on flush must keep the image and not need more draws
+    uint32_t num_sorted_draws = record_scene_sorted(scene, &batched_target);
+    if (memcmp(reference_target.pixels, batched_target.pixels, sizeof(reference_target.pixels)) != 0) {
+        printf("FAIL %s%s: painter's order broken by sorted batching\n", scene->name, mode);
+        ok = false;
+    }
+    if (num_sorted_draws > golden_draws) {
+        printf("FAIL %s%s: %u draw commands when sorted, expected at most %u\n", scene->name, mode, num_sorted_draws, golden_draws);
+        ok = false;
+    }
+
+    // draws packed with multiple textures must keep the image and not need more draws
+    uint32_t num_merged_textures = 0;
+    uint32_t num_multi_texture_draws = record_scene_multi_texture(scene, &batched_target, &num_merged_textures);
+    if (memcmp(reference_target.pixels, batched_target.pixels, sizeof(reference_target.pixels)) != 0) {
+        printf("FAIL %s%s: painter's order broken by multi texture batching\n", scene->name, mode);
+        ok = false;
+    }
+    if (num_multi_texture_draws > golden_draws) {
+        printf("FAIL %s%s: %u draw commands with multiple textures, expected at most %u\n", scene->name, mode, num_multi_texture_draws, golden_draws);
+        ok = false;
+    }
+
+    // same image for any settings
+    for (size_t d = 0; d < sizeof(depths)/sizeof(depths[0]); ++d) {
+        for (size_t m = 0; m < sizeof(max_moves)/sizeof(max_moves[0]); ++m) {
+            record_scene(scene, depths[d], max_moves[m], false, &batched_target);
+            if (memcmp(reference_target.pixels, batched_target.pixels, sizeof(reference_target.pixels)) != 0) {
+                printf("FAIL %s%s: painter's order broken with depth %u and move budget %u\n", scene->name, mode, depths[d], max_moves[m]);
+                ok = false;
+            }
+        }
+    }
+    if (ok) {
+        printf("ok   %s%s: %u draw commands, %u sorted, %u with %u textures packed\n", scene->name, mode, num_draws, num_sorted_draws, num_multi_texture_draws, num_merged_textures);
+    }
+    return ok;
+}
+
+// the batch optimizer can be disabled from sgp_desc, where 0 picks the default depth
+static bool check_optimizer_off(void) {
+    sgp_desc desc = {
+        .batch_optimizer_depth = SGP_BATCH_OPTIMIZER_OFF,
+        .batch_optimizer_max_move_vertices = SGP_BATCH_OPTIMIZER_OFF
+    };
+    sgp_setup(&desc);
+    if (!sgp_is_valid()) {
+        printf("FAIL optimizer_off: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return false;
+    }
+    desc = sgp_query_desc();
+    test_scene scene = {"interleaved_colors", scene_interleaved_colors, 64, 64};
+    uint32_t num_draws = record_scene(&scene, SGP_BATCH_OPTIMIZER_DEPTH, SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES, false, &batched_target);
+    sgp_shutdown();
+    if (desc.batch_optimizer_depth != 0 || desc.batch_optimizer_max_move_vertices != 0 || num_draws != scene.golden_draws) {
+        printf("FAIL optimizer_off: depth %u, move budget %u, %u draw commands, expected %u\n",
+               desc.batch_optimizer_depth, desc.batch_optimizer_max_move_vertices, num_draws, scene.golden_draws);
+        return false;
+    }
+    return true;
+}
+
+// a context made where a destroyed one was gets a new handle, and draws the same as the default one,
+// all contexts fit in the default Sokol GFX pools even with command lists, as they share their pipelines
+static bool check_contexts(void) {
+    sgp_desc desc = {0};
+    sgp_setup(&desc);
+    if (!sgp_is_valid()) {
+        printf("FAIL contexts: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return false;
+    }
+    sgp_context old_ctx = sgp_make_context(&desc);
+    sgp_destroy_context(old_ctx);
+    sgp_context ctx = sgp_make_context(&desc);
+    bool ok = old_ctx.id != 0 && ctx.id != 0 && ctx.id != old_ctx.id;
+    uint32_t num_draws = 0;
+    if (ok) {
+        sgp_set_context(ctx);
+        ok = sgp_get_context().id == ctx.id;
+        test_scene scene = {"interleaved_colors", scene_interleaved_colors, 1, 1};
+        num_draws = record_scene(&scene, SGP_BATCH_OPTIMIZER_DEPTH, SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES, false, &batched_target);
+        ok = ok && num_draws == scene.golden_draws;
+        sgp_set_context(sgp_default_context());
+    }
+    if (!ok) {
+        printf("FAIL contexts: handles %u and %u, %u draw commands, expected 1\n", old_ctx.id, ctx.id, num_draws);
+    }
+    for (int i = 0; ok && i < SGP_MAX_CONTEXTS; ++i) {
+        // the default context and the one above get their command lists first
+        if (i >= 2) {
+            ctx = sgp_make_context(&desc);
+            if (ctx.id == 0) {
+                printf("FAIL contexts: context %d: %s\n", i, sgp_get_error_message(sgp_get_last_error()));
+                ok = false;
+                break;
+            }
+        }
+        sgp_set_context(i == 0 ? sgp_default_context() : ctx);
+        sgp_command_list_desc list_desc = {0};
+        sgp_command_list* list = sgp_make_command_list(&list_desc);
+        if (!list) {
+            printf("FAIL contexts: command list of context %d: %s\n", i, sgp_get_error_message(sgp_get_last_error()));
+            ok = false;
+        }
+        sgp_destroy_command_list(list);
+        sgp_set_context(sgp_default_context());
+    }
+    sgp_shutdown();
+    return ok;
+}
+
+// sorted batching with a commands capacity that is not a power of two
+static bool check_sort_capacity(void) {
+    sgp_desc desc = {
+        .max_commands = 1000,
+        .sorted_batching = true
+    };
+    sgp_setup(&desc);
+    if (!sgp_is_valid()) {
+        printf("FAIL sort_capacity: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return false;
+    }
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    sgp_set_batch_optimizer(0, 0);
+    for (int i = 0; i < 900; ++i) {
+        sgp_set_color((i % 3) / 2.0f, (i % 5) / 4.0f, 1.0f, 1.0f);
+        sgp_draw_filled_rect((float)(i % 30) * 2.0f, (float)(i / 30) * 2.0f, 1.0f, 1.0f);
+    }
+    sgp_stats stats = {0};
+    bool sorted = _sgp_sort_draws(_sgp.state._base_command, &_sgp.cur_command, _sgp.state._base_vertex, &_sgp.cur_vertex, &stats);
+    uint32_t num_draws = 0;
+    for (uint32_t i = _sgp.state._base_command; i < _sgp.cur_command; ++i) {
+        if (_sgp.commands[i].cmd == SGP_COMMAND_DRAW) {
+            num_draws++;
+        }
+    }
+    flush_frame();
+    sgp_shutdown();
+    if (!sorted || num_draws != 1) {
+        printf("FAIL sort_capacity: %u draw commands, expected 1\n", num_draws);
+        return false;
+    }
+    return true;
+}
+
+// a nested flush must not forget the draws the outer pass still has queued
+static bool check_nested_flush(void) {
+    sgp_desc desc = {.batch_optimizer_depth = 64};
+    sgp_setup(&desc);
+    if (!sgp_is_valid()) {
+        printf("FAIL nested_flush: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return false;
+    }
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    sgp_set_batch_optimizer(64, SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES);
+    sgp_draw_filled_rect(56.0f, 56.0f, 16.0f, 16.0f);
+    for (int i = 0; i < 12; ++i) {
+        sgp_set_blend_mode(i % 2 == 0 ? SGP_BLENDMODE_ADD : SGP_BLENDMODE_MUL);
+        sgp_draw_filled_rect(64.0f, 64.0f, 32.0f, 32.0f);
+    }
+    sgp_reset_blend_mode();
+    // the nested pass draws right away, before the queue of the outer pass
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    sgp_draw_filled_rect(0.0f, 0.0f, 8.0f, 8.0f);
+    flush_frame();
+    // both this and the first draw overlap the blended draws, so they can't be merged
+    sgp_draw_filled_rect(72.0f, 72.0f, 16.0f, 16.0f);
+    uint32_t num_draws = 0;
+    for (uint32_t i = _sgp.state._base_command; i < _sgp.cur_command; ++i) {
+        if (_sgp.commands[i].cmd == SGP_COMMAND_DRAW) {
+            num_draws++;
+        }
+    }
+    flush_frame();
+    sgp_shutdown();
+    if (num_draws != 14) {
+        printf("FAIL nested_flush: %u draw commands, expected 14\n", num_draws);
+        return false;
+    }
+    return true;
+}
+
+// baked content may extend past the list frame, and lists changing the projection can't be baked
+static bool check_static_batch_frame(void) {
+    bool ok = true;
+    sgp_begin_command_list(command_list, TEST_WIDTH, TEST_HEIGHT);
+    sgp_project(0.0f, TEST_WIDTH * 2.0f, 0.0f, TEST_HEIGHT * 2.0f);
+    sgp_draw_filled_rect(8.0f, 8.0f, 16.0f, 16.0f);
+    sgp_end_command_list();
+    sgp_static_batch* batch = sgp_make_static_batch(command_list);
+    if (batch || sgp_get_last_error() != SGP_ERROR_STATIC_BATCH_PROJECTED) {
+        printf("FAIL static_batch_frame: a projected command list was baked\n");
+        sgp_destroy_static_batch(batch);
+        ok = false;
+    }
+
+    // the rectangle out of the list frame is kept, then skipped when the list is submitted,
+    // it is blended so it isn't merged with the other one
+    sgp_begin_command_list(command_list, TEST_WIDTH, TEST_HEIGHT);
+    sgp_set_blend_mode(SGP_BLENDMODE_ADD);
+    sgp_draw_filled_rect(-32.0f, -32.0f, 16.0f, 16.0f);
+    sgp_reset_blend_mode();
+    sgp_draw_filled_rect(8.0f, 8.0f, 16.0f, 16.0f);
+    sgp_end_command_list();
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    sgp_submit_command_list(command_list);
+    sgp_draw_filled_rect(TEST_WIDTH + 8.0f, 8.0f, 16.0f, 16.0f);
+    sgp_stats stats = _sgp.state._stats;
+    flush_frame();
+    if (stats.num_queued_draws != 1 || stats.num_culled_draws != 2) {
+        printf("FAIL static_batch_frame: %u queued and %u culled draws, expected 1 and 2\n", stats.num_queued_draws, stats.num_culled_draws);
+        ok = false;
+    }
+    batch = sgp_make_static_batch(command_list);
+    if (!batch) {
+        printf("FAIL static_batch_frame: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return false;
+    }
+    if (batch->region.x1 != -32.0f || batch->region.y1 != -32.0f || batch->region.x2 != 24.0f || batch->region.y2 != 24.0f) {
+        printf("FAIL static_batch_frame: baked bounds (%g, %g, %g, %g), expected (-32, -32, 24, 24)\n",
+               batch->region.x1, batch->region.y1, batch->region.x2, batch->region.y2);
+        ok = false;
+    }
+
+    // drawn out of the screen the whole batch is skipped
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    sgp_translate(TEST_WIDTH * 2.0f, 0.0f);
+    sgp_draw_static_batch(batch);
+    stats = _sgp.state._stats;
+    flush_frame();
+    if (stats.num_queued_draws != 0 || stats.num_culled_draws != batch->num_draws) {
+        printf("FAIL static_batch_frame: %u culled draws of an out of screen static batch, expected %u\n", stats.num_culled_draws, batch->num_draws);
+        ok = false;
+    }
+    sgp_destroy_static_batch(batch);
+    return ok;
+}
+
+// runs the tasks of a draw in order on this thread, counting the draws split in tasks
+static void serial_dispatch(sgp_task_func task, void* task_data, uint32_t num_tasks, void* user_data) {
+    for (uint32_t i = 0; i < num_tasks; ++i) {
+        task(task_data, i);
+    }
+    (*(uint32_t*)user_data)++;
+}
+
+// large batches of every draw type split in tasks, transformed so regions aren't trivial
+static void scene_dispatched(void) {
+    sgp_rotate_at(0.3f, 64.0f, 64.0f);
+    sgp_point points[103];
+    for (int i = 0; i < 103; ++i) {
+        points[i] = (sgp_point){(float)(i % 16) * 8.0f + 0.5f, (float)(i / 16) * 8.0f + 0.5f};
+    }
+    sgp_draw_points(points, 103);
+    sgp_rect rects[37];
+    sgp_textured_rect textured_rects[37];
+    sgp_colored_rect colored_rects[37];
+    for (int i = 0; i < 37; ++i) {
+        rects[i] = (sgp_rect){(float)(i % 6) * 20.0f, (float)(i / 6) * 20.0f, 14.0f, 10.0f + (float)(i % 3)};
+        textured_rects[i].dst = rects[i];
+        textured_rects[i].src = (sgp_rect){(float)(i % 2), 0.0f, 2.0f, 3.0f};
+        colored_rects[i].rect = rects[i];
+        colored_rects[i].color = rect_color(i);
+    }
+    sgp_draw_filled_rects(rects, 37);
+    sgp_set_image(0, images[1]);
+    sgp_draw_textured_rects(0, textured_rects, 37);
+    sgp_reset_image(0);
+    sgp_set_blend_mode(SGP_BLENDMODE_BLEND);
+    sgp_draw_colored_rects(colored_rects, 37);
+    sgp_reset_blend_mode();
+}
+
+// vertices and regions generated by a dispatcher must be the same as generated inline
+static bool check_dispatcher(void) {
+    static sgp_vertex inline_vertices[1024];
+    static _sgp_command inline_commands[16];
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    scene_dispatched();
+    uint32_t base_vertex = _sgp.state._base_vertex;
+    uint32_t num_vertices = _sgp.cur_vertex - base_vertex;
+    uint32_t num_commands = _sgp.cur_command - _sgp.state._base_command;
+    if (num_vertices > 1024 || num_commands > 16) {
+        printf("FAIL dispatcher: %u vertices and %u commands don't fit the test arrays\n", num_vertices, num_commands);
+        flush_frame();
+        return false;
+    }
+    memcpy(inline_vertices, &_sgp.vertices[base_vertex], num_vertices * sizeof(sgp_vertex));
+    memcpy(inline_commands, &_sgp.commands[_sgp.state._base_command], num_commands * sizeof(_sgp_command));
+    flush_frame();
+
+    // a few vertices are enough to split draws, in a number of tasks that doesn't divide them evenly
+    uint32_t num_dispatches = 0;
+    sgp_desc desc = sgp_query_desc();
+    desc.dispatcher.func = serial_dispatch;
+    desc.dispatcher.user_data = &num_dispatches;
+    desc.dispatcher.min_vertices = 16;
+    desc.dispatcher.max_tasks = 5;
+    sgp_context ctx = sgp_make_context(&desc);
+    if (ctx.id == 0) {
+        printf("FAIL dispatcher: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return false;
+    }
+    sgp_set_context(ctx);
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    scene_dispatched();
+    bool ok = num_dispatches == 4 &&
+              _sgp.cur_vertex - _sgp.state._base_vertex == num_vertices &&
+              _sgp.cur_command - _sgp.state._base_command == num_commands;
+    if (!ok) {
+        printf("FAIL dispatcher: %u draws dispatched, %u vertices and %u commands, expected 4, %u and %u\n", num_dispatches,
+               _sgp.cur_vertex - _sgp.state._base_vertex, _sgp.cur_command - _sgp.state._base_command, num_vertices, num_commands);
+    } else {
+        // only the vertices of each draw are compared, indexed quads may be preceded by unused padding vertices
+        for (uint32_t i = 0; i < num_commands; ++i) {
+            const _sgp_draw_args* args = &_sgp.commands[_sgp.state._base_command + i].args.draw;
+            const _sgp_draw_args* inline_args = &inline_commands[i].args.draw;
+            if (args->vertex_index != inline_args->vertex_index || args->num_vertices != inline_args->num_vertices ||
+                memcmp(&_sgp.vertices[args->vertex_index], &inline_vertices[inline_args->vertex_index - base_vertex], args->num_vertices * sizeof(sgp_vertex)) != 0) {
+                printf("FAIL dispatcher: vertices of command %u differ from the ones generated inline\n", i);
+                ok = false;
+                break;
+            }
+            if (memcmp(&args->region, &inline_args->region, sizeof(_sgp_region)) != 0) {
+                printf("FAIL dispatcher: region of command %u differs from the one generated inline\n", i);
+                ok = false;
+                break;
+            }
+        }
+    }
+    flush_frame();
+    sgp_set_context(sgp_default_context());
+    sgp_destroy_context(ctx);
+    return ok;
+}
+
+// rectangles with their own color must draw the same as setting the color before each of them
+static bool check_colored_rects(void) {
+    test_scene loop_scene = {"colored_rects_loop", scene_colored_rects_loop, 2, 2};
+    test_scene batch_scene = {"colored_rects", scene_colored_rects, 2, 2};
+    record_scene(&loop_scene, 0, 0, false, &reference_target);
+    record_scene(&batch_scene, 0, 0, false, &batched_target);
+    if (memcmp(reference_target.pixels, batched_target.pixels, sizeof(reference_target.pixels)) != 0) {
+        printf("FAIL colored_rects: different image than setting the color of each rectangle\n");
+        return false;
+    }
+    return true;
+}
+
+// packs many small images into small atlas pages, uploading them over a few frames
+static bool check_atlas(void) {
+    enum { NUM_ICONS = 300, MAX_ICON_SIZE = 16, PAGE_SIZE = 128, MAX_PAGES = 8 };
+    static uint16_t owners[MAX_PAGES][PAGE_SIZE*PAGE_SIZE];
+    static sgp_atlas_image icons[NUM_ICONS];
+    uint8_t pixels[MAX_ICON_SIZE*MAX_ICON_SIZE*4];
+    bool ok = true;
+    memset(owners, 0, sizeof(owners));
+
+    sgp_atlas_desc desc = {
+        .page_width = PAGE_SIZE,
+        .page_height = PAGE_SIZE,
+        .max_pages = MAX_PAGES,
+        .padding = 1
+    };
+    sgp_atlas* atlas = sgp_make_atlas(&desc);
+    if (!atlas) {
+        printf("FAIL atlas: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return false;
+    }
+    for (int i = 0; i < NUM_ICONS && ok; ++i) {
+        int w = 3 + (i * 7) % (MAX_ICON_SIZE - 2);
+        int h = 3 + (i * 5) % (MAX_ICON_SIZE - 2);
+        memset(pixels, i % 255 + 1, sizeof(pixels));
+        icons[i] = sgp_atlas_add_image(atlas, w, h, pixels);
+        uint32_t page = 0;
+        while (page < atlas->num_pages && atlas->pages[page].image.id != icons[i].image.id) {
+            page++;
+        }
+        if (icons[i].image.id == SG_INVALID_ID || page == atlas->num_pages) {
+            printf("FAIL atlas: image %d could not be packed: %s\n", i, sgp_get_error_message(sgp_get_last_error()));
+            ok = false;
+            break;
+        }
+
+        // the image and its padding must be inside the page and not overlap the previous ones
+        int x = (int)icons[i].src.x, y = (int)icons[i].src.y;
+        if (x < 0 || y < 0 || x + w > PAGE_SIZE || y + h > PAGE_SIZE || icons[i].src.w != (float)w || icons[i].src.h != (float)h) {
+            printf("FAIL atlas: image %d packed out of its page\n", i);
+            ok = false;
+        }
+        for (int py = y; py < _sg_min(y + h + desc.padding, PAGE_SIZE) && ok; ++py) {
+            for (int px = x; px < _sg_min(x + w + desc.padding, PAGE_SIZE); ++px) {
+                if (owners[page][py*PAGE_SIZE + px] != 0) {
+                    printf("FAIL atlas: image %d overlaps image %d\n", i, owners[page][py*PAGE_SIZE + px] - 1);
+                    ok = false;
+                    break;
+                }
+                owners[page][py*PAGE_SIZE + px] = (uint16_t)(i + 1);
+            }
+        }
+        if (atlas->pages[page].pixels[(y*PAGE_SIZE + x)*4] != (uint8_t)(i % 255 + 1)) {
+            printf("FAIL atlas: image %d pixels not copied into its page\n", i);
+            ok = false;
+        }
+
+        // pages are uploaded at most once per frame, even when asked twice
+        if (i % 100 == 99) {
+            sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+            sgp_atlas_upload(atlas);
+            sgp_atlas_upload(atlas);
+            flush_frame();
+        }
+    }
+
+    // icons of the same page merge into a single draw
+    if (ok) {
+        sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+        sgp_atlas_upload(atlas);
+        for (uint32_t page = 0; page < atlas->num_pages; ++page) {
+            sgp_set_image(0, atlas->pages[page].image);
+            for (int i = 0; i < NUM_ICONS; ++i) {
+                if (icons[i].image.id == atlas->pages[page].image.id) {
+                    sgp_rect dest = {(float)(i % 16) * 8.0f, (float)(i / 16) * 8.0f, 8.0f, 8.0f};
+                    sgp_draw_textured_rect(0, dest, sgp_atlas_src_rect(&icons[i], (sgp_rect){0.0f, 0.0f, 2.0f, 2.0f}));
+                }
+            }
+        }
+        sgp_reset_image(0);
+        uint32_t num_draws = raster_queue(&batched_target);
+        flush_frame();
+        if (num_draws != atlas->num_pages) {
+            printf("FAIL atlas: %u draw commands for %u pages\n", num_draws, atlas->num_pages);
+            ok = false;
+        }
+    }
+
+    // images larger than a page never fit
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    sgp_atlas_image too_large = sgp_atlas_add_image(atlas, PAGE_SIZE + 1, 1, pixels);
+    if (too_large.image.id != SG_INVALID_ID || sgp_get_last_error() != SGP_ERROR_ATLAS_FULL) {
+        printf("FAIL atlas: image larger than a page was packed\n");
+        ok = false;
+    }
+    sgp_end();
+    if (ok) {
+        printf("ok   atlas: %d images packed into %u pages\n", NUM_ICONS, atlas->num_pages);
+    }
+    sgp_destroy_atlas(atlas);
+    return ok;
+}
+
+static void setup_resources(void) {
+    for (int i = 0; i < TEST_NUM_IMAGES; ++i) {
+        sg_image_desc image_desc = {0};
+        image_desc.width = 4 + i;
+        image_desc.height = 4;
+        image_desc.usage = SG_USAGE_DYNAMIC;
+        images[i] = sg_make_image(&image_desc);
+    }
+
+    // custom shader with a fragment uniform color, the dummy backend needs no source code
+    sg_shader_desc shader_desc = {0};
+    shader_desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    shader_desc.images[0].image_type = SG_IMAGETYPE_2D;
+    shader_desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+    shader_desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    shader_desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+    shader_desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    shader_desc.image_sampler_pairs[0].image_slot = 0;
+    shader_desc.image_sampler_pairs[0].sampler_slot = 0;
+    shader_desc.uniform_blocks[SGP_UNIFORM_SLOT_FRAGMENT].stage = SG_SHADERSTAGE_FRAGMENT;
+    shader_desc.uniform_blocks[SGP_UNIFORM_SLOT_FRAGMENT].size = 4*sizeof(float);
+    custom_shader = sg_make_shader(&shader_desc);
+    sgp_pipeline_desc pip_desc = {0};
+    pip_desc.shader = custom_shader;
+    pip_desc.has_vs_color = true;
+    custom_pip = sgp_make_pipeline(&pip_desc);
+
+    sgp_command_list_desc list_desc = {0};
+    command_list = sgp_make_command_list(&list_desc);
+    if (!command_list) {
+        fprintf(stderr, "Failed to create command list: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        exit(-1);
+    }
+}
+
+static void destroy_resources(void) {
+    sgp_destroy_command_list(command_list);
+    sg_destroy_pipeline(custom_pip);
+    sg_destroy_shader(custom_shader);
+    for (int i = 0; i < TEST_NUM_IMAGES; ++i) {
+        sg_destroy_image(images[i]);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    (void)argv;
+    if (argc > 1) {
+        fprintf(stderr, "usage: %s\n", argv[0]);
+        return -1;
+    }
+
+    // initialize Sokol GFX
+    sg_desc sgdesc = {
+        .environment.defaults.color_format = SG_PIXELFORMAT_RGBA8,
+        .environment.defaults.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        .environment.defaults.sample_count = 1,
+        .logger.func = slog_func
+    };
+    sg_setup(&sgdesc);
+    if (!sg_isvalid()) {
+        fprintf(stderr, "Failed to create Sokol GFX context!\n");
+        return -1;
+    }
+
+    int failures = 0;
+    bool checks_ok = check_optimizer_off();
+    checks_ok = check_contexts() && checks_ok;
+    checks_ok = check_sort_capacity() && checks_ok;
+    checks_ok = check_nested_flush() && checks_ok;
+    int num_scenes = (int)(sizeof(scenes)/sizeof(scenes[0]));
+    for (int indexed = 0; indexed < 2; ++indexed) {
+        // initialize Sokol GP, the depth must allow the deepest lookback tested
+        sgp_desc sgpdesc = {
+            .batch_optimizer_depth = 32,
+            .indexed_quads = indexed != 0,
+            .multi_texture_batching = true
+        };
+        sgp_setup(&sgpdesc);
+        if (!sgp_is_valid()) {
+            fprintf(stderr, "Failed to create Sokol GP context: %s\n", sgp_get_error_message(sgp_get_last_error()));
+            return -1;
+        }
+
+        setup_resources();
+        for (int i = 0; i < num_scenes; ++i) {
+            if (!check_scene(&scenes[i], indexed != 0)) {
+                failures++;
+            }
+        }
+        checks_ok = check_colored_rects() && checks_ok;
+        checks_ok = check_static_batch_frame() && checks_ok;
+        checks_ok = check_dispatcher() && checks_ok;
+        checks_ok = check_atlas() && checks_ok;
+        destroy_resources();
+        sgp_shutdown();
+    }
+    if (num_sorted_scenes != 2*num_scenes) {
+        printf("FAIL only %d of %d scenes could be sorted\n", num_sorted_scenes, 2*num_scenes);
+    }
+    if (num_multi_texture_scenes == 0) {
+        printf("FAIL no scene could be packed with multiple textures\n");
+    }
+    printf("%d of %d scenes passed\n", 2*num_scenes - failures, 2*num_scenes);
+    if (!checks_ok) {
+        printf("FAIL some checks failed, see above\n");
+    }
+    sg_shutdown();
+    return failures > 0 || num_sorted_scenes != 2*num_scenes || num_multi_texture_scenes == 0 || !checks_ok ? 1 : 0;
+}
@@ -0,0 +1,341 @@
+/*
+This sample is a headless version of the benchmark sample, it runs every benchmark
+scenario for a number of frames without a window or a GPU and prints CPU timings
+for recording and flushing draw commands as JSON, so it can be used in CI
+to track performance regressions.
+
+It must be built with the dummy backend, for example:
+    make headless backend=dummy build=release
+    ./build/sample-bench-headless -frames 500
+
+The batch optimizer depth and move budget can be changed with `-depth N` and `-move N`,
+to compare the trade-off between merging time and draw calls saved,
+`-depth 0` disables the batch optimizer and `-move 0` never moves vertices.
+
+When built with `SGP_TRACE` defined, `-trace trace.json` writes a Chrome trace
+of every frame that can be loaded in chrome://tracing or Perfetto.
+
+When built with `SGP_FLUSH_TIMING` defined, the time spent in each Sokol GFX call type
+of the last flushed frame is printed too.
+
+`-grow` starts with small buffers that grow while recording, to test and measure growing.
+`-indexed` draws rectangles as indexed quads.
+`-compact` uploads compact vertices.
+`-static` bakes every scenario once into a static batch and draws the batch each frame.
+`-sort` enables sorted batching, reordering draws when flushing.
+`-multitex` enables multi texture batching, packing draws that differ only by their texture when flushing.
+
+`-capture frame.sgpc` saves the draw commands of a frame with all scenarios,
+it can be replayed with the replay sample.
+*/
+
+#define SOKOL_IMPL
+#include "sokol_gfx.h"
+#include "sokol_gp.h"
+#include "sokol_time.h"
+#include "sokol_log.h"
+
+#ifndef SOKOL_DUMMY_BACKEND
+#error "The headless benchmark must be built with the dummy backend (backend=dummy)"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sample-bench.h"
+
+enum {
+    BENCH_WIDTH = 1280,
+    BENCH_HEIGHT = 1280,
+    BENCH_WARMUP_FRAMES = 10,
+    BENCH_DEFAULT_FRAMES = 200
+};
+
+typedef struct bench_result {
+    uint64_t record_ticks;
+    uint64_t flush_ticks;
+    uint32_t draws;
+    sgp_stats stats;
+} bench_result;
+
+static sgp_static_batch* bench_batch;
+static uint32_t bench_batch_num_draws;
+
+static void bench_draw_static_batch(void) {
+    bench_num_draws = bench_batch_num_draws;
+    sgp_draw_static_batch(bench_batch);
+}
+
+static void bench_pass(void) {
+    sg_pass pass = {0};
+    pass.swapchain.width = BENCH_WIDTH;
+    pass.swapchain.height = BENCH_HEIGHT;
+    pass.swapchain.sample_count = 1;
+    pass.swapchain.color_format = SG_PIXELFORMAT_RGBA8;
+    pass.swapchain.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+    sg_begin_pass(&pass);
+}
+
+static void bench_check_error(void) {
+    if (sgp_get_last_error() != SGP_NO_ERROR) {
+        fprintf(stderr, "Sokol GP error: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        exit(-1);
+    }
+}
+
+static void bench_frame(void (*draw)(void), bench_result* result) {
+    uint64_t start = stm_now();
+    bench_num_draws = 0;
+    sgp_begin(BENCH_WIDTH, BENCH_HEIGHT);
+    draw();
+    uint64_t recorded = stm_now();
+
+    bench_pass();
+    uint64_t flush_start = stm_now();
+    sgp_flush();
+    uint64_t flushed = stm_now();
+    sgp_end();
+    sg_end_pass();
+    sg_commit();
+    bench_check_error();
+
+    if (result) {
+        result->record_ticks += stm_diff(recorded, start);
+        result->flush_ticks += stm_diff(flushed, flush_start);
+        result->draws += bench_num_draws;
+        result->stats = sgp_query_stats();
+    }
+}
+
+static void print_result(const char* name, int frames, const bench_result* result, bool last) {
+    const sgp_stats* stats = &result->stats;
+    double record_ns = stm_ns(result->record_ticks);
+    double flush_ns = stm_ns(result->flush_ticks);
+    double total_commands = (double)stats->num_draw_calls * frames;
+    printf("    {\"name\": \"%s\", \"draw_calls\": %u, \"commands_before_batching\": %u, \"culled_draws\": %u, \"commands_after_batching\": %u, "
+           "\"merged_prev\": %u, \"merged_next\": %u, \"merged_sorted\": %u, \"merged_textures\": %u, \"moved_bytes\": %u, \"reused_uniforms\": %u, "
+           "\"pipeline_applies\": %u, \"bindings_applies\": %u, \"bindings_by_pipeline\": %u, \"bindings_by_textures\": %u, "
+           "\"uniforms_applies\": %u, \"viewport_applies\": %u, \"scissor_applies\": %u, \"uploaded_vertices\": %u, \"uploaded_compact_vertices\": %u, \"uploaded_sprites\": %u, "
+           "\"record_ns_per_draw_call\": %.2f, \"flush_ns_per_command\": %.2f, \"record_ms_per_frame\": %.4f, \"flush_ms_per_frame\": %.4f",
+           name, result->draws / (uint32_t)frames, stats->num_queued_draws, stats->num_culled_draws, stats->num_draw_calls,
+           stats->num_merged_prev, stats->num_merged_next, stats->num_merged_sorted, stats->num_merged_textures, stats->num_moved_bytes, stats->num_reused_uniforms,
+           stats->num_pipeline_applies, stats->num_bindings_applies, stats->num_bindings_by_pipeline, stats->num_bindings_by_textures,
+           stats->num_uniforms_applies, stats->num_viewport_applies, stats->num_scissor_applies, stats->num_uploaded_vertices, stats->num_compact_vertices, stats->num_uploaded_sprites,
+           result->draws > 0 ? record_ns / result->draws : 0.0,
+           total_commands > 0 ? flush_ns / total_commands : 0.0,
+           record_ns / (1e6 * frames), flush_ns / (1e6 * frames));
+#ifdef SGP_FLUSH_TIMING
+    // time spent per Sokol GFX call type in the last flushed frame
+    printf(", \"flush_ns\": {\"upload\": %llu, \"pipeline\": %llu, \"bindings\": %llu, \"uniforms\": %llu, "
+           "\"viewport\": %llu, \"scissor\": %llu, \"draw\": %llu}",
+           (unsigned long long)stats->upload_ns, (unsigned long long)stats->pipeline_ns, (unsigned long long)stats->bindings_ns,
+           (unsigned long long)stats->uniforms_ns, (unsigned long long)stats->viewport_ns, (unsigned long long)stats->scissor_ns,
+           (unsigned long long)stats->draw_ns);
+#endif
+    printf("}%s\n", last ? "" : ",");
+}
+
+// records the draws once into a command list, to draw them as a static batch in every frame
+static void bench_bake(void (*draw)(void)) {
+    sgp_command_list_desc list_desc = {0};
+    sgp_command_list* list = sgp_make_command_list(&list_desc);
+    bench_num_draws = 0;
+    sgp_begin_command_list(list, BENCH_WIDTH, BENCH_HEIGHT);
+    draw();
+    sgp_end_command_list();
+    bench_batch = sgp_make_static_batch(list);
+    bench_batch_num_draws = bench_num_draws;
+    sgp_destroy_command_list(list);
+    bench_check_error();
+}
+
+static void bench_run(void (*draw)(void), const char* name, int frames, bool baked, bool last) {
+    if (baked) {
+        bench_bake(draw);
+        draw = bench_draw_static_batch;
+    }
+    for (int i = 0; i < BENCH_WARMUP_FRAMES; ++i) {
+        bench_frame(draw, NULL);
+    }
+    bench_result result = {0};
+    for (int i = 0; i < frames; ++i) {
+        bench_frame(draw, &result);
+    }
+    print_result(name, frames, &result, last);
+    if (baked) {
+        sgp_destroy_static_batch(bench_batch);
+        bench_batch = NULL;
+    }
+}
+
+static bool bench_capture(void (*draw)(void), const char* path) {
+    sgp_begin(BENCH_WIDTH, BENCH_HEIGHT);
+    draw();
+    size_t size = sgp_capture(NULL, 0);
+    void* data = malloc(size);
+    bool ok = data && sgp_capture(data, size) == size;
+    bench_pass();
+    sgp_flush();
+    sgp_end();
+    sg_end_pass();
+    sg_commit();
+    bench_check_error();
+    if (ok) {
+        FILE* file = fopen(path, "wb");
+        ok = file && fwrite(data, 1, size, file) == size;
+        if (file) {
+            fclose(file);
+        }
+    }
+    free(data);
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    int frames = BENCH_DEFAULT_FRAMES;
+    int depth = -1;
+    int max_move_vertices = -1;
+    const char* trace_path = NULL;
+    const char* capture_path = NULL;
+    bool grow = false;
+    bool indexed = false;
+    bool compact = false;
+    bool baked = false;
+    bool sorted = false;
+    bool multi_texture = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-frames") == 0 && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-depth") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-move") == 0 && i + 1 < argc) {
+            max_move_vertices = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-trace") == 0 && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if (strcmp(argv[i], "-capture") == 0 && i + 1 < argc) {
+            capture_path = argv[++i];
+        } else if (strcmp(argv[i], "-grow") == 0) {
+            grow = true;
+        } else if (strcmp(argv[i], "-indexed") == 0) {
+            indexed = true;
+        } else if (strcmp(argv[i], "-compact") == 0) {
+            compact = true;
+        } else if (strcmp(argv[i], "-static") == 0) {
+            baked = true;
+        } else if (strcmp(argv[i], "-sort") == 0) {
+            sorted = true;
+        } else if (strcmp(argv[i], "-multitex") == 0) {
+            multi_texture = true;
+        } else {
+            fprintf(stderr, "usage: %s [-frames N] [-depth N] [-move N] [-trace FILE] [-capture FILE] [-grow] [-indexed] [-compact] [-static] [-sort] [-multitex]\n", argv[0]);
+            return -1;
+        }
+    }
+    if (frames <= 0) {
+        fprintf(stderr, "Invalid number of frames\n");
+        return -1;
+    }
+    if (depth < -1 || max_move_vertices < -1) {
+        fprintf(stderr, "Invalid batch optimizer settings\n");
+        return -1;
+    }
+
+    stm_setup();
+
+    // initialize Sokol GFX
+    sg_desc sgdesc = {
+        .environment.defaults.color_format = SG_PIXELFORMAT_RGBA8,
+        .environment.defaults.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        .environment.defaults.sample_count = 1,
+        .logger.func = slog_func
+    };
+    sg_setup(&sgdesc);
+    if (!sg_isvalid()) {
+        fprintf(stderr, "Failed to create Sokol GFX context!\n");
+        return -1;
+    }
+
+    // initialize tracing
+#ifdef SGP_TRACE
+    sgp_chrome_trace trace = {0};
+    if (trace_path) {
+        FILE* trace_file = fopen(trace_path, "w");
+        if (!trace_file) {
+            fprintf(stderr, "Failed to open trace file %s\n", trace_path);
+            return -1;
+        }
+        sgp_chrome_trace_begin(&trace, trace_file);
+    }
+#else
+    if (trace_path) {
+        fprintf(stderr, "Tracing requires building with SGP_TRACE defined\n");
+        return -1;
+    }
+#endif
+
+    // initialize Sokol GP
+    sgp_desc sgpdesc = {
+        .max_vertices = grow ? 1024 : 262144,
+        .max_commands = grow ? 64 : 32768,
+        .grow_buffers = grow,
+        .indexed_quads = indexed,
+        .compact_vertices = compact,
+        .sorted_batching = sorted,
+        .multi_texture_batching = multi_texture,
+        .batch_optimizer_depth = depth < 0 ? 0 : depth == 0 ? SGP_BATCH_OPTIMIZER_OFF : (uint32_t)depth,
+        .batch_optimizer_max_move_vertices = max_move_vertices < 0 ? 0 : max_move_vertices == 0 ? SGP_BATCH_OPTIMIZER_OFF : (uint32_t)max_move_vertices,
+#ifdef SGP_TRACE
+        .tracer.func = trace_path ? sgp_chrome_trace_func : NULL,
+        .tracer.user_data = &trace
+#endif
+    };
+    sgp_setup(&sgpdesc);
+    if (!sgp_is_valid()) {
+        fprintf(stderr, "Failed to create Sokol GP context: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return -1;
+    }
+
+    bench_setup_images();
+
+    printf("{\n");
+    printf("  \"backend\": \"dummy\",\n");
+    printf("  \"frames\": %d,\n", frames);
+    sgp_desc desc = sgp_query_desc();
+    printf("  \"batch_optimizer_depth\": %u,\n", desc.batch_optimizer_depth);
+    printf("  \"batch_optimizer_max_move_vertices\": %u,\n", desc.batch_optimizer_max_move_vertices);
+    printf("  \"indexed_quads\": %s,\n", desc.indexed_quads ? "true" : "false");
+    printf("  \"compact_vertices\": %s,\n", desc.compact_vertices ? "true" : "false");
+    printf("  \"static_batches\": %s,\n", baked ? "true" : "false");
+    printf("  \"sorted_batching\": %s,\n", desc.sorted_batching ? "true" : "false");
+    printf("  \"multi_texture_batching\": %s,\n", desc.multi_texture_batching ? "true" : "false");
+    printf("  \"scenarios\": [\n");
+    int num_scenarios = (int)(sizeof(bench_scenarios) / sizeof(bench_scenarios[0]));
+    for (int i = 0; i < num_scenarios; ++i) {
+        bench_run(bench_scenarios[i].draw, bench_scenarios[i].name, frames, baked, false);
+    }
+    bench_run(bench_draw_all, "all", frames, baked, true);
+    printf("  ],\n");
+    // peak usage of all scenarios, to size max_vertices and max_commands
+    sgp_high_water_marks marks = sgp_query_high_water_marks();
+    printf("  \"high_water_marks\": {\"vertices\": %u, \"commands\": %u, \"uniforms\": %u, \"sprites\": %u}\n",
+           marks.num_vertices, marks.num_commands, marks.num_uniforms, marks.num_sprites);
+    printf("}\n");
+
+    if (capture_path && !bench_capture(bench_draw_all, capture_path)) {
+        fprintf(stderr, "Failed to write capture file %s\n", capture_path);
+        return -1;
+    }
+
+    bench_destroy_images();
+    sgp_shutdown();
+    sg_shutdown();
+#ifdef SGP_TRACE
+    if (trace.file) {
+        FILE* trace_file = trace.file;
+        sgp_chrome_trace_end(&trace);
+        fclose(trace_file);
+    }
+#endif
+    return 0;
+}
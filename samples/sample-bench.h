@@ -0,0 +1,245 @@
+/*
+Benchmark scenarios shared by the windowed and headless benchmark samples.
+Each scenario draws lots of primitives with interleaved textures or pipelines,
+to measure the gains of the batch optimizer.
+
+Must be included after `sokol_gfx.h` and `sokol_gp.h` implementations.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+
+static sg_image image1;
+static sg_image image2;
+static float image_ratio;
+
+static const int count = 48;
+static const int rect_count = 4;
+
+/* Number of draw calls issued by the scenarios, used to report per draw call costs. */
+static uint32_t bench_num_draws;
+
+static void bench_draw_rect(float x, float y, float w, float h) {
+    bench_num_draws++;
+    sgp_draw_filled_rect(x, y, w, h);
+}
+
+static void bench_repeated_textured(void) {
+    sgp_reset_color();
+    sgp_set_image(0, image1);
+    for (int y=0;y<count;++y) {
+        for (int x=0;x<count;++x) {
+            bench_draw_rect(x*rect_count*2, y*rect_count*2, rect_count, rect_count);
+        }
+    }
+    sgp_reset_image(0);
+}
+
+static void bench_multiple_textured(void) {
+    sgp_reset_color();
+    for (int y=0;y<count;++y) {
+        for (int x=0;x<count;++x) {
+            sgp_set_image(0, x % 2 == 0 ? image1 : image2);
+            bench_draw_rect(x*rect_count*2, y*rect_count*2, rect_count, rect_count);
+        }
+    }
+    sgp_reset_image(0);
+}
+
+static void bench_colored_textured(void) {
+    sgp_reset_color();
+    sgp_set_image(0, image1);
+    for (int y=0;y<count;++y) {
+        for (int x=0;x<count;++x) {
+            if (x % 3 == 0) {
+                sgp_set_color(1.0f, 0, 0, 1.0f);
+            } else if (x % 3 == 1) {
+                sgp_set_color(0, 1.0f, 0, 1.0f);
+            } else {
+                sgp_set_color(0, 0, 1.0f, 1.0f);
+            }
+            bench_draw_rect(x*rect_count*2, y*rect_count*2, rect_count, rect_count);
+        }
+    }
+    sgp_reset_image(0);
+}
+
+static void bench_repeated_filled(void) {
+    sgp_reset_color();
+    for (int y=0;y<count;++y) {
+        for (int x=0;x<count;++x) {
+            bench_draw_rect(x*rect_count*2, y*rect_count*2, rect_count, rect_count);
+        }
+    }
+}
+
+static void bench_colored_filled(void) {
+    sgp_reset_color();
+    for (int y=0;y<count;++y) {
+        for (int x=0;x<count;++x) {
+            if (x % 3 == 0) {
+                sgp_set_color(1.0f, 0, 0, 1.0f);
+            } else if (x % 3 == 1) {
+                sgp_set_color(0, 1.0f, 0, 1.0f);
+            } else {
+                sgp_set_color(0, 0, 1.0f, 1.0f);
+            }
+            bench_draw_rect(x*rect_count*2, y*rect_count*2, rect_count, rect_count);
+        }
+    }
+}
+
+/* Same rectangles as above drawn in one call with a color each, counted as one draw per rectangle to compare their costs. */
+static void bench_colored_filled_batch(void) {
+    static sgp_colored_rect rects[48*48];
+    static const sgp_color_ub4 colors[3] = {{255, 0, 0, 255}, {0, 255, 0, 255}, {0, 0, 255, 255}};
+    assert(count*count <= (int)(sizeof(rects)/sizeof(rects[0])));
+    for (int y=0;y<count;++y) {
+        for (int x=0;x<count;++x) {
+            sgp_colored_rect* rect = &rects[y*count+x];
+            rect->rect = (sgp_rect){x*rect_count*2, y*rect_count*2, rect_count, rect_count};
+            rect->color = colors[x % 3];
+        }
+    }
+    bench_num_draws += (uint32_t)(count*count);
+    sgp_draw_colored_rects(rects, (uint32_t)(count*count));
+}
+
+static void bench_mixed(void) {
+    for (int diagonal = 0; diagonal < 2*count - 1; ++diagonal) {
+        int advance = _sg_max(diagonal - count + 1, 0);
+        for (int y = diagonal - advance, x = advance; y >= 0 && x < count; --y, ++x) {
+            if (x % 3 == 0) {
+                sgp_set_color(1.0f, 0, 0, 1.0f);
+            } else if (x % 3 == 1) {
+                sgp_set_color(0, 1.0f, 0, 1.0f);
+            } else {
+                sgp_set_color(0, 0, 1.0f, 1.0f);
+            }
+            if ((x+y) % 2 == 0) {
+                bench_draw_rect(x*rect_count*2, y*rect_count*2, rect_count, rect_count);
+            } else {
+                sgp_set_image(0, image1);
+                bench_draw_rect(x*rect_count*2, y*rect_count*2, rect_count, rect_count);
+                sgp_reset_image(0);
+            }
+        }
+    }
+}
+
+static void bench_sync_mixed(void) {
+    sgp_set_image(0, image1);
+    sgp_reset_color();
+    for (int y=0;y<count;++y) {
+        for (int x=0;x<count;++x) {
+            if ((x+y) % 2 == 0) {
+                sgp_set_color(1.0f, 0, 0, 1.0f);
+                bench_draw_rect(x*rect_count*2, y*rect_count*2, rect_count, rect_count);
+            } else {
+                sgp_set_color(0, 1.0f, 0, 1.0f);
+                bench_draw_rect(x*rect_count*2, y*rect_count*2, rect_count, rect_count);
+            }
+        }
+    }
+    sgp_reset_image(0);
+}
+
+static void draw_cat(void) {
+    sgp_reset_color();
+    sgp_set_image(0, image1);
+    bench_draw_rect(0, 0, rect_count*count*2, rect_count*count*2);
+    sgp_reset_image(0);
+}
+
+static void draw_rect(void) {
+    sgp_reset_color();
+    bench_draw_rect(0, 0, rect_count*count*2, rect_count*count*2);
+}
+
+typedef struct bench_scenario {
+    const char* name;
+    void (*draw)(void);
+} bench_scenario;
+
+static const bench_scenario bench_scenarios[] = {
+    {"repeated_textured", bench_repeated_textured},
+    {"multiple_textured", bench_multiple_textured},
+    {"colored_textured", bench_colored_textured},
+    {"repeated_filled", bench_repeated_filled},
+    {"mixed", bench_mixed},
+    {"colored_filled", bench_colored_filled},
+    {"colored_filled_batch", bench_colored_filled_batch},
+    {"cat", draw_cat},
+    {"rect", draw_rect},
+    {"sync_mixed", bench_sync_mixed},
+};
+
+/* Draws all scenarios side by side in a 3x3 grid, this is what the windowed benchmark renders. */
+static void bench_draw_all(void) {
+    // draw background
+    sgp_set_color(0.05f, 0.05f, 0.05f, 1.0f);
+    sgp_clear();
+    bench_num_draws++;
+    sgp_reset_color();
+
+    int off = count*rect_count*2;
+    bench_repeated_textured();
+
+    sgp_translate(off, 0);
+    bench_multiple_textured();
+
+    sgp_translate(off, 0);
+    bench_colored_textured();
+
+    sgp_translate(-2*off, off);
+    bench_repeated_filled();
+
+    sgp_translate(off, 0);
+    bench_mixed();
+
+    sgp_translate(off, 0);
+    bench_colored_filled();
+
+    sgp_translate(-2*off, off);
+    draw_cat();
+
+    sgp_translate(off, 0);
+    draw_rect();
+
+    sgp_translate(off, 0);
+    bench_sync_mixed();
+}
+
+static sg_image create_image(int width, int height) {
+    size_t num_pixels = (size_t)(width * height * 4);
+    unsigned char* data = (unsigned char*)malloc(num_pixels);
+    assert(data);
+    for (int y=0;y<height;++y) {
+        for (int x=0;x<width;++x) {
+            data[y*width*4+x*4+0] = (x*255) / width;
+            data[y*width*4+x*4+1] = (y*255) / height;
+            data[y*width*4+x*4+2] = 255 - (x*y*255)/ (width*height);
+            data[y*width*4+x*4+3] = 255;
+        }
+    }
+    sg_image_desc image_desc = {0};
+    image_desc.width = width;
+    image_desc.height = height;
+    image_desc.data.subimage[0][0].ptr = data;
+    image_desc.data.subimage[0][0].size = num_pixels;
+    sg_image image = sg_make_image(&image_desc);
+    free(data);
+    assert(sg_query_image_state(image) == SG_RESOURCESTATE_VALID);
+    return image;
+}
+
+static void bench_setup_images(void) {
+    image1 = create_image(128, 128);
+    image2 = create_image(128, 128);
+    image_ratio = 1.0f;
+}
+
+static void bench_destroy_images(void) {
+    sg_destroy_image(image1);
+    sg_destroy_image(image2);
+}
@@ -0,0 +1,393 @@
+/*
+This sample checks the builtin shader programs on a real OpenGL driver without a window,
+rendering offscreen in a surfaceless EGL context, such as the one of Mesa llvmpipe.
+Every check draws a scene twice, once with the program under test and once generating
+the same vertices on the CPU for the common program, and the images read back must match:
+- instanced sprites must draw the same as textured rectangles.
+- shapes transformed on the GPU must draw the same as transformed on the CPU.
+- a static batch must draw the same as the shapes it was baked from.
+- draws packed with multiple textures must draw the same as one draw per texture.
+- compact vertices must draw the same as float vertices, also for shapes crossing the screen edges.
+It exits with a non zero code when a builtin shader fails to build or any image differs.
+
+It must be built with the GL core or GLES3 backend, for example:
+    make gl-headless backend=glcore
+    ./build/sample-gl-test
+*/
+
+#define SOKOL_IMPL
+#include "sokol_gfx.h"
+#include "sokol_gp.h"
+#include "sokol_log.h"
+
+#if !defined(SOKOL_GLCORE) && !defined(SOKOL_GLES3)
+#error "The GL test must be built with the GL core or GLES3 backend (backend=glcore or backend=gles3)"
+#endif
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    TEST_WIDTH = 128,
+    TEST_HEIGHT = 128
+};
+
+static sg_image color_img;
+static sg_image depth_img;
+static sg_attachments attachments;
+static sg_image textures[4];
+static uint32_t reference_pixels[TEST_WIDTH*TEST_HEIGHT];
+static uint32_t tested_pixels[TEST_WIDTH*TEST_HEIGHT];
+static sgp_static_batch* shapes_batch;
+
+////////////////////////////////////////////////////////////////////////////////
+// offscreen rendering
+
+static bool setup_egl(void) {
+    // a surfaceless display needs no window system, fall back to the default one
+    PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display = (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+    EGLDisplay display = EGL_NO_DISPLAY;
+    if (get_platform_display) {
+        display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    }
+    if (display == EGL_NO_DISPLAY) {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL)) {
+        return false;
+    }
+#if defined(SOKOL_GLCORE)
+    eglBindAPI(EGL_OPENGL_API);
+    const EGLint context_attrs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 1,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+#else
+    eglBindAPI(EGL_OPENGL_ES_API);
+    const EGLint context_attrs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 0,
+        EGL_NONE
+    };
+#endif
+    EGLContext context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, context_attrs);
+    if (context == EGL_NO_CONTEXT) {
+        return false;
+    }
+    return eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+}
+
+static bool setup_resources(void) {
+    sg_image_desc color_img_desc = {
+        .render_target = true,
+        .width = TEST_WIDTH,
+        .height = TEST_HEIGHT,
+        .pixel_format = SG_PIXELFORMAT_RGBA8
+    };
+    color_img = sg_make_image(&color_img_desc);
+    sg_image_desc depth_img_desc = {
+        .render_target = true,
+        .width = TEST_WIDTH,
+        .height = TEST_HEIGHT,
+        .pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL
+    };
+    depth_img = sg_make_image(&depth_img_desc);
+    sg_attachments_desc attachments_desc = {
+        .colors = {{.image = color_img}},
+        .depth_stencil = {.image = depth_img}
+    };
+    attachments = sg_make_attachments(&attachments_desc);
+
+    // every texel of every texture has its own color, so a wrong texture coordinate or slot changes the image
+    bool ok = sg_query_attachments_state(attachments) == SG_RESOURCESTATE_VALID;
+    for (int t = 0; t < 4; ++t) {
+        uint32_t pixels[4*4];
+        for (int i = 0; i < 4*4; ++i) {
+            pixels[i] = 0xff000000 | (uint32_t)((i * 16 + 15) | ((255 - i * 16) << 8) | (((i + t) % 4) * 80 << 16));
+        }
+        sg_image_desc texture_desc = {
+            .width = 4,
+            .height = 4,
+            .data.subimage[0][0] = SG_RANGE(pixels)
+        };
+        textures[t] = sg_make_image(&texture_desc);
+        ok = ok && sg_query_image_state(textures[t]) == SG_RESOURCESTATE_VALID;
+    }
+    return ok;
+}
+
+static void destroy_resources(void) {
+    sg_destroy_attachments(attachments);
+    sg_destroy_image(color_img);
+    sg_destroy_image(depth_img);
+    for (int t = 0; t < 4; ++t) {
+        sg_destroy_image(textures[t]);
+    }
+}
+
+// draws a scene offscreen in a context and reads its image back
+static bool render_scene(sgp_context ctx, void (*draw)(void), uint32_t* pixels) {
+    sgp_set_context(ctx);
+    sgp_begin(TEST_WIDTH, TEST_HEIGHT);
+    draw();
+    sg_pass pass = {
+        .action.colors[0] = {.load_action = SG_LOADACTION_CLEAR, .clear_value = {0.0f, 0.0f, 0.0f, 1.0f}},
+        .attachments = attachments
+    };
+    sg_begin_pass(&pass);
+    sgp_flush();
+    sgp_end();
+    sg_end_pass();
+    sg_commit();
+    sgp_error error = sgp_get_last_error();
+    sgp_set_context(sgp_default_context());
+    if (error != SGP_NO_ERROR) {
+        fprintf(stderr, "Sokol GP error: %s\n", sgp_get_error_message(error));
+        return false;
+    }
+
+    // the framebuffer binding is changed behind Sokol GFX, so its state cache must be reset
+    glBindFramebuffer(GL_FRAMEBUFFER, sg_gl_query_attachments_info(attachments).framebuffer);
+    glReadPixels(0, 0, TEST_WIDTH, TEST_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    sg_reset_state_cache();
+    return glGetError() == GL_NO_ERROR;
+}
+
+// renders the reference scene in the default context and the tested one in a context,
+// their images must match and not be empty
+static bool check_scene(const char* name, sgp_context ctx, void (*draw_reference)(void), void (*draw_tested)(void)) {
+    if (!render_scene(sgp_default_context(), draw_reference, reference_pixels) || !render_scene(ctx, draw_tested, tested_pixels)) {
+        printf("FAIL %s: the scene could not be rendered\n", name);
+        return false;
+    }
+    int num_drawn = 0;
+    int num_different = 0;
+    for (int i = 0; i < TEST_WIDTH*TEST_HEIGHT; ++i) {
+        num_drawn += reference_pixels[i] != 0xff000000;
+        num_different += reference_pixels[i] != tested_pixels[i];
+    }
+    if (num_drawn == 0 || num_different > 0) {
+        printf("FAIL %s: %d of %d drawn pixels differ\n", name, num_different, num_drawn);
+        return false;
+    }
+    printf("ok   %s: %d pixels drawn\n", name, num_drawn);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// scenes
+
+static sgp_sprite scene_sprite(int i) {
+    sgp_sprite sprite = {
+        .dst = {(float)(i % 6) * 18.0f + 4.0f, (float)(i / 6) * 18.0f + 4.0f, 12.0f + (float)(i % 3) * 2.0f, 12.0f},
+        .src = {(float)(i % 3), (float)(i % 2), 2.0f, 2.0f},
+        .color = {(uint8_t)(i % 2 ? 255 : 128), 255, (uint8_t)(i % 3 ? 255 : 0), 255}
+    };
+    return sprite;
+}
+
+static void scene_sprites_reference(void) {
+    sgp_set_image(0, textures[0]);
+    sgp_translate(3.0f, 5.0f);
+    for (int i = 0; i < 36; ++i) {
+        sgp_sprite sprite = scene_sprite(i);
+        sgp_set_color(sprite.color.r / 255.0f, sprite.color.g / 255.0f, sprite.color.b / 255.0f, sprite.color.a / 255.0f);
+        sgp_draw_textured_rect(0, sprite.dst, sprite.src);
+    }
+    sgp_reset_color();
+    sgp_reset_image(0);
+}
+
+static void scene_sprites_instanced(void) {
+    sgp_sprite sprites[36];
+    for (int i = 0; i < 36; ++i) {
+        sprites[i] = scene_sprite(i);
+    }
+    sgp_set_image(0, textures[0]);
+    sgp_translate(3.0f, 5.0f);
+    sgp_draw_sprites_instanced(0, sprites, 36);
+    sgp_reset_image(0);
+}
+
+// shapes of every builtin primitive type, at pixel exact positions once transformed
+static void draw_shapes(void) {
+    for (int i = 0; i < 12; ++i) {
+        float x = (float)(i % 4) * 24.0f;
+        float y = (float)(i / 4) * 24.0f;
+        sgp_set_color((float)(i % 2), (float)(i % 3) * 0.5f, 1.0f - (float)i / 12.0f, 1.0f);
+        sgp_draw_filled_rect(x, y, 16.0f, 12.0f);
+    }
+    sgp_set_image(0, textures[0]);
+    sgp_set_color(1.0f, 1.0f, 1.0f, 1.0f);
+    sgp_draw_textured_rect(0, (sgp_rect){0.0f, 72.0f, 32.0f, 16.0f}, (sgp_rect){1.0f, 0.0f, 2.0f, 4.0f});
+    sgp_reset_image(0);
+    sgp_set_color(0.0f, 1.0f, 0.5f, 1.0f);
+    sgp_draw_filled_triangle(40.0f, 72.0f, 72.0f, 72.0f, 40.0f, 88.0f);
+    sgp_set_blend_mode(SGP_BLENDMODE_ADD);
+    sgp_set_color(0.5f, 0.0f, 0.0f, 1.0f);
+    sgp_draw_filled_rect(8.0f, 8.0f, 48.0f, 24.0f);
+    sgp_reset_blend_mode();
+    sgp_set_color(1.0f, 1.0f, 0.0f, 1.0f);
+    sgp_draw_line(0.5f, 92.5f, 80.5f, 92.5f);
+    sgp_draw_point(84.5f, 92.5f);
+    sgp_reset_color();
+}
+
+static void scene_shapes_cpu_transform(void) {
+    sgp_translate(6.0f, 10.0f);
+    sgp_scale(1.25f, 1.0f);
+    draw_shapes();
+}
+
+static void scene_shapes_gpu_transform(void) {
+    sgp_set_gpu_transform(true);
+    sgp_translate(6.0f, 10.0f);
+    sgp_scale(1.25f, 1.0f);
+    draw_shapes();
+}
+
+static void scene_shapes_offscreen(void) {
+    sgp_translate(-20.0f, 20.0f);
+    sgp_rotate_at(0.25f, 64.0f, 64.0f);
+    sgp_scale(1.75f, 1.0f);
+    draw_shapes();
+}
+
+static void scene_shapes_static_batch(void) {
+    sgp_translate(6.0f, 10.0f);
+    sgp_scale(1.25f, 1.0f);
+    sgp_draw_static_batch(shapes_batch);
+}
+
+// textured rectangles alternating their texture, with some untextured ones in between
+static void scene_interleaved_textures(void) {
+    for (int i = 0; i < 30; ++i) {
+        sgp_rect dst = {(float)(i % 6) * 20.0f + 4.0f, (float)(i / 6) * 20.0f + 4.0f, 16.0f, 16.0f};
+        sgp_set_color(1.0f, (float)(i % 3) * 0.5f, 1.0f, 1.0f);
+        if (i % 7 == 6) {
+            sgp_draw_filled_rect(dst.x, dst.y, dst.w, dst.h);
+            continue;
+        }
+        sgp_set_image(0, textures[i % 4]);
+        sgp_draw_textured_rect(0, dst, (sgp_rect){(float)(i % 2), 0.0f, 3.0f, 4.0f});
+        sgp_reset_image(0);
+    }
+    sgp_set_image(0, textures[1]);
+    sgp_draw_point(2.5f, 124.5f);
+    sgp_draw_line(4.5f, 124.5f, 60.5f, 124.5f);
+    sgp_reset_image(0);
+    sgp_reset_color();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// test runner
+
+int main(int argc, char* argv[]) {
+    (void)argv;
+    if (argc > 1) {
+        fprintf(stderr, "usage: %s\n", argv[0]);
+        return -1;
+    }
+    if (!setup_egl()) {
+        fprintf(stderr, "Failed to create a surfaceless EGL context!\n");
+        return -1;
+    }
+
+    // initialize Sokol GFX
+    sg_desc sgdesc = {
+        .environment.defaults.color_format = SG_PIXELFORMAT_RGBA8,
+        .environment.defaults.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        .environment.defaults.sample_count = 1,
+        .logger.func = slog_func
+    };
+    sg_setup(&sgdesc);
+    if (!sg_isvalid() || !setup_resources()) {
+        fprintf(stderr, "Failed to create Sokol GFX context!\n");
+        return -1;
+    }
+    printf("%s\n", (const char*)glGetString(GL_RENDERER));
+
+    // initialize Sokol GP, it fails when a builtin shader doesn't build
+    sgp_desc sgpdesc = {0};
+    sgp_setup(&sgpdesc);
+    if (!sgp_is_valid()) {
+        fprintf(stderr, "Failed to create Sokol GP context: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return -1;
+    }
+
+    // the shapes baked once, in the same frame size they are drawn
+    sgp_command_list* list = sgp_make_command_list(&(sgp_command_list_desc){0});
+    if (!list) {
+        fprintf(stderr, "Failed to create command list: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return -1;
+    }
+    sgp_begin_command_list(list, TEST_WIDTH, TEST_HEIGHT);
+    draw_shapes();
+    sgp_end_command_list();
+    shapes_batch = sgp_make_static_batch(list);
+    sgp_destroy_command_list(list);
+    if (!shapes_batch) {
+        fprintf(stderr, "Failed to create static batch: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return -1;
+    }
+
+    // another context packs draws of different textures, it shares the textures of the default one
+    sgp_desc multi_texture_desc = {.multi_texture_batching = true};
+    sgp_context multi_texture_ctx = sgp_make_context(&multi_texture_desc);
+    if (multi_texture_ctx.id == 0) {
+        fprintf(stderr, "Failed to create multi texture context: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return -1;
+    }
+
+    // and another one uploads compact vertices
+    sgp_desc compact_desc = {.compact_vertices = true};
+    sgp_context compact_ctx = sgp_make_context(&compact_desc);
+    if (compact_ctx.id == 0) {
+        fprintf(stderr, "Failed to create compact vertices context: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return -1;
+    }
+
+    sgp_context ctx = sgp_default_context();
+    bool ok = true;
+    ok = check_scene("sprites_instanced", ctx, scene_sprites_reference, scene_sprites_instanced) && ok;
+    ok = check_scene("gpu_transform", ctx, scene_shapes_cpu_transform, scene_shapes_gpu_transform) && ok;
+    ok = check_scene("static_batch", ctx, scene_shapes_cpu_transform, scene_shapes_static_batch) && ok;
+    if (check_scene("multi_texture", multi_texture_ctx, scene_interleaved_textures, scene_interleaved_textures)) {
+        sgp_set_context(multi_texture_ctx);
+        uint32_t num_merged_textures = sgp_query_stats().num_merged_textures;
+        sgp_set_context(ctx);
+        if (num_merged_textures == 0) {
+            printf("FAIL multi_texture: no draws were packed with multiple textures\n");
+            ok = false;
+        }
+    } else {
+        ok = false;
+    }
+
+    // shapes on screen are packed, shapes crossing its edges keep float vertices
+    ok = check_scene("compact_vertices", compact_ctx, scene_shapes_cpu_transform, scene_shapes_cpu_transform) && ok;
+    sgp_set_context(compact_ctx);
+    uint32_t num_compact_vertices = sgp_query_stats().num_compact_vertices;
+    sgp_set_context(ctx);
+    ok = check_scene("compact_vertices_offscreen", compact_ctx, scene_shapes_offscreen, scene_shapes_offscreen) && ok;
+    sgp_set_context(compact_ctx);
+    uint32_t num_offscreen_compact_vertices = sgp_query_stats().num_compact_vertices;
+    sgp_set_context(ctx);
+    if (num_compact_vertices == 0 || num_offscreen_compact_vertices != 0) {
+        printf("FAIL compact_vertices: %u compact vertices on screen and %u crossing its edges, expected some and none\n",
+               num_compact_vertices, num_offscreen_compact_vertices);
+        ok = false;
+    }
+
+    sgp_destroy_static_batch(shapes_batch);
+    sgp_shutdown();
+    destroy_resources();
+    sg_shutdown();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,277 @@
+/*
+This sample is a microbenchmark of the vertex generation of the draw functions,
+it calls them with different batch sizes and transforms without a window or a GPU,
+and prints the throughput in vertices per second and cycles per vertex as JSON.
+The batch optimizer is disabled, so only the vertex generation and command queueing are measured.
+
+It must be built with the dummy backend, for example:
+    make headless backend=dummy build=release
+    ./build/sample-microbench -frames 50
+
+Use `-kernel NAME`, `-batch N` and `-transform NAME` to run only some of the combinations.
+*/
+
+#define SOKOL_IMPL
+#include "sokol_gfx.h"
+#include "sokol_gp.h"
+#include "sokol_time.h"
+#include "sokol_log.h"
+
+#ifndef SOKOL_DUMMY_BACKEND
+#error "The microbenchmark must be built with the dummy backend (backend=dummy)"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define MICROBENCH_HAS_CYCLES 1
+static uint64_t microbench_cycles(void) { return __rdtsc(); }
+#else
+#define MICROBENCH_HAS_CYCLES 0
+static uint64_t microbench_cycles(void) { return 0; }
+#endif
+
+enum {
+    MICROBENCH_WIDTH = 1024,
+    MICROBENCH_HEIGHT = 1024,
+    MICROBENCH_MAX_PRIMITIVES = 65536, // primitives drawn per frame
+    MICROBENCH_WARMUP_FRAMES = 3,
+    MICROBENCH_DEFAULT_FRAMES = 20
+};
+
+static sgp_rect rects[MICROBENCH_MAX_PRIMITIVES];
+static sgp_textured_rect textured_rects[MICROBENCH_MAX_PRIMITIVES];
+static sgp_triangle triangles[MICROBENCH_MAX_PRIMITIVES];
+static sgp_vertex vertices[MICROBENCH_MAX_PRIMITIVES*3];
+static sgp_sprite sprites[MICROBENCH_MAX_PRIMITIVES];
+static sg_image image;
+
+static void draw_filled_rects(uint32_t first, uint32_t count) {
+    sgp_draw_filled_rects(&rects[first], count);
+}
+
+static void draw_textured_rects(uint32_t first, uint32_t count) {
+    sgp_draw_textured_rects(0, &textured_rects[first], count);
+}
+
+static void draw_filled_triangles(uint32_t first, uint32_t count) {
+    sgp_draw_filled_triangles(&triangles[first], count);
+}
+
+static void draw_vertices(uint32_t first, uint32_t count) {
+    sgp_draw(SG_PRIMITIVETYPE_TRIANGLES, &vertices[first*3], count*3);
+}
+
+static void draw_sprites_instanced(uint32_t first, uint32_t count) {
+    sgp_draw_sprites_instanced(0, &sprites[first], count);
+}
+
+typedef struct microbench_kernel {
+    const char* name;
+    void (*draw)(uint32_t first, uint32_t count);
+    uint32_t vertices_per_primitive;
+} microbench_kernel;
+
+static const microbench_kernel kernels[] = {
+    {"filled_rects", draw_filled_rects, 6},
+    {"textured_rects", draw_textured_rects, 6},
+    {"filled_triangles", draw_filled_triangles, 3},
+    {"draw", draw_vertices, 3},
+    {"sprites_instanced", draw_sprites_instanced, 4},
+};
+
+static const uint32_t batch_sizes[] = {1, 16, 1024, 65536};
+
+static const char* transforms[] = {"identity", "translate", "rotate_scale", "gpu_rotate_scale"};
+
+static void apply_transform(int transform) {
+    switch (transform) {
+        case 1:
+            sgp_translate(3.5f, 2.25f);
+            break;
+        case 3:
+            // the same transform applied by the vertex shader, vertices stay in local space
+            sgp_set_gpu_transform(true);
+            // fallthrough
+        case 2:
+            sgp_rotate_at(0.3f, MICROBENCH_WIDTH*0.5f, MICROBENCH_HEIGHT*0.5f);
+            sgp_scale_at(0.9f, 0.8f, MICROBENCH_WIDTH*0.5f, MICROBENCH_HEIGHT*0.5f);
+            break;
+        default:
+            break;
+    }
+}
+
+static void setup_primitives(void) {
+    // small primitives spread over the whole screen, so none is culled
+    for (uint32_t i = 0; i < MICROBENCH_MAX_PRIMITIVES; ++i) {
+        float x = (float)(i % 256) * 4.0f;
+        float y = (float)((i / 256) % 256) * 4.0f;
+        rects[i] = (sgp_rect){x, y, 3.0f, 3.0f};
+        textured_rects[i] = (sgp_textured_rect){{x, y, 3.0f, 3.0f}, {(float)(i % 8), (float)(i % 8), 8.0f, 8.0f}};
+        triangles[i] = (sgp_triangle){{x, y}, {x + 3.0f, y}, {x, y + 3.0f}};
+        sprites[i] = (sgp_sprite){textured_rects[i].dst, textured_rects[i].src, {255, 255, 255, 255}, 0.0f};
+        for (uint32_t j = 0; j < 3; ++j) {
+            sgp_vertex* v = &vertices[i*3 + j];
+            v->position = j == 0 ? triangles[i].a : (j == 1 ? triangles[i].b : triangles[i].c);
+            v->texcoord = (sgp_vec2){0.0f, 0.0f};
+            v->color = (sgp_color_ub4){255, 255, 255, 255};
+        }
+    }
+}
+
+static void flush_frame(void) {
+    sg_pass pass = {0};
+    pass.swapchain.width = MICROBENCH_WIDTH;
+    pass.swapchain.height = MICROBENCH_HEIGHT;
+    pass.swapchain.sample_count = 1;
+    pass.swapchain.color_format = SG_PIXELFORMAT_RGBA8;
+    pass.swapchain.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+    sg_begin_pass(&pass);
+    sgp_flush();
+    sgp_end();
+    sg_end_pass();
+    sg_commit();
+    if (sgp_get_last_error() != SGP_NO_ERROR) {
+        fprintf(stderr, "Sokol GP error: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        exit(-1);
+    }
+}
+
+static void run(const microbench_kernel* kernel, uint32_t batch, int transform, int frames, bool first) {
+    uint64_t ticks = 0;
+    uint64_t cycles = 0;
+    uint64_t num_vertices = 0;
+    for (int frame = 0; frame < MICROBENCH_WARMUP_FRAMES + frames; ++frame) {
+        sgp_begin(MICROBENCH_WIDTH, MICROBENCH_HEIGHT);
+        sgp_set_batch_optimizer(0, 0);
+        if (kernel->draw == draw_textured_rects || kernel->draw == draw_sprites_instanced) {
+            sgp_set_image(0, image);
+        }
+        apply_transform(transform);
+
+        // draw the same amount of primitives for every batch size
+        uint64_t start = stm_now();
+        uint64_t start_cycles = microbench_cycles();
+        for (uint32_t i = 0; i < MICROBENCH_MAX_PRIMITIVES; i += batch) {
+            kernel->draw(i, batch);
+        }
+        uint64_t end_cycles = microbench_cycles();
+        uint64_t end = stm_now();
+
+        if (frame >= MICROBENCH_WARMUP_FRAMES) {
+            ticks += stm_diff(end, start);
+            cycles += end_cycles - start_cycles;
+            num_vertices += (uint64_t)MICROBENCH_MAX_PRIMITIVES * kernel->vertices_per_primitive;
+        }
+        flush_frame();
+    }
+    double seconds = stm_sec(ticks);
+    printf("%s    {\"kernel\": \"%s\", \"batch\": %u, \"transform\": \"%s\", \"vertices\": %llu, "
+           "\"vertices_per_sec\": %.0f, \"ns_per_vertex\": %.3f, ",
+           first ? "" : ",\n", kernel->name, batch, transforms[transform], (unsigned long long)num_vertices,
+           seconds > 0 ? (double)num_vertices / seconds : 0.0, stm_ns(ticks) / (double)num_vertices);
+    if (MICROBENCH_HAS_CYCLES) {
+        printf("\"cycles_per_vertex\": %.3f}", (double)cycles / (double)num_vertices);
+    } else {
+        printf("\"cycles_per_vertex\": null}");
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int frames = MICROBENCH_DEFAULT_FRAMES;
+    const char* kernel_filter = NULL;
+    const char* transform_filter = NULL;
+    uint32_t batch_filter = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-frames") == 0 && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-kernel") == 0 && i + 1 < argc) {
+            kernel_filter = argv[++i];
+        } else if (strcmp(argv[i], "-batch") == 0 && i + 1 < argc) {
+            batch_filter = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-transform") == 0 && i + 1 < argc) {
+            transform_filter = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [-frames N] [-kernel NAME] [-batch N] [-transform NAME]\n", argv[0]);
+            return -1;
+        }
+    }
+    if (frames <= 0 || batch_filter > MICROBENCH_MAX_PRIMITIVES ||
+        (batch_filter > 0 && MICROBENCH_MAX_PRIMITIVES % batch_filter != 0)) {
+        fprintf(stderr, "Invalid number of frames or batch size\n");
+        return -1;
+    }
+
+    stm_setup();
+    setup_primitives();
+
+    // initialize Sokol GFX
+    sg_desc sgdesc = {
+        .environment.defaults.color_format = SG_PIXELFORMAT_RGBA8,
+        .environment.defaults.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        .environment.defaults.sample_count = 1,
+        .logger.func = slog_func
+    };
+    sg_setup(&sgdesc);
+    if (!sg_isvalid()) {
+        fprintf(stderr, "Failed to create Sokol GFX context!\n");
+        return -1;
+    }
+
+    // initialize Sokol GP, with space for a frame of unbatched draws
+    sgp_desc sgpdesc = {
+        .max_vertices = MICROBENCH_MAX_PRIMITIVES*6,
+        .max_commands = MICROBENCH_MAX_PRIMITIVES,
+        .max_sprites = MICROBENCH_MAX_PRIMITIVES
+    };
+    sgp_setup(&sgpdesc);
+    if (!sgp_is_valid()) {
+        fprintf(stderr, "Failed to create Sokol GP context: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return -1;
+    }
+
+    sg_image_desc image_desc = {0};
+    image_desc.width = 16;
+    image_desc.height = 16;
+    image_desc.usage = SG_USAGE_DYNAMIC;
+    image = sg_make_image(&image_desc);
+
+    printf("{\n");
+    printf("  \"backend\": \"dummy\",\n");
+    printf("  \"frames\": %d,\n", frames);
+    printf("  \"primitives_per_frame\": %d,\n", MICROBENCH_MAX_PRIMITIVES);
+    printf("  \"results\": [\n");
+    bool first = true;
+    for (size_t k = 0; k < sizeof(kernels)/sizeof(kernels[0]); ++k) {
+        if (kernel_filter && strcmp(kernel_filter, kernels[k].name) != 0) {
+            continue;
+        }
+        for (size_t b = 0; b < sizeof(batch_sizes)/sizeof(batch_sizes[0]); ++b) {
+            if (batch_filter && batch_filter != batch_sizes[b]) {
+                continue;
+            }
+            for (int t = 0; t < (int)(sizeof(transforms)/sizeof(transforms[0])); ++t) {
+                if (transform_filter && strcmp(transform_filter, transforms[t]) != 0) {
+                    continue;
+                }
+                run(&kernels[k], batch_sizes[b], t, frames, first);
+                first = false;
+            }
+        }
+    }
+    printf("\n  ]\n");
+    printf("}\n");
+
+    sg_destroy_image(image);
+    sgp_shutdown();
+    sg_shutdown();
+    return 0;
+}
@@ -0,0 +1,288 @@
+/*
+This sample replays a draw command capture made with `sgp_capture()`,
+it queues the captured commands and flushes them for a number of frames
+without a window or a GPU, printing CPU timings and batching statistics as JSON.
+Use it to reproduce performance problems of real frames offline,
+and to measure batch optimizer changes on them.
+
+Images, samplers and custom pipelines referenced by the capture are recreated
+with the same size and primitive type, custom shaders are replaced by an empty shader.
+When the batch optimizer is disabled with `-depth 0` the captured command queue
+is reproduced exactly, otherwise the captured draws are batched again.
+Rectangles captured as indexed quads are replayed as indexed quads with `-indexed`,
+otherwise they are expanded to triangles. Vertices are uploaded compact with `-compact`.
+
+It must be built with the dummy backend, for example:
+    make headless backend=dummy build=release
+    ./build/sample-bench-headless -frames 1 -capture frame.sgpc
+    ./build/sample-replay frame.sgpc -frames 500
+*/
+
+#define SOKOL_IMPL
+#include "sokol_gfx.h"
+#include "sokol_gp.h"
+#include "sokol_time.h"
+#include "sokol_log.h"
+
+#ifndef SOKOL_DUMMY_BACKEND
+#error "The replay sample must be built with the dummy backend (backend=dummy)"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    REPLAY_WARMUP_FRAMES = 10,
+    REPLAY_DEFAULT_FRAMES = 200,
+    REPLAY_MAX_RESOURCES = 4096
+};
+
+typedef struct replay_resource {
+    sgp_capture_resource_type type;
+    uint32_t captured_id;
+    uint32_t id;
+} replay_resource;
+
+static sg_shader replay_shader;
+static replay_resource replay_resources[REPLAY_MAX_RESOURCES];
+static int replay_num_resources;
+
+static uint32_t replay_resolve(const sgp_capture_resource* resource, void* user_data) {
+    (void)user_data;
+    // resources are created on the first replay and reused on the next ones
+    for (int i = 0; i < replay_num_resources; ++i) {
+        if (replay_resources[i].type == resource->type && replay_resources[i].captured_id == resource->id) {
+            return replay_resources[i].id;
+        }
+    }
+    if (replay_num_resources >= REPLAY_MAX_RESOURCES) {
+        return SG_INVALID_ID;
+    }
+    uint32_t id = SG_INVALID_ID;
+    switch (resource->type) {
+        case SGP_CAPTURE_RESOURCE_IMAGE: {
+            sg_image_desc image_desc = {0};
+            image_desc.width = resource->width > 0 ? resource->width : 1;
+            image_desc.height = resource->height > 0 ? resource->height : 1;
+            image_desc.pixel_format = resource->pixel_format;
+            image_desc.usage = SG_USAGE_DYNAMIC;
+            id = sg_make_image(&image_desc).id;
+            break;
+        }
+        case SGP_CAPTURE_RESOURCE_SAMPLER: {
+            sg_sampler_desc sampler_desc = {0};
+            id = sg_make_sampler(&sampler_desc).id;
+            break;
+        }
+        case SGP_CAPTURE_RESOURCE_PIPELINE: {
+            if (replay_shader.id == SG_INVALID_ID) {
+                sg_shader_desc shader_desc = {0};
+                replay_shader = sg_make_shader(&shader_desc);
+            }
+            sgp_pipeline_desc pip_desc = {0};
+            pip_desc.shader = replay_shader;
+            pip_desc.primitive_type = resource->primitive_type;
+            pip_desc.blend_mode = resource->blend_mode;
+            id = sgp_make_pipeline(&pip_desc).id;
+            break;
+        }
+    }
+    if (id != SG_INVALID_ID) {
+        replay_resource* res = &replay_resources[replay_num_resources++];
+        res->type = resource->type;
+        res->captured_id = resource->id;
+        res->id = id;
+    }
+    return id;
+}
+
+static void replay_destroy_resources(void) {
+    for (int i = 0; i < replay_num_resources; ++i) {
+        uint32_t id = replay_resources[i].id;
+        switch (replay_resources[i].type) {
+            case SGP_CAPTURE_RESOURCE_IMAGE: sg_destroy_image((sg_image){id}); break;
+            case SGP_CAPTURE_RESOURCE_SAMPLER: sg_destroy_sampler((sg_sampler){id}); break;
+            case SGP_CAPTURE_RESOURCE_PIPELINE: sg_destroy_pipeline((sg_pipeline){id}); break;
+        }
+    }
+    replay_num_resources = 0;
+    if (replay_shader.id != SG_INVALID_ID) {
+        sg_destroy_shader(replay_shader);
+    }
+}
+
+static void* load_file(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long len = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    void* data = len > 0 ? malloc((size_t)len) : NULL;
+    if (data && fread(data, 1, (size_t)len, file) != (size_t)len) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    *size = (size_t)len;
+    return data;
+}
+
+int main(int argc, char* argv[]) {
+    const char* path = NULL;
+    int frames = REPLAY_DEFAULT_FRAMES;
+    int depth = -1; // use the default depth unless given
+    int max_move_vertices = 0;
+    bool indexed = false;
+    bool compact = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-frames") == 0 && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-depth") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-move") == 0 && i + 1 < argc) {
+            max_move_vertices = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-indexed") == 0) {
+            indexed = true;
+        } else if (strcmp(argv[i], "-compact") == 0) {
+            compact = true;
+        } else if (!path && argv[i][0] != '-') {
+            path = argv[i];
+        } else {
+            path = NULL;
+            break;
+        }
+    }
+    if (!path || frames <= 0 || depth < -1 || max_move_vertices < 0) {
+        fprintf(stderr, "usage: %s CAPTURE [-frames N] [-depth N] [-move N] [-indexed] [-compact]\n", argv[0]);
+        return -1;
+    }
+
+    size_t size = 0;
+    void* data = load_file(path, &size);
+    sgp_capture_info info;
+    if (!data || !sgp_query_capture_info(data, size, &info)) {
+        fprintf(stderr, "Failed to load capture %s\n", path);
+        return -1;
+    }
+
+    stm_setup();
+
+    // initialize Sokol GFX, validation is disabled because custom shaders are replaced
+    sg_desc sgdesc = {
+        .environment.defaults.color_format = SG_PIXELFORMAT_RGBA8,
+        .environment.defaults.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        .environment.defaults.sample_count = 1,
+        .disable_validation = true,
+        .logger.func = slog_func
+    };
+    sg_setup(&sgdesc);
+    if (!sg_isvalid()) {
+        fprintf(stderr, "Failed to create Sokol GFX context!\n");
+        return -1;
+    }
+
+    // initialize Sokol GP, with enough space for the captured frame,
+    // indexed quads take 6 vertices instead of 4 when expanded to triangles
+    uint32_t max_vertices = info.num_vertices + info.num_vertices / 2;
+    sgp_desc sgpdesc = {
+        .max_vertices = max_vertices > 65536 ? max_vertices : 0,
+        .max_commands = info.num_commands > 16384 ? info.num_commands : 0,
+        .max_sprites = info.num_sprites > 16384 ? info.num_sprites : 0,
+        .batch_optimizer_depth = depth > 0 ? (uint32_t)depth : 0,
+        .batch_optimizer_max_move_vertices = (uint32_t)max_move_vertices,
+        .indexed_quads = indexed,
+        .compact_vertices = compact
+    };
+    sgp_setup(&sgpdesc);
+    if (!sgp_is_valid()) {
+        fprintf(stderr, "Failed to create Sokol GP context: %s\n", sgp_get_error_message(sgp_get_last_error()));
+        return -1;
+    }
+
+    // -depth 0 disables the batch optimizer for an exact replay
+    sgp_replay_desc replay_desc = {.resolve = replay_resolve};
+    uint64_t replay_ticks = 0;
+    uint64_t flush_ticks = 0;
+    for (int i = 0; i < REPLAY_WARMUP_FRAMES + frames; ++i) {
+        uint64_t start = stm_now();
+        sgp_begin(info.frame_size.w, info.frame_size.h);
+        if (depth == 0) {
+            sgp_set_batch_optimizer(0, 0);
+        }
+        if (!sgp_replay(data, size, &replay_desc)) {
+            fprintf(stderr, "Failed to replay capture: %s\n", sgp_get_error_message(sgp_get_last_error()));
+            return -1;
+        }
+        uint64_t replayed = stm_now();
+
+        sg_pass pass = {0};
+        pass.swapchain.width = info.frame_size.w;
+        pass.swapchain.height = info.frame_size.h;
+        pass.swapchain.sample_count = 1;
+        pass.swapchain.color_format = SG_PIXELFORMAT_RGBA8;
+        pass.swapchain.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+        sg_begin_pass(&pass);
+        uint64_t flush_start = stm_now();
+        sgp_flush();
+        uint64_t flushed = stm_now();
+        sgp_end();
+        sg_end_pass();
+        sg_commit();
+
+        if (sgp_get_last_error() != SGP_NO_ERROR) {
+            fprintf(stderr, "Sokol GP error: %s\n", sgp_get_error_message(sgp_get_last_error()));
+            return -1;
+        }
+        if (i >= REPLAY_WARMUP_FRAMES) {
+            replay_ticks += stm_diff(replayed, start);
+            flush_ticks += stm_diff(flushed, flush_start);
+        }
+    }
+
+    sgp_stats stats = sgp_query_stats();
+    sgp_desc desc = sgp_query_desc();
+    double flush_ns = stm_ns(flush_ticks);
+    printf("{\n");
+    printf("  \"backend\": \"dummy\",\n");
+    printf("  \"capture\": \"%s\",\n", path);
+    printf("  \"frames\": %d,\n", frames);
+    printf("  \"frame_width\": %d,\n", info.frame_size.w);
+    printf("  \"frame_height\": %d,\n", info.frame_size.h);
+    printf("  \"batch_optimizer_depth\": %u,\n", depth == 0 ? 0 : desc.batch_optimizer_depth);
+    printf("  \"batch_optimizer_max_move_vertices\": %u,\n", desc.batch_optimizer_max_move_vertices);
+    printf("  \"indexed_quads\": %s,\n", desc.indexed_quads ? "true" : "false");
+    printf("  \"compact_vertices\": %s,\n", desc.compact_vertices ? "true" : "false");
+    printf("  \"captured_resources\": %u,\n", info.num_resources);
+    printf("  \"captured_commands\": %u,\n", info.num_commands);
+    printf("  \"captured_vertices\": %u,\n", info.num_vertices);
+    printf("  \"captured_uniforms\": %u,\n", info.num_uniforms);
+    printf("  \"captured_sprites\": %u,\n", info.num_sprites);
+    printf("  \"commands_before_batching\": %u,\n", stats.num_queued_draws);
+    printf("  \"culled_draws\": %u,\n", stats.num_culled_draws);
+    printf("  \"commands_after_batching\": %u,\n", stats.num_draw_calls);
+    printf("  \"merged_prev\": %u,\n", stats.num_merged_prev);
+    printf("  \"merged_next\": %u,\n", stats.num_merged_next);
+    printf("  \"pipeline_applies\": %u,\n", stats.num_pipeline_applies);
+    printf("  \"bindings_applies\": %u,\n", stats.num_bindings_applies);
+    printf("  \"bindings_by_pipeline\": %u,\n", stats.num_bindings_by_pipeline);
+    printf("  \"bindings_by_textures\": %u,\n", stats.num_bindings_by_textures);
+    printf("  \"uniforms_applies\": %u,\n", stats.num_uniforms_applies);
+    printf("  \"viewport_applies\": %u,\n", stats.num_viewport_applies);
+    printf("  \"scissor_applies\": %u,\n", stats.num_scissor_applies);
+    printf("  \"uploaded_vertices\": %u,\n", stats.num_uploaded_vertices);
+    printf("  \"uploaded_compact_vertices\": %u,\n", stats.num_compact_vertices);
+    printf("  \"uploaded_sprites\": %u,\n", stats.num_uploaded_sprites);
+    printf("  \"flush_ns_per_command\": %.2f,\n", stats.num_draw_calls > 0 ? flush_ns / ((double)stats.num_draw_calls * frames) : 0.0);
+    printf("  \"replay_ms_per_frame\": %.4f,\n", stm_ms(replay_ticks) / frames);
+    printf("  \"flush_ms_per_frame\": %.4f\n", stm_ms(flush_ticks) / frames);
+    printf("}\n");
+
+    replay_destroy_resources();
+    sgp_shutdown();
+    sg_shutdown();
+    free(data);
+    return 0;
+}
@@ -1,4 +1,4 @@
-/* This is the shader used by the default SGP pipeline */
+/* These are the shaders used by the default SGP pipelines */
 @module sgp
 
 @vs vs
@@ -14,6 +14,67 @@ void main() {
 }
 @end
 
+/* Expands instanced sprites, each instance is a sgp_sprite and every quad is a 4 vertices triangle strip */
+@vs vs_sprite
+layout(binding=0) uniform sprite_params {
+    vec4 mvp_x; // first row of the transform matrix, texture width inverse in w
+    vec4 mvp_y; // second row of the transform matrix, texture height inverse in w
+};
+layout(location=0) in vec4 dst_rect;
+layout(location=1) in vec4 src_rect;
+layout(location=2) in vec4 color;
+layout(location=3) in float rotation;
+layout(location=0) out vec2 texUV;
+layout(location=1) out vec4 iColor;
+void main() {
+    vec2 corner = vec2(float(gl_VertexIndex & 1), float(gl_VertexIndex >> 1));
+    vec2 half_size = dst_rect.zw * 0.5;
+    vec2 p = corner * dst_rect.zw - half_size;
+    float s = sin(rotation);
+    float c = cos(rotation);
+    vec3 pos = vec3(p.x*c - p.y*s + dst_rect.x + half_size.x, p.x*s + p.y*c + dst_rect.y + half_size.y, 1.0);
+    gl_Position = vec4(dot(mvp_x.xyz, pos), dot(mvp_y.xyz, pos), 0.0, 1.0);
+    texUV = (src_rect.xy + corner * src_rect.zw) * vec2(mvp_x.w, mvp_y.w);
+    iColor = color;
+}
+@end
+
+/* Transforms the vertices with a matrix in a vertex uniform, used by static batches */
+@vs vs_transform
+layout(binding=0) uniform transform_params {
+    vec4 mvp_x; // first row of the transform matrix
+    vec4 mvp_y; // second row of the transform matrix
+};
+layout(location=0) in vec4 coord;
+layout(location=1) in vec4 color;
+layout(location=0) out vec2 texUV;
+layout(location=1) out vec4 iColor;
+void main() {
+    vec3 pos = vec3(coord.xy, 1.0);
+    gl_Position = vec4(dot(mvp_x.xyz, pos), dot(mvp_y.xyz, pos), 0.0, 1.0);
+    gl_PointSize = 1.0;
+    texUV = coord.zw;
+    iColor = color;
+}
+@end
+
+/* Forwards the texture slot of each vertex, used by multi texture batches */
+@vs vs_multi_texture
+layout(location=0) in vec4 coord;
+layout(location=1) in vec4 color;
+layout(location=2) in float slot;
+layout(location=0) out vec2 texUV;
+layout(location=1) out vec4 iColor;
+layout(location=2) out float texSlot;
+void main() {
+    gl_Position = vec4(coord.xy, 0.0, 1.0);
+    gl_PointSize = 1.0;
+    texUV = coord.zw;
+    iColor = color;
+    texSlot = slot;
+}
+@end
+
 @fs fs
 layout(binding=0) uniform texture2D iTexChannel0;
 layout(binding=0) uniform sampler iSmpChannel0;
@@ -25,4 +86,30 @@ void main() {
 }
 @end
 
+/* Samples all texture slots and keeps the one of the vertex, so sampling stays in uniform control flow */
+@fs fs_multi_texture
+layout(binding=0) uniform texture2D iTexChannel0;
+layout(binding=1) uniform texture2D iTexChannel1;
+layout(binding=2) uniform texture2D iTexChannel2;
+layout(binding=3) uniform texture2D iTexChannel3;
+layout(binding=0) uniform sampler iSmpChannel0;
+layout(binding=1) uniform sampler iSmpChannel1;
+layout(binding=2) uniform sampler iSmpChannel2;
+layout(binding=3) uniform sampler iSmpChannel3;
+layout(location=0) in vec2 texUV;
+layout(location=1) in vec4 iColor;
+layout(location=2) in float texSlot;
+layout(location=0) out vec4 fragColor;
+void main() {
+    vec4 c0 = texture(sampler2D(iTexChannel0, iSmpChannel0), texUV);
+    vec4 c1 = texture(sampler2D(iTexChannel1, iSmpChannel1), texUV);
+    vec4 c2 = texture(sampler2D(iTexChannel2, iSmpChannel2), texUV);
+    vec4 c3 = texture(sampler2D(iTexChannel3, iSmpChannel3), texUV);
+    fragColor = (texSlot < 0.5 ? c0 : (texSlot < 1.5 ? c1 : (texSlot < 2.5 ? c2 : c3))) * iColor;
+}
+@end
+
 @program program vs fs
+@program sprite_program vs_sprite fs
+@program transform_program vs_transform fs
+@program multi_texture_program vs_multi_texture fs_multi_texture
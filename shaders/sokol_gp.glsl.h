@@ -16,15 +16,69 @@
         Attributes:
             ATTR_program_coord => 0
             ATTR_program_color => 1
+    Shader program: 'sprite_program':
+        Get shader desc: sgp_sprite_program_shader_desc(sg_query_backend());
+        Vertex Shader: vs_sprite
+        Fragment Shader: fs
+        Attributes:
+            ATTR_sprite_program_dst_rect => 0
+            ATTR_sprite_program_src_rect => 1
+            ATTR_sprite_program_color => 2
+            ATTR_sprite_program_rotation => 3
+    Shader program: 'transform_program':
+        Get shader desc: sgp_transform_program_shader_desc(sg_query_backend());
+        Vertex Shader: vs_transform
+        Fragment Shader: fs
+        Attributes:
+            ATTR_transform_program_coord => 0
+            ATTR_transform_program_color => 1
+    Shader program: 'multi_texture_program':
+        Get shader desc: sgp_multi_texture_program_shader_desc(sg_query_backend());
+        Vertex Shader: vs_multi_texture
+        Fragment Shader: fs_multi_texture
+        Attributes:
+            ATTR_multi_texture_program_coord => 0
+            ATTR_multi_texture_program_color => 1
+            ATTR_multi_texture_program_slot => 2
     Bindings:
+        Uniform block 'sprite_params':
+            C struct: sprite_params_t
+            Bind slot: UB_sprite_params => 0
+        Uniform block 'transform_params':
+            C struct: transform_params_t
+            Bind slot: UB_transform_params => 0
         Image 'iTexChannel0':
             Image type: SG_IMAGETYPE_2D
             Sample type: SG_IMAGESAMPLETYPE_FLOAT
             Multisampled: false
             Bind slot: IMG_iTexChannel0 => 0
+        Image 'iTexChannel1':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_iTexChannel1 => 1
+        Image 'iTexChannel2':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_iTexChannel2 => 2
+        Image 'iTexChannel3':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_iTexChannel3 => 3
         Sampler 'iSmpChannel0':
             Type: SG_SAMPLERTYPE_FILTERING
             Bind slot: SMP_iSmpChannel0 => 0
+        Sampler 'iSmpChannel1':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_iSmpChannel1 => 1
+        Sampler 'iSmpChannel2':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_iSmpChannel2 => 2
+        Sampler 'iSmpChannel3':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_iSmpChannel3 => 3
 */
 #if !defined(SOKOL_GFX_INCLUDED)
 #error "Please include sokol_gfx.h before sokol_gp.glsl.h"
@@ -39,8 +93,38 @@
 const sg_shader_desc* sgp_program_shader_desc(sg_backend backend);
 #define ATTR_program_coord (0)
 #define ATTR_program_color (1)
+const sg_shader_desc* sgp_sprite_program_shader_desc(sg_backend backend);
+#define ATTR_sprite_program_dst_rect (0)
+#define ATTR_sprite_program_src_rect (1)
+#define ATTR_sprite_program_color (2)
+#define ATTR_sprite_program_rotation (3)
+const sg_shader_desc* sgp_transform_program_shader_desc(sg_backend backend);
+#define ATTR_transform_program_coord (0)
+#define ATTR_transform_program_color (1)
+const sg_shader_desc* sgp_multi_texture_program_shader_desc(sg_backend backend);
+#define ATTR_multi_texture_program_coord (0)
+#define ATTR_multi_texture_program_color (1)
+#define ATTR_multi_texture_program_slot (2)
 #define IMG_iTexChannel0 (0)
+#define IMG_iTexChannel1 (1)
+#define IMG_iTexChannel2 (2)
+#define IMG_iTexChannel3 (3)
 #define SMP_iSmpChannel0 (0)
+#define SMP_iSmpChannel1 (1)
+#define SMP_iSmpChannel2 (2)
+#define SMP_iSmpChannel3 (3)
+#define UB_sprite_params (0)
+#define UB_transform_params (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct sprite_params_t {
+    float mvp_x[4];
+    float mvp_y[4];
+} sprite_params_t;
+SOKOL_SHDC_ALIGN(16) typedef struct transform_params_t {
+    float mvp_x[4];
+    float mvp_y[4];
+} transform_params_t;
+#pragma pack(pop)
 #if defined(SOKOL_SHDC_IMPL)
 /*
     #version 410
@@ -784,159 +868,3179 @@ static const uint8_t sgp_fs_source_wgsl[682] = {
     0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x66,0x72,0x61,0x67,0x43,0x6f,
     0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
-const sg_shader_desc* sgp_program_shader_desc(sg_backend backend) {
-    if (backend == SG_BACKEND_GLCORE) {
-        static sg_shader_desc desc;
-        static bool valid;
-        if (!valid) {
-            valid = true;
-            desc.vertex_func.source = (const char*)sgp_vs_source_glsl410;
-            desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)sgp_fs_source_glsl410;
-            desc.fragment_func.entry = "main";
-            desc.attrs[0].glsl_name = "coord";
-            desc.attrs[1].glsl_name = "color";
-            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.images[0].image_type = SG_IMAGETYPE_2D;
-            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
-            desc.images[0].multisampled = false;
-            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
-            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.image_sampler_pairs[0].image_slot = 0;
-            desc.image_sampler_pairs[0].sampler_slot = 0;
-            desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
-            desc.label = "sgp_program_shader";
-        }
-        return &desc;
+/*
+    #version 410
+
+    uniform vec4 sprite_params[2];
+    layout(location = 0) in vec4 dst_rect;
+    layout(location = 3) in float rotation;
+    layout(location = 1) in vec4 src_rect;
+    layout(location = 0) out vec2 texUV;
+    layout(location = 1) out vec4 iColor;
+    layout(location = 2) in vec4 color;
+
+    void main()
+    {
+        vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+        vec2 half_size = dst_rect.zw * 0.5;
+        vec2 p = (corner * dst_rect.zw) - half_size;
+        float s = sin(rotation);
+        float c = cos(rotation);
+        vec3 pos = vec3(((p.x * c) - (p.y * s)) + (dst_rect.x + half_size.x), ((p.x * s) + (p.y * c)) + (dst_rect.y + half_size.y), 1.0);
+        gl_Position = vec4(dot(sprite_params[0].xyz, pos), dot(sprite_params[1].xyz, pos), 0.0, 1.0);
+        texUV = (src_rect.xy + (corner * src_rect.zw)) * vec2(sprite_params[0].w, sprite_params[1].w);
+        iColor = color;
     }
-    if (backend == SG_BACKEND_GLES3) {
-        static sg_shader_desc desc;
-        static bool valid;
-        if (!valid) {
-            valid = true;
-            desc.vertex_func.source = (const char*)sgp_vs_source_glsl300es;
-            desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)sgp_fs_source_glsl300es;
-            desc.fragment_func.entry = "main";
-            desc.attrs[0].glsl_name = "coord";
-            desc.attrs[1].glsl_name = "color";
-            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.images[0].image_type = SG_IMAGETYPE_2D;
-            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
-            desc.images[0].multisampled = false;
-            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
-            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.image_sampler_pairs[0].image_slot = 0;
-            desc.image_sampler_pairs[0].sampler_slot = 0;
-            desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
-            desc.label = "sgp_program_shader";
-        }
-        return &desc;
+
+*/
+static const uint8_t sgp_vs_sprite_source_glsl410[864] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x70,0x72,0x69,0x74,
+    0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,
+    0x63,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,
+    0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,
+    0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x26,0x20,0x31,0x29,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,
+    0x44,0x20,0x3e,0x3e,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x64,
+    0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x28,
+    0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,
+    0x74,0x2e,0x7a,0x77,0x29,0x20,0x2d,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,0x3d,
+    0x20,0x73,0x69,0x6e,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x20,0x3d,0x20,0x63,0x6f,
+    0x73,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x63,0x29,0x20,0x2d,0x20,0x28,0x70,
+    0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,0x29,0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,
+    0x72,0x65,0x63,0x74,0x2e,0x78,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,
+    0x7a,0x65,0x2e,0x78,0x29,0x2c,0x20,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x73,
+    0x29,0x20,0x2b,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x63,0x29,0x29,0x20,0x2b,
+    0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x79,0x20,0x2b,0x20,0x68,
+    0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x79,0x29,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,0x28,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,
+    0x20,0x28,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,
+    0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,
+    0x63,0x74,0x2e,0x7a,0x77,0x29,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x28,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,
+    0x77,0x2c,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x5d,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 sprite_params[2];
+    layout(location = 0) in vec4 dst_rect;
+    layout(location = 3) in float rotation;
+    layout(location = 1) in vec4 src_rect;
+    out vec2 texUV;
+    out vec4 iColor;
+    layout(location = 2) in vec4 color;
+
+    void main()
+    {
+        vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+        vec2 half_size = dst_rect.zw * 0.5;
+        vec2 p = (corner * dst_rect.zw) - half_size;
+        float s = sin(rotation);
+        float c = cos(rotation);
+        vec3 pos = vec3(((p.x * c) - (p.y * s)) + (dst_rect.x + half_size.x), ((p.x * s) + (p.y * c)) + (dst_rect.y + half_size.y), 1.0);
+        gl_Position = vec4(dot(sprite_params[0].xyz, pos), dot(sprite_params[1].xyz, pos), 0.0, 1.0);
+        texUV = (src_rect.xy + (corner * src_rect.zw)) * vec2(sprite_params[0].w, sprite_params[1].w);
+        iColor = color;
     }
-    if (backend == SG_BACKEND_D3D11) {
-        static sg_shader_desc desc;
-        static bool valid;
-        if (!valid) {
-            valid = true;
-            desc.vertex_func.source = (const char*)sgp_vs_source_hlsl4;
-            desc.vertex_func.d3d11_target = "vs_4_0";
-            desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)sgp_fs_source_hlsl4;
-            desc.fragment_func.d3d11_target = "ps_4_0";
-            desc.fragment_func.entry = "main";
-            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
-            desc.attrs[0].hlsl_sem_index = 0;
-            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
-            desc.attrs[1].hlsl_sem_index = 1;
-            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.images[0].image_type = SG_IMAGETYPE_2D;
-            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
-            desc.images[0].multisampled = false;
-            desc.images[0].hlsl_register_t_n = 0;
-            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
-            desc.samplers[0].hlsl_register_s_n = 0;
-            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.image_sampler_pairs[0].image_slot = 0;
-            desc.image_sampler_pairs[0].sampler_slot = 0;
-            desc.label = "sgp_program_shader";
-        }
-        return &desc;
+
+*/
+static const uint8_t sgp_vs_sprite_source_glsl300es[825] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x64,0x73,0x74,
+    0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x72,0x63,0x5f,
+    0x72,0x65,0x63,0x74,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x74,
+    0x65,0x78,0x55,0x56,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x69,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,
+    0x49,0x44,0x20,0x26,0x20,0x31,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,
+    0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x3e,0x3e,0x20,0x31,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x61,0x6c,0x66,
+    0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,
+    0x2e,0x7a,0x77,0x20,0x2a,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,
+    0x2a,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x20,0x2d,
+    0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x72,0x6f,
+    0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x63,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x72,0x6f,0x74,0x61,0x74,
+    0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x28,0x28,0x70,0x2e,0x78,0x20,
+    0x2a,0x20,0x63,0x29,0x20,0x2d,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,
+    0x29,0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x20,
+    0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x2c,0x20,
+    0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x70,0x2e,
+    0x79,0x20,0x2a,0x20,0x63,0x29,0x29,0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,0x72,
+    0x65,0x63,0x74,0x2e,0x79,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,
+    0x65,0x2e,0x79,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x64,0x6f,0x74,0x28,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,
+    0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x28,0x73,0x72,0x63,0x5f,0x72,
+    0x65,0x63,0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x20,0x2a,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x29,
+    0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x28,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x2c,0x20,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x77,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    cbuffer sprite_params : register(b0)
+    {
+        float4 _19_mvp_x : packoffset(c0);
+        float4 _19_mvp_y : packoffset(c1);
+    };
+
+
+    static float4 gl_Position;
+    static int gl_VertexIndex;
+    static float4 dst_rect;
+    static float rotation;
+    static float4 src_rect;
+    static float2 texUV;
+    static float4 iColor;
+    static float4 color;
+
+    struct SPIRV_Cross_Input
+    {
+        float4 dst_rect : TEXCOORD0;
+        float4 src_rect : TEXCOORD1;
+        float4 color : TEXCOORD2;
+        float rotation : TEXCOORD3;
+        uint gl_VertexIndex : SV_VertexID;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float2 texUV : TEXCOORD0;
+        float4 iColor : TEXCOORD1;
+        float4 gl_Position : SV_Position;
+    };
+
+    void vert_main()
+    {
+        float2 corner = float2(float(gl_VertexIndex & 1), float(gl_VertexIndex >> 1));
+        float2 half_size = dst_rect.zw * 0.5f;
+        float2 p = (corner * dst_rect.zw) - half_size;
+        float s = sin(rotation);
+        float c = cos(rotation);
+        float3 pos = float3(((p.x * c) - (p.y * s)) + (dst_rect.x + half_size.x), ((p.x * s) + (p.y * c)) + (dst_rect.y + half_size.y), 1.0f);
+        gl_Position = float4(dot(_19_mvp_x.xyz, pos), dot(_19_mvp_y.xyz, pos), 0.0f, 1.0f);
+        texUV = (src_rect.xy + (corner * src_rect.zw)) * float2(_19_mvp_x.w, _19_mvp_y.w);
+        iColor = color;
     }
-    if (backend == SG_BACKEND_METAL_MACOS) {
-        static sg_shader_desc desc;
-        static bool valid;
-        if (!valid) {
-            valid = true;
-            desc.vertex_func.source = (const char*)sgp_vs_source_metal_macos;
-            desc.vertex_func.entry = "main0";
-            desc.fragment_func.source = (const char*)sgp_fs_source_metal_macos;
-            desc.fragment_func.entry = "main0";
-            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.images[0].image_type = SG_IMAGETYPE_2D;
-            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
-            desc.images[0].multisampled = false;
-            desc.images[0].msl_texture_n = 0;
-            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
-            desc.samplers[0].msl_sampler_n = 0;
-            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.image_sampler_pairs[0].image_slot = 0;
-            desc.image_sampler_pairs[0].sampler_slot = 0;
-            desc.label = "sgp_program_shader";
-        }
-        return &desc;
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        gl_VertexIndex = int(stage_input.gl_VertexIndex);
+        dst_rect = stage_input.dst_rect;
+        rotation = stage_input.rotation;
+        src_rect = stage_input.src_rect;
+        color = stage_input.color;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.texUV = texUV;
+        stage_output.iColor = iColor;
+        return stage_output;
     }
-    if (backend == SG_BACKEND_METAL_IOS) {
-        static sg_shader_desc desc;
-        static bool valid;
-        if (!valid) {
-            valid = true;
-            desc.vertex_func.source = (const char*)sgp_vs_source_metal_ios;
-            desc.vertex_func.entry = "main0";
-            desc.fragment_func.source = (const char*)sgp_fs_source_metal_ios;
-            desc.fragment_func.entry = "main0";
-            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.images[0].image_type = SG_IMAGETYPE_2D;
-            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
-            desc.images[0].multisampled = false;
-            desc.images[0].msl_texture_n = 0;
-            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
-            desc.samplers[0].msl_sampler_n = 0;
-            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.image_sampler_pairs[0].image_slot = 0;
-            desc.image_sampler_pairs[0].sampler_slot = 0;
-            desc.label = "sgp_program_shader";
-        }
-        return &desc;
+*/
+static const uint8_t sgp_vs_sprite_source_hlsl4[1677] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x5f,0x78,0x20,0x3a,0x20,0x70,0x61,
+    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,
+    0x5f,0x79,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x64,0x73,
+    0x74,0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x72,0x63,
+    0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x64,0x73,
+    0x74,0x5f,0x72,0x65,0x63,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,
+    0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,
+    0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x53,0x56,0x5f,
+    0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,
+    0x64,0x65,0x78,0x20,0x26,0x20,0x31,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3e,
+    0x3e,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x64,0x73,
+    0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x20,0x3d,
+    0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x64,0x73,0x74,0x5f,0x72,
+    0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x20,0x2d,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,
+    0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,
+    0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x20,0x3d,0x20,
+    0x63,0x6f,0x73,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x63,
+    0x29,0x20,0x2d,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,0x29,0x20,0x2b,
+    0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x20,0x2b,0x20,0x68,
+    0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x2c,0x20,0x28,0x28,0x70,
+    0x2e,0x78,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,
+    0x20,0x63,0x29,0x29,0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,
+    0x2e,0x79,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x79,
+    0x29,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x5f,0x78,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,
+    0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,
+    0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x28,0x73,
+    0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x63,0x6f,
+    0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,
+    0x7a,0x77,0x29,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x31,
+    0x39,0x5f,0x6d,0x76,0x70,0x5f,0x78,0x2e,0x77,0x2c,0x20,0x5f,0x31,0x39,0x5f,0x6d,
+    0x76,0x70,0x5f,0x79,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+    0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x28,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,
+    0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x20,0x3d,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,
+    0x63,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x72,0x63,
+    0x5f,0x72,0x65,0x63,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct sprite_params
+    {
+        float4 mvp_x;
+        float4 mvp_y;
+    };
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float4 gl_Position [[position]];
+    };
+
+    struct main0_in
+    {
+        float4 dst_rect [[attribute(0)]];
+        float4 src_rect [[attribute(1)]];
+        float4 color [[attribute(2)]];
+        float rotation [[attribute(3)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant sprite_params& _19 [[buffer(0)]], uint gl_VertexIndex [[vertex_id]])
+    {
+        main0_out out = {};
+        float2 corner = float2(float(int(gl_VertexIndex) & 1), float(int(gl_VertexIndex) >> 1));
+        float2 half_size = in.dst_rect.zw * 0.5;
+        float2 p = (corner * in.dst_rect.zw) - half_size;
+        float s = sin(in.rotation);
+        float c = cos(in.rotation);
+        float3 pos = float3(((p.x * c) - (p.y * s)) + (in.dst_rect.x + half_size.x), ((p.x * s) + (p.y * c)) + (in.dst_rect.y + half_size.y), 1.0);
+        out.gl_Position = float4(dot(_19.mvp_x.xyz, pos), dot(_19.mvp_y.xyz, pos), 0.0, 1.0);
+        out.texUV = (in.src_rect.xy + (corner * in.src_rect.zw)) * float2(_19.mvp_x.w, _19.mvp_y.w);
+        out.iColor = in.color;
+        return out;
     }
-    if (backend == SG_BACKEND_WGPU) {
-        static sg_shader_desc desc;
-        static bool valid;
-        if (!valid) {
-            valid = true;
-            desc.vertex_func.source = (const char*)sgp_vs_source_wgsl;
-            desc.vertex_func.entry = "main";
-            desc.fragment_func.source = (const char*)sgp_fs_source_wgsl;
-            desc.fragment_func.entry = "main";
-            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.images[0].image_type = SG_IMAGETYPE_2D;
-            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
-            desc.images[0].multisampled = false;
-            desc.images[0].wgsl_group1_binding_n = 64;
-            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
-            desc.samplers[0].wgsl_group1_binding_n = 80;
-            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.image_sampler_pairs[0].image_slot = 0;
-            desc.image_sampler_pairs[0].sampler_slot = 0;
-            desc.label = "sgp_program_shader";
+
+*/
+static const uint8_t sgp_vs_sprite_source_metal_macos[1221] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,0x5f,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,0x5f,
+    0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x72,0x63,0x5f,0x72,
+    0x65,0x63,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,
+    0x78,0x20,0x5b,0x5b,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,0x6e,0x74,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,
+    0x26,0x20,0x31,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,0x6e,0x74,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,
+    0x3e,0x3e,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x20,0x2a,0x20,
+    0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x20,0x3d,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x69,0x6e,
+    0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x20,0x2d,0x20,
+    0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x69,0x6e,0x2e,
+    0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x63,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x69,0x6e,0x2e,
+    0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x63,0x29,0x20,0x2d,0x20,
+    0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,
+    0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x20,0x2b,0x20,0x68,0x61,
+    0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x2c,0x20,0x28,0x28,0x70,0x2e,
+    0x78,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,
+    0x63,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,
+    0x63,0x74,0x2e,0x79,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,
+    0x2e,0x79,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,
+    0x6d,0x76,0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,
+    0x55,0x56,0x20,0x3d,0x20,0x28,0x69,0x6e,0x2e,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,
+    0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,
+    0x20,0x69,0x6e,0x2e,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,
+    0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x31,0x39,0x2e,0x6d,
+    0x76,0x70,0x5f,0x78,0x2e,0x77,0x2c,0x20,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,
+    0x79,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct sprite_params
+    {
+        float4 mvp_x;
+        float4 mvp_y;
+    };
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float4 gl_Position [[position]];
+    };
+
+    struct main0_in
+    {
+        float4 dst_rect [[attribute(0)]];
+        float4 src_rect [[attribute(1)]];
+        float4 color [[attribute(2)]];
+        float rotation [[attribute(3)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant sprite_params& _19 [[buffer(0)]], uint gl_VertexIndex [[vertex_id]])
+    {
+        main0_out out = {};
+        float2 corner = float2(float(int(gl_VertexIndex) & 1), float(int(gl_VertexIndex) >> 1));
+        float2 half_size = in.dst_rect.zw * 0.5;
+        float2 p = (corner * in.dst_rect.zw) - half_size;
+        float s = sin(in.rotation);
+        float c = cos(in.rotation);
+        float3 pos = float3(((p.x * c) - (p.y * s)) + (in.dst_rect.x + half_size.x), ((p.x * s) + (p.y * c)) + (in.dst_rect.y + half_size.y), 1.0);
+        out.gl_Position = float4(dot(_19.mvp_x.xyz, pos), dot(_19.mvp_y.xyz, pos), 0.0, 1.0);
+        out.texUV = (in.src_rect.xy + (corner * in.src_rect.zw)) * float2(_19.mvp_x.w, _19.mvp_y.w);
+        out.iColor = in.color;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_sprite_source_metal_ios[1221] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,0x5f,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,0x5f,
+    0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x72,0x63,0x5f,0x72,
+    0x65,0x63,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,
+    0x78,0x20,0x5b,0x5b,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,0x6e,0x74,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,
+    0x26,0x20,0x31,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,0x6e,0x74,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,
+    0x3e,0x3e,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x20,0x2a,0x20,
+    0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x20,0x3d,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x69,0x6e,
+    0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x20,0x2d,0x20,
+    0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x69,0x6e,0x2e,
+    0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x63,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x69,0x6e,0x2e,
+    0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x63,0x29,0x20,0x2d,0x20,
+    0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,
+    0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x20,0x2b,0x20,0x68,0x61,
+    0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x2c,0x20,0x28,0x28,0x70,0x2e,
+    0x78,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,
+    0x63,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,
+    0x63,0x74,0x2e,0x79,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,
+    0x2e,0x79,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,
+    0x6d,0x76,0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,
+    0x55,0x56,0x20,0x3d,0x20,0x28,0x69,0x6e,0x2e,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,
+    0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,
+    0x20,0x69,0x6e,0x2e,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,
+    0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x31,0x39,0x2e,0x6d,
+    0x76,0x70,0x5f,0x78,0x2e,0x77,0x2c,0x20,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,
+    0x79,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct sprite_params {
+      /_ @offset(0) _/
+      mvp_x : vec4f,
+      /_ @offset(16) _/
+      mvp_y : vec4f,
+    }
+
+    var<private> gl_VertexIndex : i32;
+
+    var<private> dst_rect : vec4f;
+
+    var<private> rotation : f32;
+
+    var<private> src_rect : vec4f;
+
+    @group(0) @binding(0) var<uniform> x_19 : sprite_params;
+
+    var<private> gl_Position : vec4f;
+
+    var<private> texUV : vec2f;
+
+    var<private> iColor : vec4f;
+
+    var<private> color : vec4f;
+
+    fn main_1() {
+      let corner : vec2f = vec2f(f32((gl_VertexIndex & 1i)), f32((gl_VertexIndex >> 1u)));
+      let half_size : vec2f = (dst_rect.zw * 0.5f);
+      let p : vec2f = ((corner * dst_rect.zw) - half_size);
+      let s : f32 = sin(rotation);
+      let c : f32 = cos(rotation);
+      let pos : vec3f = vec3f((((p.x * c) - (p.y * s)) + (dst_rect.x + half_size.x)), (((p.x * s) + (p.y * c)) + (dst_rect.y + half_size.y)), 1.0f);
+      gl_Position = vec4f(dot(x_19.mvp_x.xyz, pos), dot(x_19.mvp_y.xyz, pos), 0.0f, 1.0f);
+      texUV = ((src_rect.xy + (corner * src_rect.zw)) * vec2f(x_19.mvp_x.w, x_19.mvp_y.w));
+      iColor = color;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      texUV_1 : vec2f,
+      @location(1)
+      iColor_1 : vec4f,
+    }
+
+    @vertex
+    fn main(@builtin(vertex_index) gl_VertexIndex_param : u32, @location(0) dst_rect_param : vec4f, @location(3) rotation_param : f32, @location(1) src_rect_param : vec4f, @location(2) color_param : vec4f) -> main_out {
+      gl_VertexIndex = bitcast<i32>(gl_VertexIndex_param);
+      dst_rect = dst_rect_param;
+      rotation = rotation_param;
+      src_rect = src_rect_param;
+      color = color_param;
+      main_1();
+      return main_out(gl_Position, texUV, iColor);
+    }
+
+*/
+static const uint8_t sgp_vs_sprite_source_wgsl[1655] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,
+    0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,
+    0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x76,0x70,0x5f,0x78,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x76,0x70,0x5f,0x79,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,
+    0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x69,0x33,0x32,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x64,0x73,0x74,
+    0x5f,0x72,0x65,0x63,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x72,0x6f,0x74,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x73,0x72,0x63,0x5f,0x72,
+    0x65,0x63,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x67,
+    0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
+    0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,
+    0x20,0x78,0x5f,0x31,0x39,0x20,0x3a,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,
+    0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x66,0x28,0x66,0x33,
+    0x32,0x28,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,
+    0x78,0x20,0x26,0x20,0x31,0x69,0x29,0x29,0x2c,0x20,0x66,0x33,0x32,0x28,0x28,0x67,
+    0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3e,0x3e,
+    0x20,0x31,0x75,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x68,0x61,
+    0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,
+    0x3d,0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x20,0x2a,
+    0x20,0x30,0x2e,0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x70,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x28,0x28,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x20,0x2a,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,
+    0x29,0x20,0x2d,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x73,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,
+    0x73,0x69,0x6e,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x63,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x63,
+    0x6f,0x73,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,
+    0x20,0x63,0x29,0x20,0x2d,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,0x29,
+    0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x20,0x2b,
+    0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x29,0x2c,0x20,
+    0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x70,
+    0x2e,0x79,0x20,0x2a,0x20,0x63,0x29,0x29,0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,
+    0x72,0x65,0x63,0x74,0x2e,0x79,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,
+    0x7a,0x65,0x2e,0x79,0x29,0x29,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x28,0x64,0x6f,0x74,0x28,0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,
+    0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,
+    0x6f,0x74,0x28,0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,0x79,
+    0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,
+    0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,
+    0x28,0x28,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,
+    0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,
+    0x63,0x74,0x2e,0x7a,0x77,0x29,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x66,0x28,
+    0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x78,0x2e,0x77,0x2c,0x20,0x78,0x5f,
+    0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x77,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,
+    0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,
+    0x56,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,
+    0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x76,0x65,0x72,0x74,
+    0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x29,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,
+    0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,
+    0x20,0x75,0x33,0x32,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
+    0x30,0x29,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x20,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x73,0x72,0x63,0x5f,0x72,
+    0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,
+    0x64,0x65,0x78,0x20,0x3d,0x20,0x62,0x69,0x74,0x63,0x61,0x73,0x74,0x3c,0x69,0x33,
+    0x32,0x3e,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,
+    0x78,0x5f,0x70,0x61,0x72,0x61,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x64,0x73,0x74,0x5f,
+    0x72,0x65,0x63,0x74,0x20,0x3d,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x20,0x3d,
+    0x20,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,
+    0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,
+    0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x2c,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 410
+
+    uniform vec4 transform_params[2];
+    layout(location = 0) in vec4 coord;
+    layout(location = 0) out vec2 texUV;
+    layout(location = 1) out vec4 iColor;
+    layout(location = 1) in vec4 color;
+
+    void main()
+    {
+        vec3 pos = vec3(coord.xy, 1.0);
+        gl_Position = vec4(dot(transform_params[0].xyz, pos), dot(transform_params[1].xyz, pos), 0.0, 1.0);
+        gl_PointSize = 1.0;
+        texUV = coord.zw;
+        iColor = color;
+    }
+
+*/
+static const uint8_t sgp_vs_transform_source_glsl410[420] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x72,0x61,0x6e,0x73,
+    0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6f,
+    0x72,0x64,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x33,0x28,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,
+    0x28,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,
+    0x64,0x6f,0x74,0x28,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,
+    0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,
+    0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 transform_params[2];
+    layout(location = 0) in vec4 coord;
+    out vec2 texUV;
+    out vec4 iColor;
+    layout(location = 1) in vec4 color;
+
+    void main()
+    {
+        vec3 pos = vec3(coord.xy, 1.0);
+        gl_Position = vec4(dot(transform_params[0].xyz, pos), dot(transform_params[1].xyz, pos), 0.0, 1.0);
+        gl_PointSize = 1.0;
+        texUV = coord.zw;
+        iColor = color;
+    }
+
+*/
+static const uint8_t sgp_vs_transform_source_glsl300es[381] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,
+    0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x63,
+    0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,0x28,0x74,0x72,0x61,0x6e,0x73,0x66,
+    0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,
+    0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x74,0x72,0x61,
+    0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,
+    0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    cbuffer transform_params : register(b0)
+    {
+        float4 _19_mvp_x : packoffset(c0);
+        float4 _19_mvp_y : packoffset(c1);
+    };
+
+
+    static float4 gl_Position;
+    static float gl_PointSize;
+    static float4 coord;
+    static float2 texUV;
+    static float4 iColor;
+    static float4 color;
+
+    struct SPIRV_Cross_Input
+    {
+        float4 coord : TEXCOORD0;
+        float4 color : TEXCOORD1;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float2 texUV : TEXCOORD0;
+        float4 iColor : TEXCOORD1;
+        float4 gl_Position : SV_Position;
+    };
+
+    void vert_main()
+    {
+        float3 pos = float3(coord.xy, 1.0f);
+        gl_Position = float4(dot(_19_mvp_x.xyz, pos), dot(_19_mvp_y.xyz, pos), 0.0f, 1.0f);
+        gl_PointSize = 1.0f;
+        texUV = coord.zw;
+        iColor = color;
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        coord = stage_input.coord;
+        color = stage_input.color;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.texUV = texUV;
+        stage_output.iColor = iColor;
+        return stage_output;
+    }
+*/
+static const uint8_t sgp_vs_transform_source_hlsl4[1016] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,
+    0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x5f,0x78,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x5f,
+    0x6d,0x76,0x70,0x5f,0x79,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,
+    0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6f,0x72,0x64,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x66,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,
+    0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,
+    0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,
+    0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,
+    0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,
+    0x63,0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6f,0x72,0x64,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
+    0x74,0x2e,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x55,0x56,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x69,0x43,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct transform_params
+    {
+        float4 mvp_x;
+        float4 mvp_y;
+    };
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float4 gl_Position [[position]];
+        float gl_PointSize [[point_size]];
+    };
+
+    struct main0_in
+    {
+        float4 coord [[attribute(0)]];
+        float4 color [[attribute(1)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant transform_params& _19 [[buffer(0)]])
+    {
+        main0_out out = {};
+        float3 pos = float3(in.coord.xy, 1.0);
+        out.gl_Position = float4(dot(_19.mvp_x.xyz, pos), dot(_19.mvp_y.xyz, pos), 0.0, 1.0);
+        out.gl_PointSize = 1.0;
+        out.texUV = in.coord.zw;
+        out.iColor = in.color;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_transform_source_metal_macos[756] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,
+    0x5f,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,
+    0x76,0x70,0x5f,0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,
+    0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,
+    0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,
+    0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,
+    0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,
+    0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,
+    0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,
+    0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,
+    0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,
+    0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,
+    0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x69,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct transform_params
+    {
+        float4 mvp_x;
+        float4 mvp_y;
+    };
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float4 gl_Position [[position]];
+        float gl_PointSize [[point_size]];
+    };
+
+    struct main0_in
+    {
+        float4 coord [[attribute(0)]];
+        float4 color [[attribute(1)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant transform_params& _19 [[buffer(0)]])
+    {
+        main0_out out = {};
+        float3 pos = float3(in.coord.xy, 1.0);
+        out.gl_Position = float4(dot(_19.mvp_x.xyz, pos), dot(_19.mvp_y.xyz, pos), 0.0, 1.0);
+        out.gl_PointSize = 1.0;
+        out.texUV = in.coord.zw;
+        out.iColor = in.color;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_transform_source_metal_ios[756] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,
+    0x5f,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,
+    0x76,0x70,0x5f,0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,
+    0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,
+    0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,
+    0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,
+    0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,
+    0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,
+    0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,
+    0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,
+    0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,
+    0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,
+    0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x69,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct transform_params {
+      /_ @offset(0) _/
+      mvp_x : vec4f,
+      /_ @offset(16) _/
+      mvp_y : vec4f,
+    }
+
+    var<private> coord : vec4f;
+
+    @group(0) @binding(0) var<uniform> x_19 : transform_params;
+
+    var<private> gl_Position : vec4f;
+
+    var<private> texUV : vec2f;
+
+    var<private> iColor : vec4f;
+
+    var<private> color : vec4f;
+
+    fn main_1() {
+      let pos : vec3f = vec3f(coord.xy, 1.0f);
+      gl_Position = vec4f(dot(x_19.mvp_x.xyz, pos), dot(x_19.mvp_y.xyz, pos), 0.0f, 1.0f);
+      texUV = coord.zw;
+      iColor = color;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      texUV_1 : vec2f,
+      @location(1)
+      iColor_1 : vec4f,
+    }
+
+    @vertex
+    fn main(@location(0) coord_param : vec4f, @location(1) color_param : vec4f) -> main_out {
+      coord = coord_param;
+      color = color_param;
+      main_1();
+      return main_out(gl_Position, texUV, iColor);
+    }
+
+*/
+static const uint8_t sgp_vs_transform_source_wgsl[892] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x76,0x70,0x5f,0x78,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x76,0x70,
+    0x5f,0x79,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6f,0x72,
+    0x64,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,
+    0x75,0x70,0x28,0x30,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x30,
+    0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,
+    0x5f,0x31,0x39,0x20,0x3a,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
+    0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x63,0x6f,0x6f,0x72,
+    0x64,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x28,0x64,0x6f,0x74,0x28,0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,
+    0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,
+    0x28,0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,
+    0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x63,0x6f,
+    0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,
+    0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x28,0x30,0x29,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x5f,0x31,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x31,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,
+    0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x63,0x6f,0x6f,0x72,0x64,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x29,
+    0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,
+    0x20,0x63,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,
+    0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x2c,0x20,0x69,
+    0x43,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 410
+
+    layout(location = 0) in vec4 coord;
+    layout(location = 0) out vec2 texUV;
+    layout(location = 1) out vec4 iColor;
+    layout(location = 1) in vec4 color;
+    layout(location = 2) out float texSlot;
+    layout(location = 2) in float slot;
+
+    void main()
+    {
+        gl_Position = vec4(coord.xy, 0.0, 1.0);
+        gl_PointSize = 1.0;
+        texUV = coord.zw;
+        iColor = color;
+        texSlot = slot;
+    }
+
+*/
+static const uint8_t sgp_vs_multi_texture_source_glsl410[386] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6f,0x72,0x64,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x32,0x29,0x20,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,
+    0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,
+    0x78,0x53,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+/*
+    #version 410
+
+    uniform sampler2D iTexChannel0_iSmpChannel0;
+    uniform sampler2D iTexChannel1_iSmpChannel1;
+    uniform sampler2D iTexChannel2_iSmpChannel2;
+    uniform sampler2D iTexChannel3_iSmpChannel3;
+
+    layout(location = 0) in vec2 texUV;
+    layout(location = 2) in float texSlot;
+    layout(location = 0) out vec4 fragColor;
+    layout(location = 1) in vec4 iColor;
+
+    void main()
+    {
+        vec4 c0 = texture(iTexChannel0_iSmpChannel0, texUV);
+        vec4 c1 = texture(iTexChannel1_iSmpChannel1, texUV);
+        vec4 c2 = texture(iTexChannel2_iSmpChannel2, texUV);
+        vec4 c3 = texture(iTexChannel3_iSmpChannel3, texUV);
+        fragColor = ((texSlot < 0.5) ? c0 : ((texSlot < 1.5) ? c1 : ((texSlot < 2.5) ? c2 : c3))) * iColor;
+    }
+
+*/
+static const uint8_t sgp_fs_multi_texture_source_glsl410[699] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x5f,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,
+    0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x31,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,0x78,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x32,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x32,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x33,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,
+    0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x63,0x30,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x5f,0x69,0x53,
+    0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2c,0x20,0x74,0x65,0x78,0x55,
+    0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x31,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x31,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x31,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x32,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x5f,
+    0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x2c,0x20,0x74,0x65,
+    0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,
+    0x33,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,
+    0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x33,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,
+    0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x30,0x2e,0x35,0x29,0x20,
+    0x3f,0x20,0x63,0x30,0x20,0x3a,0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,
+    0x20,0x3c,0x20,0x31,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x31,0x20,0x3a,0x20,0x28,
+    0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x32,0x2e,0x35,0x29,0x20,
+    0x3f,0x20,0x63,0x32,0x20,0x3a,0x20,0x63,0x33,0x29,0x29,0x29,0x20,0x2a,0x20,0x69,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    layout(location = 0) in vec4 coord;
+    out vec2 texUV;
+    out vec4 iColor;
+    layout(location = 1) in vec4 color;
+    out float texSlot;
+    layout(location = 2) in float slot;
+
+    void main()
+    {
+        gl_Position = vec4(coord.xy, 0.0, 1.0);
+        gl_PointSize = 1.0;
+        texUV = coord.zw;
+        iColor = color;
+        texSlot = slot;
+    }
+
+*/
+static const uint8_t sgp_vs_multi_texture_source_glsl300es[326] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,
+    0x6f,0x72,0x64,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,
+    0x78,0x55,0x56,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,
+    0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,
+    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,
+    0x63,0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x73,0x6c,0x6f,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp sampler2D iTexChannel0_iSmpChannel0;
+    uniform highp sampler2D iTexChannel1_iSmpChannel1;
+    uniform highp sampler2D iTexChannel2_iSmpChannel2;
+    uniform highp sampler2D iTexChannel3_iSmpChannel3;
+
+    in highp vec2 texUV;
+    in highp float texSlot;
+    layout(location = 0) out highp vec4 fragColor;
+    in highp vec4 iColor;
+
+    void main()
+    {
+        highp vec4 c0 = texture(iTexChannel0_iSmpChannel0, texUV);
+        highp vec4 c1 = texture(iTexChannel1_iSmpChannel1, texUV);
+        highp vec4 c2 = texture(iTexChannel2_iSmpChannel2, texUV);
+        highp vec4 c3 = texture(iTexChannel3_iSmpChannel3, texUV);
+        fragColor = ((texSlot < 0.5) ? c0 : ((texSlot < 1.5) ? c1 : ((texSlot < 2.5) ? c2 : c3))) * iColor;
+    }
+
+*/
+static const uint8_t sgp_fs_multi_texture_source_glsl300es[757] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x30,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,0x78,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x31,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x31,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,
+    0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x32,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x5f,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,
+    0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x30,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x30,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,
+    0x6c,0x30,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x31,0x20,0x3d,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,
+    0x6e,0x65,0x6c,0x31,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x31,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x32,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x32,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,
+    0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x33,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,
+    0x6c,0x33,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2c,
+    0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,
+    0x6f,0x74,0x20,0x3c,0x20,0x30,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x30,0x20,0x3a,
+    0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x31,0x2e,0x35,
+    0x29,0x20,0x3f,0x20,0x63,0x31,0x20,0x3a,0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,
+    0x6f,0x74,0x20,0x3c,0x20,0x32,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x32,0x20,0x3a,
+    0x20,0x63,0x33,0x29,0x29,0x29,0x20,0x2a,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    static float4 gl_Position;
+    static float gl_PointSize;
+    static float4 coord;
+    static float2 texUV;
+    static float4 iColor;
+    static float4 color;
+    static float texSlot;
+    static float slot;
+
+    struct SPIRV_Cross_Input
+    {
+        float4 coord : TEXCOORD0;
+        float4 color : TEXCOORD1;
+        float slot : TEXCOORD2;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float2 texUV : TEXCOORD0;
+        float4 iColor : TEXCOORD1;
+        float texSlot : TEXCOORD2;
+        float4 gl_Position : SV_Position;
+    };
+
+    void vert_main()
+    {
+        gl_Position = float4(coord.xy, 0.0f, 1.0f);
+        gl_PointSize = 1.0f;
+        texUV = coord.zw;
+        iColor = color;
+        texSlot = slot;
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        coord = stage_input.coord;
+        color = stage_input.color;
+        slot = stage_input.slot;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.texUV = texUV;
+        stage_output.iColor = iColor;
+        stage_output.texSlot = texSlot;
+        return stage_output;
+    }
+*/
+static const uint8_t sgp_vs_multi_texture_source_hlsl4[995] = {
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,
+    0x6f,0x74,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,
+    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6f,0x72,0x64,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,
+    0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x63,0x6f,0x6f,0x72,0x64,0x2e,
+    0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,
+    0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,
+    0x78,0x55,0x56,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,
+    0x3d,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
+    0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6f,0x72,
+    0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,
+    0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x00,
+};
+/*
+    Texture2D<float4> iTexChannel0 : register(t0);
+    SamplerState iSmpChannel0 : register(s0);
+    Texture2D<float4> iTexChannel1 : register(t1);
+    SamplerState iSmpChannel1 : register(s1);
+    Texture2D<float4> iTexChannel2 : register(t2);
+    SamplerState iSmpChannel2 : register(s2);
+    Texture2D<float4> iTexChannel3 : register(t3);
+    SamplerState iSmpChannel3 : register(s3);
+
+    static float2 texUV;
+    static float texSlot;
+    static float4 fragColor;
+    static float4 iColor;
+
+    struct SPIRV_Cross_Input
+    {
+        float2 texUV : TEXCOORD0;
+        float4 iColor : TEXCOORD1;
+        float texSlot : TEXCOORD2;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float4 fragColor : SV_Target0;
+    };
+
+    void frag_main()
+    {
+        float4 c0 = iTexChannel0.Sample(iSmpChannel0, texUV);
+        float4 c1 = iTexChannel1.Sample(iSmpChannel1, texUV);
+        float4 c2 = iTexChannel2.Sample(iSmpChannel2, texUV);
+        float4 c3 = iTexChannel3.Sample(iSmpChannel3, texUV);
+        fragColor = ((texSlot < 0.5f) ? c0 : ((texSlot < 1.5f) ? c1 : ((texSlot < 2.5f) ? c2 : c3))) * iColor;
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        texUV = stage_input.texUV;
+        texSlot = stage_input.texSlot;
+        iColor = stage_input.iColor;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.fragColor = fragColor;
+        return stage_output;
+    }
+*/
+static const uint8_t sgp_fs_multi_texture_source_hlsl4[1277] = {
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x20,0x3a,
+    0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x69,0x53,0x6d,0x70,
+    0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x69,0x54,0x65,0x78,0x43,
+    0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x74,0x31,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,
+    0x74,0x61,0x74,0x65,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x31,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x31,0x29,
+    0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,
+    0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x32,0x29,0x3b,
+    0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x69,0x53,
+    0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x32,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x69,0x54,0x65,
+    0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x74,0x33,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x33,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,
+    0x33,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,
+    0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x30,0x20,0x3d,
+    0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2e,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x30,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x31,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,
+    0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,
+    0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x2c,0x20,0x74,0x65,0x78,
+    0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x32,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x32,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x32,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x33,0x20,0x3d,0x20,0x69,
+    0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2e,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2c,
+    0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,
+    0x6f,0x74,0x20,0x3c,0x20,0x30,0x2e,0x35,0x66,0x29,0x20,0x3f,0x20,0x63,0x30,0x20,
+    0x3a,0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x31,0x2e,
+    0x35,0x66,0x29,0x20,0x3f,0x20,0x63,0x31,0x20,0x3a,0x20,0x28,0x28,0x74,0x65,0x78,
+    0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x32,0x2e,0x35,0x66,0x29,0x20,0x3f,0x20,0x63,
+    0x32,0x20,0x3a,0x20,0x63,0x33,0x29,0x29,0x29,0x20,0x2a,0x20,0x69,0x43,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float texSlot [[user(locn2)]];
+        float4 gl_Position [[position]];
+        float gl_PointSize [[point_size]];
+    };
+
+    struct main0_in
+    {
+        float4 coord [[attribute(0)]];
+        float4 color [[attribute(1)]];
+        float slot [[attribute(2)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]])
+    {
+        main0_out out = {};
+        out.gl_Position = float4(in.coord.xy, 0.0, 1.0);
+        out.gl_PointSize = 1.0;
+        out.texUV = in.coord.zw;
+        out.iColor = in.color;
+        out.texSlot = in.slot;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_multi_texture_source_metal_macos[659] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,
+    0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x5b,
+    0x5b,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,
+    0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,
+    0x2e,0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,
+    0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
+    0x2e,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,0x53,
+    0x6c,0x6f,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main0_out
+    {
+        float4 fragColor [[color(0)]];
+    };
+
+    struct main0_in
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float texSlot [[user(locn2)]];
+    };
+
+    fragment main0_out main0(main0_in in [[stage_in]], texture2d<float> iTexChannel0 [[texture(0)]], texture2d<float> iTexChannel1 [[texture(1)]], texture2d<float> iTexChannel2 [[texture(2)]], texture2d<float> iTexChannel3 [[texture(3)]], sampler iSmpChannel0 [[sampler(0)]], sampler iSmpChannel1 [[sampler(1)]], sampler iSmpChannel2 [[sampler(2)]], sampler iSmpChannel3 [[sampler(3)]])
+    {
+        main0_out out = {};
+        float4 c0 = iTexChannel0.sample(iSmpChannel0, in.texUV);
+        float4 c1 = iTexChannel1.sample(iSmpChannel1, in.texUV);
+        float4 c2 = iTexChannel2.sample(iSmpChannel2, in.texUV);
+        float4 c3 = iTexChannel3.sample(iSmpChannel3, in.texUV);
+        out.fragColor = ((in.texSlot < 0.5) ? c0 : ((in.texSlot < 1.5) ? c1 : ((in.texSlot < 2.5) ? c2 : c3))) * in.iColor;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_fs_multi_texture_source_metal_macos[1049] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,
+    0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x20,0x5b,
+    0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x54,
+    0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x5b,0x5b,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x33,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x20,
+    0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,
+    0x6e,0x65,0x6c,0x31,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x31,
+    0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x5b,
+    0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x33,0x29,0x5d,0x5d,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,
+    0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x30,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x30,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,
+    0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x31,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,
+    0x6c,0x31,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x31,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x32,
+    0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x2e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x32,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x33,0x20,0x3d,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2e,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,
+    0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x28,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,
+    0x30,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x30,0x20,0x3a,0x20,0x28,0x28,0x69,0x6e,
+    0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x31,0x2e,0x35,0x29,0x20,
+    0x3f,0x20,0x63,0x31,0x20,0x3a,0x20,0x28,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x53,
+    0x6c,0x6f,0x74,0x20,0x3c,0x20,0x32,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x32,0x20,
+    0x3a,0x20,0x63,0x33,0x29,0x29,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,0x43,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float texSlot [[user(locn2)]];
+        float4 gl_Position [[position]];
+        float gl_PointSize [[point_size]];
+    };
+
+    struct main0_in
+    {
+        float4 coord [[attribute(0)]];
+        float4 color [[attribute(1)]];
+        float slot [[attribute(2)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]])
+    {
+        main0_out out = {};
+        out.gl_Position = float4(in.coord.xy, 0.0, 1.0);
+        out.gl_PointSize = 1.0;
+        out.texUV = in.coord.zw;
+        out.iColor = in.color;
+        out.texSlot = in.slot;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_multi_texture_source_metal_ios[659] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,
+    0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x5b,
+    0x5b,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,
+    0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,
+    0x2e,0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,
+    0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
+    0x2e,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,0x53,
+    0x6c,0x6f,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main0_out
+    {
+        float4 fragColor [[color(0)]];
+    };
+
+    struct main0_in
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float texSlot [[user(locn2)]];
+    };
+
+    fragment main0_out main0(main0_in in [[stage_in]], texture2d<float> iTexChannel0 [[texture(0)]], texture2d<float> iTexChannel1 [[texture(1)]], texture2d<float> iTexChannel2 [[texture(2)]], texture2d<float> iTexChannel3 [[texture(3)]], sampler iSmpChannel0 [[sampler(0)]], sampler iSmpChannel1 [[sampler(1)]], sampler iSmpChannel2 [[sampler(2)]], sampler iSmpChannel3 [[sampler(3)]])
+    {
+        main0_out out = {};
+        float4 c0 = iTexChannel0.sample(iSmpChannel0, in.texUV);
+        float4 c1 = iTexChannel1.sample(iSmpChannel1, in.texUV);
+        float4 c2 = iTexChannel2.sample(iSmpChannel2, in.texUV);
+        float4 c3 = iTexChannel3.sample(iSmpChannel3, in.texUV);
+        out.fragColor = ((in.texSlot < 0.5) ? c0 : ((in.texSlot < 1.5) ? c1 : ((in.texSlot < 2.5) ? c2 : c3))) * in.iColor;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_fs_multi_texture_source_metal_ios[1049] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,
+    0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x20,0x5b,
+    0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x54,
+    0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x5b,0x5b,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x33,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x20,
+    0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,
+    0x6e,0x65,0x6c,0x31,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x31,
+    0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x5b,
+    0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x33,0x29,0x5d,0x5d,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,
+    0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x30,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x30,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,
+    0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x31,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,
+    0x6c,0x31,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x31,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x32,
+    0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x2e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x32,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x33,0x20,0x3d,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2e,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,
+    0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x28,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,
+    0x30,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x30,0x20,0x3a,0x20,0x28,0x28,0x69,0x6e,
+    0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x31,0x2e,0x35,0x29,0x20,
+    0x3f,0x20,0x63,0x31,0x20,0x3a,0x20,0x28,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x53,
+    0x6c,0x6f,0x74,0x20,0x3c,0x20,0x32,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x32,0x20,
+    0x3a,0x20,0x63,0x33,0x29,0x29,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,0x43,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    var<private> coord : vec4f;
+
+    var<private> texUV : vec2f;
+
+    var<private> iColor : vec4f;
+
+    var<private> color : vec4f;
+
+    var<private> texSlot : f32;
+
+    var<private> slot : f32;
+
+    var<private> gl_Position : vec4f;
+
+    fn main_1() {
+      gl_Position = vec4f(coord.xy, 0.0f, 1.0f);
+      texUV = coord.zw;
+      iColor = color;
+      texSlot = slot;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      texUV_1 : vec2f,
+      @location(1)
+      iColor_1 : vec4f,
+      @location(2)
+      texSlot_1 : f32,
+    }
+
+    @vertex
+    fn main(@location(0) coord_param : vec4f, @location(1) color_param : vec4f, @location(2) slot_param : f32) -> main_out {
+      coord = coord_param;
+      color = color_param;
+      slot = slot_param;
+      main_1();
+      return main_out(gl_Position, texUV, iColor, texSlot);
+    }
+
+*/
+static const uint8_t sgp_vs_multi_texture_source_wgsl[812] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6f,0x72,0x64,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
+    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,
+    0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x74,0x65,0x78,0x53,0x6c,
+    0x6f,0x74,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x73,0x6c,0x6f,0x74,0x20,0x3a,0x20,0x66,
+    0x33,0x32,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,
+    0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x63,0x6f,0x6f,0x72,
+    0x64,0x2e,0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,
+    0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x63,0x6f,0x6f,
+    0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x53,0x6c,
+    0x6f,0x74,0x20,0x3d,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,
+    0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x5f,0x31,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x0a,0x20,0x20,0x74,0x65,0x78,0x53,
+    0x6c,0x6f,0x74,0x5f,0x31,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x7d,0x0a,0x0a,
+    0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x63,0x6f,0x6f,
+    0x72,0x64,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,
+    0x20,0x73,0x6c,0x6f,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x66,0x33,
+    0x32,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,
+    0x0a,0x20,0x20,0x63,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,
+    0x20,0x73,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x73,0x6c,0x6f,0x74,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,
+    0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x74,
+    0x65,0x78,0x55,0x56,0x2c,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x74,0x65,
+    0x78,0x53,0x6c,0x6f,0x74,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    @group(1) @binding(64) var iTexChannel0 : texture_2d<f32>;
+
+    @group(1) @binding(80) var iSmpChannel0 : sampler;
+
+    @group(1) @binding(65) var iTexChannel1 : texture_2d<f32>;
+
+    @group(1) @binding(81) var iSmpChannel1 : sampler;
+
+    @group(1) @binding(66) var iTexChannel2 : texture_2d<f32>;
+
+    @group(1) @binding(82) var iSmpChannel2 : sampler;
+
+    @group(1) @binding(67) var iTexChannel3 : texture_2d<f32>;
+
+    @group(1) @binding(83) var iSmpChannel3 : sampler;
+
+    var<private> texUV : vec2f;
+
+    var<private> texSlot : f32;
+
+    var<private> fragColor : vec4f;
+
+    var<private> iColor : vec4f;
+
+    fn main_1() {
+      let c0 : vec4f = textureSample(iTexChannel0, iSmpChannel0, texUV);
+      let c1 : vec4f = textureSample(iTexChannel1, iSmpChannel1, texUV);
+      let c2 : vec4f = textureSample(iTexChannel2, iSmpChannel2, texUV);
+      let c3 : vec4f = textureSample(iTexChannel3, iSmpChannel3, texUV);
+      fragColor = (select(c0, select(c1, select(c2, c3, (texSlot >= 2.5f)), (texSlot >= 1.5f)), (texSlot >= 0.5f)) * iColor);
+      return;
+    }
+
+    struct main_out {
+      @location(0)
+      fragColor_1 : vec4f,
+    }
+
+    @fragment
+    fn main(@location(0) texUV_param : vec2f, @location(1) iColor_param : vec4f, @location(2) texSlot_param : f32) -> main_out {
+      texUV = texUV_param;
+      iColor = iColor_param;
+      texSlot = texSlot_param;
+      main_1();
+      return main_out(fragColor);
+    }
+
+*/
+static const uint8_t sgp_fs_multi_texture_source_wgsl[1350] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x34,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,
+    0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,
+    0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x38,0x30,0x29,0x20,0x76,0x61,0x72,0x20,
+    0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x20,0x3a,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x35,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,
+    0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,
+    0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x38,0x31,0x29,0x20,0x76,0x61,0x72,0x20,
+    0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x20,0x3a,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x36,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,
+    0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,
+    0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x38,0x32,0x29,0x20,0x76,0x61,0x72,0x20,
+    0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x3a,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x37,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,
+    0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,
+    0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x38,0x33,0x29,0x20,0x76,0x61,0x72,0x20,
+    0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x3a,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3a,0x20,0x66,0x33,0x32,
+    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
+    0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,
+    0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x63,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2c,0x20,0x69,
+    0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2c,0x20,0x74,0x65,0x78,
+    0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x63,0x31,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,
+    0x6c,0x31,0x2c,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,
+    0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x63,0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x54,0x65,0x78,0x43,
+    0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x2c,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x32,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x63,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2c,0x20,0x69,0x53,
+    0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2c,0x20,0x74,0x65,0x78,0x55,
+    0x56,0x29,0x3b,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x28,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x63,0x30,0x2c,0x20,0x73,0x65,
+    0x6c,0x65,0x63,0x74,0x28,0x63,0x31,0x2c,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,
+    0x63,0x32,0x2c,0x20,0x63,0x33,0x2c,0x20,0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,
+    0x20,0x3e,0x3d,0x20,0x32,0x2e,0x35,0x66,0x29,0x29,0x2c,0x20,0x28,0x74,0x65,0x78,
+    0x53,0x6c,0x6f,0x74,0x20,0x3e,0x3d,0x20,0x31,0x2e,0x35,0x66,0x29,0x29,0x2c,0x20,
+    0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x35,0x66,
+    0x29,0x29,0x20,0x2a,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x66,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,
+    0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x28,0x30,0x29,0x20,0x74,0x65,0x78,0x55,0x56,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x66,0x33,0x32,0x29,0x20,0x2d,
+    0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x74,
+    0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x74,0x65,0x78,0x55,0x56,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,
+    0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x74,
+    0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,
+    0x6e,0x5f,0x6f,0x75,0x74,0x28,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+const sg_shader_desc* sgp_program_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_source_glsl410;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_glsl410;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].glsl_name = "coord";
+            desc.attrs[1].glsl_name = "color";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
+            desc.label = "sgp_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].glsl_name = "coord";
+            desc.attrs[1].glsl_name = "color";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
+            desc.label = "sgp_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_source_hlsl4;
+            desc.vertex_func.d3d11_target = "vs_4_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_hlsl4;
+            desc.fragment_func.d3d11_target = "ps_4_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].hlsl_register_t_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].hlsl_register_s_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_source_metal_macos;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)sgp_fs_source_metal_macos;
+            desc.fragment_func.entry = "main0";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].msl_texture_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].msl_sampler_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_IOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_source_metal_ios;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)sgp_fs_source_metal_ios;
+            desc.fragment_func.entry = "main0";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].msl_texture_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].msl_sampler_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].wgsl_group1_binding_n = 64;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].wgsl_group1_binding_n = 80;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_program_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+const sg_shader_desc* sgp_sprite_program_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_sprite_source_glsl410;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_glsl410;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].glsl_name = "dst_rect";
+            desc.attrs[1].glsl_name = "src_rect";
+            desc.attrs[2].glsl_name = "color";
+            desc.attrs[3].glsl_name = "rotation";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "sprite_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
+            desc.label = "sgp_sprite_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_sprite_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].glsl_name = "dst_rect";
+            desc.attrs[1].glsl_name = "src_rect";
+            desc.attrs[2].glsl_name = "color";
+            desc.attrs[3].glsl_name = "rotation";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "sprite_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
+            desc.label = "sgp_sprite_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_sprite_source_hlsl4;
+            desc.vertex_func.d3d11_target = "vs_4_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_hlsl4;
+            desc.fragment_func.d3d11_target = "ps_4_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.attrs[2].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[2].hlsl_sem_index = 2;
+            desc.attrs[3].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[3].hlsl_sem_index = 3;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].hlsl_register_t_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].hlsl_register_s_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_sprite_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_sprite_source_metal_macos;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)sgp_fs_source_metal_macos;
+            desc.fragment_func.entry = "main0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].msl_texture_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].msl_sampler_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_sprite_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_IOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_sprite_source_metal_ios;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)sgp_fs_source_metal_ios;
+            desc.fragment_func.entry = "main0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].msl_texture_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].msl_sampler_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_sprite_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_sprite_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].wgsl_group1_binding_n = 64;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].wgsl_group1_binding_n = 80;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_sprite_program_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+const sg_shader_desc* sgp_transform_program_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_transform_source_glsl410;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_glsl410;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].glsl_name = "coord";
+            desc.attrs[1].glsl_name = "color";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "transform_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
+            desc.label = "sgp_transform_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_transform_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].glsl_name = "coord";
+            desc.attrs[1].glsl_name = "color";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "transform_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
+            desc.label = "sgp_transform_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_transform_source_hlsl4;
+            desc.vertex_func.d3d11_target = "vs_4_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_hlsl4;
+            desc.fragment_func.d3d11_target = "ps_4_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].hlsl_register_t_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].hlsl_register_s_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_transform_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_transform_source_metal_macos;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)sgp_fs_source_metal_macos;
+            desc.fragment_func.entry = "main0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].msl_texture_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].msl_sampler_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_transform_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_IOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_transform_source_metal_ios;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)sgp_fs_source_metal_ios;
+            desc.fragment_func.entry = "main0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].msl_texture_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].msl_sampler_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_transform_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_transform_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].wgsl_group1_binding_n = 64;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].wgsl_group1_binding_n = 80;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "sgp_transform_program_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+const sg_shader_desc* sgp_multi_texture_program_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_multi_texture_source_glsl410;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_multi_texture_source_glsl410;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].glsl_name = "coord";
+            desc.attrs[1].glsl_name = "color";
+            desc.attrs[2].glsl_name = "slot";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[1].glsl_name = "iTexChannel1_iSmpChannel1";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 2;
+            desc.image_sampler_pairs[2].glsl_name = "iTexChannel2_iSmpChannel2";
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 3;
+            desc.image_sampler_pairs[3].glsl_name = "iTexChannel3_iSmpChannel3";
+            desc.label = "sgp_multi_texture_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_multi_texture_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_multi_texture_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].glsl_name = "coord";
+            desc.attrs[1].glsl_name = "color";
+            desc.attrs[2].glsl_name = "slot";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[1].glsl_name = "iTexChannel1_iSmpChannel1";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 2;
+            desc.image_sampler_pairs[2].glsl_name = "iTexChannel2_iSmpChannel2";
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 3;
+            desc.image_sampler_pairs[3].glsl_name = "iTexChannel3_iSmpChannel3";
+            desc.label = "sgp_multi_texture_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_multi_texture_source_hlsl4;
+            desc.vertex_func.d3d11_target = "vs_4_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_multi_texture_source_hlsl4;
+            desc.fragment_func.d3d11_target = "ps_4_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.attrs[2].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[2].hlsl_sem_index = 2;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].hlsl_register_t_n = 0;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[1].hlsl_register_t_n = 1;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[2].hlsl_register_t_n = 2;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.images[3].hlsl_register_t_n = 3;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].hlsl_register_s_n = 0;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].hlsl_register_s_n = 1;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].hlsl_register_s_n = 2;
+            desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[3].hlsl_register_s_n = 3;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 2;
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 3;
+            desc.label = "sgp_multi_texture_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_multi_texture_source_metal_macos;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)sgp_fs_multi_texture_source_metal_macos;
+            desc.fragment_func.entry = "main0";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].msl_texture_n = 0;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[1].msl_texture_n = 1;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[2].msl_texture_n = 2;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.images[3].msl_texture_n = 3;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].msl_sampler_n = 0;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].msl_sampler_n = 1;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].msl_sampler_n = 2;
+            desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[3].msl_sampler_n = 3;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 2;
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 3;
+            desc.label = "sgp_multi_texture_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_IOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_multi_texture_source_metal_ios;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)sgp_fs_multi_texture_source_metal_ios;
+            desc.fragment_func.entry = "main0";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].msl_texture_n = 0;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[1].msl_texture_n = 1;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[2].msl_texture_n = 2;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.images[3].msl_texture_n = 3;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].msl_sampler_n = 0;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].msl_sampler_n = 1;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].msl_sampler_n = 2;
+            desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[3].msl_sampler_n = 3;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 2;
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 3;
+            desc.label = "sgp_multi_texture_program_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_WGPU) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)sgp_vs_multi_texture_source_wgsl;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sgp_fs_multi_texture_source_wgsl;
+            desc.fragment_func.entry = "main";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].wgsl_group1_binding_n = 64;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[1].wgsl_group1_binding_n = 65;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[2].wgsl_group1_binding_n = 66;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.images[3].wgsl_group1_binding_n = 67;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].wgsl_group1_binding_n = 80;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].wgsl_group1_binding_n = 81;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].wgsl_group1_binding_n = 82;
+            desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[3].wgsl_group1_binding_n = 83;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 2;
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 3;
+            desc.label = "sgp_multi_texture_program_shader";
         }
         return &desc;
     }
     return 0;
 }
-#endif // SOKOL_SHDC_IMPL
\ No newline at end of file
+#endif // SOKOL_SHDC_IMPL
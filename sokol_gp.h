@@ -74,9 +74,146 @@ In experiments using `8` as the default is a good default,
 but you may want to try out different values depending on your case.
 Using values that are too high is not recommended, because the algorithm may take too long
 scanning previous draw commands, and that may consume more CPU resources.
+When the depth is above 8, the regions of queued draws are also marked in a coarse grid of tiles over the screen,
+so when merging past many draws the grid tells in constant time that none of them overlaps,
+skipping the overlap checks against each of them. Deeper lookbacks still move more vertices in memory.
 
 The batch optimizer can be disabled by setting `SGP_BATCH_OPTIMIZER_DEPTH` to 0,
 you can use that to measure its impact.
+The lookback depth and the maximum number of vertices moved in memory per merge
+can also be configured at runtime with `batch_optimizer_depth` and `batch_optimizer_max_move_vertices`
+in `sgp_desc`, and overridden between `sgp_begin()` and `sgp_end()` with `sgp_set_batch_optimizer()`,
+so different scenes can use different trade-offs between CPU time spent merging and draw calls saved
+without recompiling. The depth set at runtime can not exceed the one given in `sgp_desc`.
+As 0 leaves these `sgp_desc` fields to their defaults, set them to `SGP_BATCH_OPTIMIZER_OFF` to disable
+the batch optimizer or vertex moves at runtime.
+
+When many draws interleave a few textures or pipelines, as with sprites from several atlas pages,
+set `sorted_batching` in `sgp_desc` to reorder them when flushing, instead of merging them while they are queued.
+Each draw gets the lowest layer keeping it above every previous draw it overlaps, found with a coarse grid over the viewport,
+then the draws are stably sorted by layer, pipeline, textures and uniform, and consecutive draws sharing these are merged.
+Viewport, scissor, instanced and static draws are never crossed, and strips are not merged.
+Command lists still merge their draws while recording, they are sorted again once submitted.
+Sorting takes some CPU time on flush and each draw takes a command until then, so `max_commands` may need to be larger,
+the number of merges is reported by `num_merged_sorted` in `sgp_query_stats()`.
+
+When draws differ only by their texture, set `multi_texture_batching` in `sgp_desc` to pack them on flush
+into a single draw call that binds up to 4 textures, each vertex selecting its texture with a slot index.
+Only consecutive draws of the builtin pipelines with triangles, lines, points or indexed quads,
+sampling just the first texture channel, with the same blend mode and contiguous vertices are packed,
+so it works best together with `sorted_batching`, which groups such draws first.
+The slot indexes take 4 bytes per vertex in an extra vertex buffer, uploaded only on flushes that pack draws,
+and the packed fragment shader samples all 4 textures for each fragment, trading texture fetches for draw calls.
+It is ignored when `SGP_TEXTURE_SLOTS` is below 4, and the number of packed draws is reported by `num_merged_textures` in `sgp_query_stats()`.
+
+To check how effective the batch optimizer is for your scenes, call `sgp_query_stats()` after `sgp_flush()`,
+it returns how many draws were queued and merged, how many vertex bytes were moved to rearrange batches,
+and how many pipelines, bindings, uniforms, viewports, scissors and draw calls were actually dispatched to Sokol GFX.
+Bindings applied because a texture slot changed are counted apart from bindings re-applied only because
+the pipeline changed, the latter can be avoided by drawing with fewer pipeline switches.
+When `SGP_FLUSH_TIMING` is defined the CPU time spent in each of these Sokol GFX calls is measured too,
+it adds a clock read around every call, so it is disabled by default.
+
+To size `max_vertices` and `max_commands` in `sgp_desc` without over-provisioning,
+`sgp_query_high_water_marks()` returns the highest number of vertices, commands, uniforms and sprites
+queued at once since setup. A mark above the capacity means a frame ran out of space and draws were dropped.
+Set `capacity_callback` in `sgp_desc` to be warned once, the first time a flushed frame
+uses more than `capacity_callback.threshold` (90% by default) of any of these buffers.
+
+When the peak usage is hard to predict, for example on level loads or debug overlays,
+set `grow_buffers` in `sgp_desc` to grow the vertices, commands, uniforms and sprites buffers
+by doubling their size when they get full, instead of dropping draws.
+The GPU vertex and sprite buffers also grow when a flush does not fit in them, the replaced buffer is
+destroyed on the next frame, as draws of the current frame may still use it.
+This way `max_vertices` and `max_commands` can be kept small for typical frames.
+
+For sprite heavy scenes set `indexed_quads` in `sgp_desc`, then rectangles drawn by `sgp_clear()`,
+`sgp_draw_filled_rects()` and `sgp_draw_textured_rects()` take 4 vertices instead of 6,
+using a static index buffer shared by all quads, which cuts vertex writes and uploads by a third
+and lets the batch optimizer move less memory. Rectangles drawn with a custom pipeline are not indexed,
+and indexed quads are not batched together with other triangles, as they use different pipelines.
+
+For thousands of sprites sharing a texture, `sgp_draw_sprites_instanced()` goes further,
+each `sgp_sprite` holds its destination and source rectangles, color and rotation around its center,
+and is uploaded as is to a per-instance buffer, then expanded into a rectangle by the GPU,
+so the CPU does no per-vertex work and no draw command is queued per sprite.
+The current transform is applied on the GPU, while the current color and custom pipeline are ignored,
+the blend mode still applies. Sprites are not culled and consecutive instanced draws
+with the same texture and transform are merged, the number of sprites per frame is limited by `max_sprites`.
+
+When vertex upload bandwidth matters more than precision, as on integrated GPUs and WebGL,
+set `compact_vertices` in `sgp_desc` to upload 12 bytes per vertex instead of 20,
+the vertices are packed on flush with positions and texture coordinates as 16 bit normalized integers,
+giving a precision of about 1/16th of a pixel for a 4096 pixels wide viewport.
+Only flushes where every position is inside the viewport and every texture coordinate in the [-1, 1] range
+are packed, the others upload float vertices with a second set of builtin pipelines, so nothing is distorted,
+and so do flushes with draws of custom pipelines, which always take float vertices.
+This suits UI passes where everything stays on screen, `num_compact_vertices` in `sgp_query_stats()`
+tells whether the last flush was packed.
+
+To see where the CPU time goes inside a frame, define `SGP_TRACE` before including the implementation
+and set a tracer callback in `sgp_desc`, it receives begin and end events for `sgp_begin()`,
+every draw function, the batch optimizer merges, the vertices upload and each command dispatched in `sgp_flush()`.
+A ready-made writer for the Chrome trace JSON format is included,
+its output can be loaded in `chrome://tracing` or [Perfetto](https://ui.perfetto.dev):
+
+```c
+sgp_chrome_trace trace;
+sgp_chrome_trace_begin(&trace, fopen("trace.json", "w"));
+sgp_desc desc = {.tracer = {.func = sgp_chrome_trace_func, .user_data = &trace}};
+sgp_setup(&desc);
+// ... draw some frames ...
+sgp_shutdown();
+sgp_chrome_trace_end(&trace);
+```
+
+To reproduce performance problems of real frames offline, `sgp_capture()` serializes the draw commands
+queued since `sgp_begin()` into a compact binary buffer, with their vertices, uniforms and the
+images, samplers and pipelines they reference. Later `sgp_replay()` queues the captured commands again
+before `sgp_flush()`, builtin resources are resolved automatically while the others are resolved by a callback.
+The replayed draws pass through the batch optimizer again, unless it is disabled with `sgp_set_batch_optimizer(0, 0)`,
+in which case the captured command queue is reproduced exactly.
+The `sample-replay` sample replays captures made with `sample-bench-headless -capture`.
+
+To build a frame from several threads, each worker thread records into its own `sgp_command_list`
+between `sgp_begin_command_list()` and `sgp_end_command_list()`, using the same draw and state functions,
+which are redirected to the list for the calling thread. Then the thread that called `sgp_setup()`
+submits the lists in order with `sgp_submit_command_list()` between `sgp_begin()` and `sgp_flush()`,
+this copies their commands and vertices into the draw command queue, each list batched on its own.
+Lists are created with `sgp_make_command_list()` on that thread, their buffers grow as needed,
+and images, samplers and pipelines used while recording must not be created or destroyed meanwhile.
+As recording threads can't create pipelines, the first list made from a context creates all its builtin pipelines,
+up to 49 shared by every context with the same formats, so `pipeline_pool_size` in `sg_desc` must leave room for
+a set per distinct color format, depth format and sample count of the contexts, besides the pipelines of the application,
+and contexts with `compact_vertices` may make another set when flushing float vertices.
+
+To draw into several targets with independently sized buffers, such as the main window, offscreen render targets
+and tool panels, `sgp_make_context()` creates another context with its own `sgp_desc`, buffers and draw command queue,
+sharing the builtin shaders, pipelines, white texture and sampler with the default context created by `sgp_setup()`.
+All the other functions use the current context of the calling thread, which is changed with `sgp_set_context()`,
+so each context can record and flush its own frames, even interleaved.
+Contexts are destroyed with `sgp_destroy_context()` or by `sgp_shutdown()`, and their number is limited by `SGP_MAX_CONTEXTS`.
+Like Sokol GFX handles, the handle of a destroyed context stays invalid even when a new context takes its place.
+
+Draws generating a very large number of vertices, such as `sgp_draw_filled_rects()` with many thousands of rectangles,
+can split their vertex generation in tasks run by a job system of the application, set with `sgp_desc.dispatcher`.
+Its callback receives the tasks of a draw when it generates at least `min_vertices` vertices and must run all of them
+before returning, each task writes a disjoint range of vertices so the result is identical to generating them inline.
+
+Content that rarely changes, such as a tile map or a static background, can be recorded once into a command list
+and baked with `sgp_make_static_batch()` into an immutable vertex buffer, merging its draws ahead of time.
+Then `sgp_draw_static_batch()` replays it each frame with the current transform applied by the vertex shader,
+so no vertices are generated nor uploaded again. Command lists keep their draws out of the list frame,
+which are skipped when submitted instead, so baked content may extend past it, and `sgp_stats.num_culled_draws`
+counts the draws skipped for being out of the screen. Only draws with builtin pipelines in the projection
+of the list frame can be baked, lists changing the viewport, scissor or projection are rejected with an error,
+and static batch draws are not included in captures.
+
+Draws can also keep their vertices in local space with `sgp_set_gpu_transform(true)`, then the vertex shader
+applies the current transform and projection, passed as a uniform of each draw command.
+This skips transforming every vertex on the CPU, though draws with different transforms can't be batched together.
+It is ignored by custom pipelines and when `compact_vertices` is set, and rectangles are never indexed quads with it.
+Command lists only use the GPU transform pipelines their context created before the list.
 
 In the samples directory of this repository there is a
 benchmark example that tests drawing with the bath optimizer enabled/disabled.
@@ -243,8 +380,13 @@ In folder `samples` you can find the following complete examples covering all AP
 * [sample-sdf.c](https://github.com/edubart/sokol_gp/blob/master/samples/sample-sdf.c): This is an example on how to create custom shaders.
 * [sample-effect.c](https://github.com/edubart/sokol_gp/blob/master/samples/sample-effect.c): This is an example on how to use custom shaders for 2D drawing.
 * [sample-bench.c](https://github.com/edubart/sokol_gp/blob/master/samples/sample-bench.c): This is a heavy example used for benchmarking purposes.
+* [sample-batch-test.c](https://github.com/edubart/sokol_gp/blob/master/samples/sample-batch-test.c): Regression test of the batch optimizer, checks golden draw command counts and painter's order of scripted scenes with a CPU rasterizer, running headless on the dummy backend.
+* [sample-bench-headless.c](https://github.com/edubart/sokol_gp/blob/master/samples/sample-bench-headless.c): This is the same benchmark running headless on the dummy backend, printing CPU timings as JSON.
+* [sample-microbench.c](https://github.com/edubart/sokol_gp/blob/master/samples/sample-microbench.c): Microbenchmark of the vertex generation of the draw functions with different batch sizes and transforms, running headless on the dummy backend.
+* [sample-replay.c](https://github.com/edubart/sokol_gp/blob/master/samples/sample-replay.c): Replays a draw command capture headless on the dummy backend, printing CPU timings as JSON.
 
 These examples are used as the test suite for the library, you can build them by typing `make`.
+The headless examples do not need a window or a GPU, you can build them by typing `make headless backend=dummy`.
 
 ## Error handling
 
@@ -312,12 +454,24 @@ By default textures are drawn using a simple nearest filter sampler,
 you can change the sampler with `sgp_set_sampler(0, smp)` before drawing a texture,
 it's recommended to restore the default sampler using `sgp_reset_sampler(0)`.
 
+Many small images, such as icons, can be packed at runtime into the few large page images of an atlas
+created with `sgp_make_atlas()`, so their draws bind the same image and the batch optimizer can merge them.
+`sgp_atlas_add_image()` packs RGBA8 pixels with a skyline packer and returns the page image with the source region
+of the packed image, to be given to `sgp_set_image()` and `sgp_draw_textured_rects()` as is,
+while `sgp_atlas_src_rect()` offsets a part of it. Pages are kept on the CPU and uploaded whole,
+so call `sgp_atlas_upload()` every frame before drawing, it uploads only the pages that changed,
+at most once per frame as Sokol GFX requires, so images added after it in the same frame appear on the next one.
+
 ## Color modulation
 
 All common pipelines have color modulation, and you can modulate
 a color before a draw by setting the current state color with `sgp_set_color(r,g,b,a)`,
 later you should reset the color to default (white) with `sgp_reset_color()`.
 
+When many rectangles have different colors, `sgp_draw_colored_rects()` and `sgp_draw_colored_textured_rects()`
+take the color of each rectangle instead of the current state color, queueing all of them as a single draw,
+which avoids a call and a merge attempt per rectangle.
+
 ## Custom shaders
 
 When using a custom shader, you must create a pipeline for it with `sgp_make_pipeline(desc)`,
@@ -346,8 +500,13 @@ the number of uniforms of your largest shader.
 The following macros can be defined before including to change the library behavior:
 
 - `SGP_BATCH_OPTIMIZER_DEPTH` - Number of draw commands that the batch optimizer looks back at. Default is 8.
-- `SGP_UNIFORM_CONTENT_SLOTS` - Maximum number of floats that can be stored in each draw call uniform buffer. Default is 8.
+- `SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES` - Maximum number of vertices that the batch optimizer moves in memory per merge. Default is 96.
+- `SGP_UNIFORM_CONTENT_SLOTS` - Maximum number of floats that can be stored in each draw call uniform buffer. Default is 8, lower values only limit custom shaders, as builtin programs always get 8 floats.
 - `SGP_TEXTURE_SLOTS` - Maximum number of textures that can be bound per draw call. Default is 4.
+- `SGP_MAX_CONTEXTS` - Maximum number of SGP contexts that can exist at once, including the default one. Default is 16.
+- `SGP_TRACE` - Enables trace events sent to `sgp_desc.tracer`, to profile recording and flushing. Disabled by default.
+- `SGP_FLUSH_TIMING` - Measures the CPU time of each Sokol GFX call type in `sgp_flush()`, reported by `sgp_query_stats()`. Disabled by default.
+- `SGP_NO_SIMD` - Uses portable scalar code instead of the SSE2, NEON or WebAssembly SIMD kernels that transform vertices. Not defined by default.
 
 ## License
 
@@ -374,6 +533,14 @@ MIT, see LICENSE file or the end of `sokol_gp.h` file.
 #define SGP_BATCH_OPTIMIZER_DEPTH 8
 #endif
 
+/* Maximum number of vertices that the batch optimizer moves in memory to merge a draw command.
+Higher values allow more merges at the cost of more memory copies.
+This is the default used when `sgp_desc.batch_optimizer_max_move_vertices` is not set.
+*/
+#ifndef SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES
+#define SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES 96
+#endif
+
 /* Number of uniform floats (4-bytes) slots that can be set in a shader.
 Increase this value if you need to use shader with many uniforms.
 */
@@ -386,6 +553,11 @@ Increase this value if you need to use shader with many uniforms.
 #define SGP_TEXTURE_SLOTS 4
 #endif
 
+/* Number of SGP contexts that can exist at once, including the default one created by `sgp_setup`. */
+#ifndef SGP_MAX_CONTEXTS
+#define SGP_MAX_CONTEXTS 16
+#endif
+
 #if defined(SOKOL_API_DECL) && !defined(SOKOL_GP_API_DECL)
 #define SOKOL_GP_API_DECL SOKOL_API_DECL
 #endif
@@ -410,6 +582,9 @@ Increase this value if you need to use shader with many uniforms.
 
 #include <stdbool.h>
 #include <stdint.h>
+#ifdef SGP_TRACE
+#include <stdio.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -433,6 +608,17 @@ typedef enum sgp_error {
     SGP_ERROR_MAKE_NEAREST_SAMPLER_FAILED,
     SGP_ERROR_MAKE_COMMON_SHADER_FAILED,
     SGP_ERROR_MAKE_COMMON_PIPELINE_FAILED,
+    SGP_ERROR_CAPTURE_INVALID,
+    SGP_ERROR_CAPTURE_UNRESOLVED,
+    SGP_ERROR_MAKE_INDEX_BUFFER_FAILED,
+    SGP_ERROR_SPRITES_FULL,
+    SGP_ERROR_SPRITES_OVERFLOW,
+    SGP_ERROR_MAKE_SPRITE_BUFFER_FAILED,
+    SGP_ERROR_CONTEXTS_FULL,
+    SGP_ERROR_STATIC_BATCH_UNSUPPORTED,
+    SGP_ERROR_ATLAS_FULL,
+    SGP_ERROR_MAKE_ATLAS_PAGE_FAILED,
+    SGP_ERROR_STATIC_BATCH_PROJECTED,
 } sgp_error;
 
 /* Blend modes. */
@@ -518,9 +704,38 @@ typedef struct sgp_vertex {
     sgp_color_ub4 color;
 } sgp_vertex;
 
+/* Rectangle drawn by `sgp_draw_colored_rects` with its own color. */
+typedef struct sgp_colored_rect {
+    sgp_rect rect;
+    sgp_color_ub4 color;    /* Color modulation, replaces the current state color. */
+} sgp_colored_rect;
+
+/* Textured rectangle drawn by `sgp_draw_colored_textured_rects` with its own color. */
+typedef struct sgp_colored_textured_rect {
+    sgp_rect dst;
+    sgp_rect src;           /* Source region of the texture, in pixels. */
+    sgp_color_ub4 color;    /* Color modulation, replaces the current state color. */
+} sgp_colored_textured_rect;
+
+/* Sprite drawn by `sgp_draw_sprites_instanced`, expanded into a rectangle by the vertex shader. */
+typedef struct sgp_sprite {
+    sgp_rect dst;           /* Destination rectangle, transformed by the current transform. */
+    sgp_rect src;           /* Source region of the texture, in pixels. */
+    sgp_color_ub4 color;    /* Color modulation, replaces the current state color. */
+    float rotation;         /* Rotation in radians around the destination rectangle center. */
+} sgp_sprite;
+
+/* Uniforms always have room for the 8 floats of the instanced sprites and transform programs,
+lower `SGP_UNIFORM_CONTENT_SLOTS` values only limit the uniforms of custom shaders. */
+#if SGP_UNIFORM_CONTENT_SLOTS < 8
+#define _SGP_UNIFORM_STORAGE_SLOTS 8
+#else
+#define _SGP_UNIFORM_STORAGE_SLOTS SGP_UNIFORM_CONTENT_SLOTS
+#endif
+
 typedef union sgp_uniform_data {
-    float floats[SGP_UNIFORM_CONTENT_SLOTS];
-    uint8_t bytes[SGP_UNIFORM_CONTENT_SLOTS * sizeof(float)];
+    float floats[_SGP_UNIFORM_STORAGE_SLOTS];
+    uint8_t bytes[_SGP_UNIFORM_STORAGE_SLOTS * sizeof(float)];
 } sgp_uniform_data;
 
 typedef struct sgp_uniform {
@@ -535,6 +750,46 @@ typedef struct sgp_textures_uniform {
     sg_sampler samplers[SGP_TEXTURE_SLOTS];
 } sgp_textures_uniform;
 
+/* SGP statistics of a draw command queue, useful to tune the batch optimizer. */
+typedef struct sgp_stats {
+    uint32_t num_queued_draws;          /* Number of draws queued, before batching. */
+    uint32_t num_culled_draws;          /* Number of draws skipped for being out of the screen, not counted as queued. */
+    uint32_t num_merged_prev;           /* Number of draws merged into a previous draw command. */
+    uint32_t num_merged_next;           /* Number of draws merged by moving a previous draw command forward. */
+    uint32_t num_moved_bytes;           /* Number of vertex bytes moved in memory while rearranging batches. */
+    uint32_t num_merged_sorted;         /* Number of draw commands merged after sorting them when flushing, see `sorted_batching`. */
+    uint32_t num_merged_textures;       /* Number of draw commands packed with draws of other textures when flushing, see `multi_texture_batching`. */
+    uint32_t num_reused_uniforms;       /* Number of uniforms deduplicated by reusing the previous uniform. */
+    uint32_t num_pipeline_applies;      /* Number of pipelines applied when flushing. */
+    uint32_t num_bindings_applies;      /* Number of bindings applied when flushing. */
+    uint32_t num_bindings_by_pipeline;  /* Bindings applied only because the pipeline or the instanced sprites changed, with the same textures. */
+    uint32_t num_bindings_by_textures;  /* Bindings applied because a texture slot changed. */
+    uint32_t num_uniforms_applies;      /* Number of uniforms applied when flushing. */
+    uint32_t num_viewport_applies;      /* Number of viewports applied when flushing. */
+    uint32_t num_scissor_applies;       /* Number of scissor rects applied when flushing. */
+    uint32_t num_draw_calls;            /* Number of draw calls issued when flushing. */
+    uint32_t num_uploaded_vertices;     /* Number of vertices uploaded when flushing. */
+    uint32_t num_compact_vertices;      /* Number of vertices uploaded packed as compact vertices, see `compact_vertices`. */
+    uint32_t num_uploaded_sprites;      /* Number of instanced sprites uploaded when flushing. */
+    /* CPU time in nanoseconds spent in each Sokol GFX call type when flushing, only measured when SGP_FLUSH_TIMING is defined. */
+    uint64_t upload_ns;
+    uint64_t pipeline_ns;
+    uint64_t bindings_ns;
+    uint64_t uniforms_ns;
+    uint64_t viewport_ns;
+    uint64_t scissor_ns;
+    uint64_t draw_ns;
+} sgp_stats;
+
+/* Highest number of vertices, commands, uniforms and sprites queued at once since setup, useful to size `sgp_desc`.
+   A mark above the capacity means a frame ran out of space and some draws were dropped. */
+typedef struct sgp_high_water_marks {
+    uint32_t num_vertices;
+    uint32_t num_commands;
+    uint32_t num_uniforms;
+    uint32_t num_sprites;
+} sgp_high_water_marks;
+
 /* SGP draw state. */
 typedef struct sgp_state {
     sgp_isize frame_size;
@@ -549,18 +804,75 @@ typedef struct sgp_state {
     sgp_uniform uniform;
     sgp_blend_mode blend_mode;
     sg_pipeline pipeline;
+    bool gpu_transform;
+    uint32_t batch_optimizer_depth;
+    uint32_t batch_optimizer_max_move_vertices;
     uint32_t _base_vertex;
     uint32_t _base_uniform;
     uint32_t _base_command;
+    uint32_t _base_sprite;
+    sgp_stats _stats;
 } sgp_state;
 
+/* Phase of a trace event. */
+typedef enum sgp_trace_phase {
+    SGP_TRACE_BEGIN = 0,
+    SGP_TRACE_END
+} sgp_trace_phase;
+
+/* Trace event emitted when SGP_TRACE is defined. */
+typedef struct sgp_trace_event {
+    const char* name;       /* Name of the traced scope, a static string. */
+    sgp_trace_phase phase;  /* Whether the scope begins or ends. */
+    uint64_t time_ns;       /* Monotonic timestamp in nanoseconds. */
+    uint32_t arg;           /* Scope argument on begin events, e.g. number of primitives or command index. */
+} sgp_trace_event;
+
+/* Callback that receives trace events. */
+typedef struct sgp_tracer {
+    void (*func)(const sgp_trace_event* event, void* user_data);
+    void* user_data;
+} sgp_tracer;
+
+/* Callback fired once, the first time a flushed frame uses more than a fraction of the vertices, commands, uniforms or sprites capacity. */
+typedef struct sgp_capacity_callback {
+    void (*func)(const sgp_high_water_marks* marks, void* user_data);
+    void* user_data;
+    float threshold;        /* Fraction of the capacity that triggers the callback, defaults to 0.9. */
+} sgp_capacity_callback;
+
+/* Task run by a dispatcher, `task_index` goes from 0 to the number of tasks minus one. */
+typedef void (*sgp_task_func)(void* task_data, uint32_t task_index);
+
+/* Callback that splits the vertex generation of large draws in tasks, to run them in worker threads. */
+typedef struct sgp_task_dispatcher {
+    void (*func)(sgp_task_func task, void* task_data, uint32_t num_tasks, void* user_data); /* Runs all tasks, possibly in parallel, and returns when they are finished. */
+    void* user_data;
+    uint32_t min_vertices;  /* Minimum number of vertices generated by a draw to split it in tasks, defaults to 65536. */
+    uint32_t max_tasks;     /* Maximum number of tasks a draw is split into, defaults to 8, up to 64. */
+} sgp_task_dispatcher;
+
+/* Value of `batch_optimizer_depth` and `batch_optimizer_max_move_vertices` in `sgp_desc` that sets them to 0, as 0 means the default. */
+#define SGP_BATCH_OPTIMIZER_OFF UINT32_MAX
+
 /* Structure that defines SGP setup parameters. */
 typedef struct sgp_desc {
     uint32_t max_vertices;
     uint32_t max_commands;
+    uint32_t max_sprites;         /* Maximum number of sprites drawn with `sgp_draw_sprites_instanced` per frame, defaults to 16384. */
     sg_pixel_format color_format; /* Color format for creating pipelines, defaults to the same as the Sokol GFX context. */
     sg_pixel_format depth_format; /* Depth format for creating pipelines, defaults to the same as the Sokol GFX context. */
     int sample_count;             /* Sample count for creating pipelines, defaults to the same as the Sokol GFX context. */
+    uint32_t batch_optimizer_depth;             /* Number of draw commands the batch optimizer looks back at, defaults to SGP_BATCH_OPTIMIZER_DEPTH, SGP_BATCH_OPTIMIZER_OFF disables it. */
+    uint32_t batch_optimizer_max_move_vertices; /* Maximum vertices moved in memory per merge, defaults to SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES, SGP_BATCH_OPTIMIZER_OFF never moves vertices. */
+    sgp_tracer tracer;            /* Receives trace events of recording and flushing, only used when SGP_TRACE is defined. */
+    sgp_capacity_callback capacity_callback; /* Warns when frames get close to running out of vertices, commands, uniforms or sprites. */
+    sgp_task_dispatcher dispatcher; /* Generates the vertices of large rectangles, triangles and primitives draws in parallel tasks. */
+    bool grow_buffers;            /* Grow the vertices, commands, uniforms and sprites buffers when full instead of dropping draws, disabled by default. */
+    bool indexed_quads;           /* Draw rectangles with 4 vertices and a shared index buffer instead of 6 vertices, disabled by default. */
+    bool compact_vertices;        /* Upload 12 bytes vertices with 16 bit normalized positions and texture coordinates instead of 20 bytes on flushes where they fit, disabled by default. */
+    bool sorted_batching;         /* Reorder non overlapping draws by pipeline, textures and uniform when flushing, to batch more of them, disabled by default. */
+    bool multi_texture_batching;  /* Pack consecutive draws that differ only by their texture into draws binding up to 4 textures when flushing, disabled by default. */
 } sgp_desc;
 
 /* Structure that defines SGP custom pipeline creation parameters. */
@@ -574,11 +886,89 @@ typedef struct sgp_pipeline_desc {
     bool has_vs_color;                  /* If true, the current color state will be passed as an attribute to the vertex shader. */
 } sgp_pipeline_desc;
 
+/* Type of a resource referenced by a draw command capture. */
+typedef enum sgp_capture_resource_type {
+    SGP_CAPTURE_RESOURCE_IMAGE = 0,
+    SGP_CAPTURE_RESOURCE_SAMPLER,
+    SGP_CAPTURE_RESOURCE_PIPELINE
+} sgp_capture_resource_type;
+
+/* Resource referenced by a draw command capture. */
+typedef struct sgp_capture_resource {
+    sgp_capture_resource_type type;
+    uint32_t id;                        /* Sokol resource id at capture time, used as a stable identifier. */
+    bool builtin;                       /* Whether it is a SGP builtin resource, these are resolved automatically on replay. */
+    int width;                          /* Image width. */
+    int height;                         /* Image height. */
+    sg_pixel_format pixel_format;       /* Image pixel format. */
+    sg_primitive_type primitive_type;   /* Pipeline primitive type. */
+    sgp_blend_mode blend_mode;          /* Pipeline blend mode, only known for builtin pipelines. */
+    bool gpu_transform;                 /* Whether a builtin pipeline transforms local positions by its uniform, see `sgp_set_gpu_transform`. */
+} sgp_capture_resource;
+
+/* Information about a draw command capture. */
+typedef struct sgp_capture_info {
+    sgp_isize frame_size;
+    uint32_t num_resources;
+    uint32_t num_commands;
+    uint32_t num_vertices;
+    uint32_t num_uniforms;
+    uint32_t num_sprites;
+} sgp_capture_info;
+
+/* Structure that defines how to replay a draw command capture. */
+typedef struct sgp_replay_desc {
+    uint32_t (*resolve)(const sgp_capture_resource* resource, void* user_data); /* Returns the Sokol resource id to use for a non builtin captured resource. */
+    void* user_data;
+} sgp_replay_desc;
+
+/* Handle of a SGP context, with its own buffers and draw command queue. */
+typedef struct sgp_context {
+    uint32_t id;
+} sgp_context;
+
+/* Draw commands recorded apart from the draw command queue, possibly by another thread, see `sgp_begin_command_list`. */
+typedef struct sgp_command_list sgp_command_list;
+
+/* Structure that defines the initial capacity of a command list, its buffers grow when full. */
+typedef struct sgp_command_list_desc {
+    uint32_t max_vertices;  /* Initial vertices capacity, defaults to 4096. */
+    uint32_t max_commands;  /* Initial commands and uniforms capacity, defaults to 1024. */
+    uint32_t max_sprites;   /* Initial instanced sprites capacity, defaults to 1024. */
+} sgp_command_list_desc;
+
+/* Draws baked from a command list into an immutable vertex buffer, see `sgp_make_static_batch`. */
+typedef struct sgp_static_batch sgp_static_batch;
+
+/* Small images packed at runtime into a few large page images, see `sgp_make_atlas`. */
+typedef struct sgp_atlas sgp_atlas;
+
+/* Structure that defines the pages of an atlas, every page is a RGBA8 image. */
+typedef struct sgp_atlas_desc {
+    int page_width;     /* Width of the page images, defaults to 1024. */
+    int page_height;    /* Height of the page images, defaults to 1024. */
+    uint32_t max_pages; /* Maximum number of pages, created when the previous ones are full, defaults to 4. */
+    int padding;        /* Empty pixels kept between packed images, so linear filtering doesn't bleed across them. */
+} sgp_atlas_desc;
+
+/* Image packed into an atlas page, its image is invalid when it could not be packed. */
+typedef struct sgp_atlas_image {
+    sg_image image;     /* Page image to bind with `sgp_set_image`. */
+    sgp_rect src;       /* Source region of the packed image in its page, in pixels, as taken by `sgp_draw_textured_rects`. */
+} sgp_atlas_image;
+
 /* Initialization and de-initialization. */
 SOKOL_GP_API_DECL void sgp_setup(const sgp_desc* desc);                 /* Initializes the SGP context, and should be called after `sg_setup`. */
-SOKOL_GP_API_DECL void sgp_shutdown(void);                              /* Destroys the SGP context. */
+SOKOL_GP_API_DECL void sgp_shutdown(void);                              /* Destroys the default SGP context and every other context. */
 SOKOL_GP_API_DECL bool sgp_is_valid(void);                              /* Checks if SGP context is valid, should be checked after `sgp_setup`. */
 
+/* Multiple contexts, the current one is per thread and used by all the other functions. */
+SOKOL_GP_API_DECL sgp_context sgp_make_context(const sgp_desc* desc);   /* Creates another SGP context, its id is 0 when it fails. */
+SOKOL_GP_API_DECL void sgp_destroy_context(sgp_context ctx);            /* Destroys a context created with `sgp_make_context`. */
+SOKOL_GP_API_DECL void sgp_set_context(sgp_context ctx);                /* Makes a context current in the calling thread. */
+SOKOL_GP_API_DECL sgp_context sgp_get_context(void);                    /* Returns the current context of the calling thread. */
+SOKOL_GP_API_DECL sgp_context sgp_default_context(void);                /* Returns the default context, created by `sgp_setup`, which is current in new threads. */
+
 /* Error handling. */
 SOKOL_GP_API_DECL sgp_error sgp_get_last_error(void);                   /* Returns last SGP error. */
 SOKOL_GP_API_DECL const char* sgp_get_error_message(sgp_error error);   /* Returns a message with SGP error description. */
@@ -614,6 +1004,8 @@ SOKOL_GP_API_DECL void sgp_reset_uniform(void);                             /* R
 /* State change functions for the common pipelines. */
 SOKOL_GP_API_DECL void sgp_set_blend_mode(sgp_blend_mode blend_mode);       /* Sets current blend mode. */
 SOKOL_GP_API_DECL void sgp_reset_blend_mode(void);                          /* Resets current blend mode to default (no blending). */
+SOKOL_GP_API_DECL void sgp_set_gpu_transform(bool enabled);                 /* Sets whether vertices are kept in local space and transformed by the vertex shader. */
+SOKOL_GP_API_DECL void sgp_reset_gpu_transform(void);                       /* Resets vertices to be transformed on the CPU (default). */
 SOKOL_GP_API_DECL void sgp_set_color(float r, float g, float b, float a);   /* Sets current color modulation. */
 SOKOL_GP_API_DECL void sgp_reset_color(void);                               /* Resets current color modulation to default (white). */
 SOKOL_GP_API_DECL void sgp_set_image(int channel, sg_image image);          /* Sets current bound image in a texture channel. */
@@ -627,6 +1019,8 @@ SOKOL_GP_API_DECL void sgp_viewport(int x, int y, int w, int h);            /* S
 SOKOL_GP_API_DECL void sgp_reset_viewport(void);                            /* Reset viewport to default values (0, 0, width, height). */
 SOKOL_GP_API_DECL void sgp_scissor(int x, int y, int w, int h);             /* Set clip rectangle in the viewport. */
 SOKOL_GP_API_DECL void sgp_reset_scissor(void);                             /* Resets clip rectangle to default (viewport bounds). */
+SOKOL_GP_API_DECL void sgp_set_batch_optimizer(uint32_t depth, uint32_t max_move_vertices); /* Sets batch optimizer lookback depth and max vertices moved per merge, 0 depth disables it. */
+SOKOL_GP_API_DECL void sgp_reset_batch_optimizer(void);                     /* Resets batch optimizer settings to the ones in sgp_desc. */
 SOKOL_GP_API_DECL void sgp_reset_state(void);                               /* Reset all state to default values. */
 
 /* Drawing functions. */
@@ -644,10 +1038,51 @@ SOKOL_GP_API_DECL void sgp_draw_filled_rects(const sgp_rect* rects, uint32_t cou
 SOKOL_GP_API_DECL void sgp_draw_filled_rect(float x, float y, float w, float h);                                /* Draws a single rectangle. */
 SOKOL_GP_API_DECL void sgp_draw_textured_rects(int channel, const sgp_textured_rect* rects, uint32_t count);    /* Draws a batch textured rectangle, each from a source region. */
 SOKOL_GP_API_DECL void sgp_draw_textured_rect(int channel, sgp_rect dest_rect, sgp_rect src_rect);              /* Draws a single textured rectangle from a source region. */
+SOKOL_GP_API_DECL void sgp_draw_colored_rects(const sgp_colored_rect* rects, uint32_t count);                   /* Draws a batch of rectangles, each with its own color. */
+SOKOL_GP_API_DECL void sgp_draw_colored_textured_rects(int channel, const sgp_colored_textured_rect* rects, uint32_t count); /* Draws a batch of textured rectangles, each from a source region with its own color. */
+SOKOL_GP_API_DECL void sgp_draw_sprites_instanced(int channel, const sgp_sprite* sprites, uint32_t count);      /* Draws a batch of sprites with hardware instancing, each expanded into a textured rectangle by the GPU. */
 
 /* Querying functions. */
 SOKOL_GP_API_DECL sgp_state* sgp_query_state(void); /* Returns the current draw state. */
 SOKOL_GP_API_DECL sgp_desc sgp_query_desc(void);    /* Returns description of the current SGP context. */
+SOKOL_GP_API_DECL sgp_stats sgp_query_stats(void);  /* Returns statistics of the last flushed draw command queue. */
+SOKOL_GP_API_DECL sgp_high_water_marks sgp_query_high_water_marks(void); /* Returns the highest usage of vertices, commands, uniforms and sprites since setup. */
+
+/* Command capture and replay. */
+SOKOL_GP_API_DECL size_t sgp_capture(void* data, size_t size);  /* Serializes the draw commands queued since `sgp_begin`, returns the capture size, nothing is written when data is NULL or too small. */
+SOKOL_GP_API_DECL bool sgp_query_capture_info(const void* data, size_t size, sgp_capture_info* info); /* Retrieves information about a capture, returns false when it is invalid. */
+SOKOL_GP_API_DECL bool sgp_replay(const void* data, size_t size, const sgp_replay_desc* desc); /* Queues the draw commands of a capture, to be dispatched by `sgp_flush`. */
+
+/* Command lists, recorded by other threads and submitted to the draw command queue. */
+SOKOL_GP_API_DECL sgp_command_list* sgp_make_command_list(const sgp_command_list_desc* desc); /* Creates a command list for the current context, must be called from the thread that called `sgp_setup`. */
+SOKOL_GP_API_DECL void sgp_destroy_command_list(sgp_command_list* list);                      /* Destroys a command list, must not be recording. */
+SOKOL_GP_API_DECL void sgp_begin_command_list(sgp_command_list* list, int width, int height); /* Begins recording the draws of the calling thread into a command list, discarding its previous commands. */
+SOKOL_GP_API_DECL void sgp_end_command_list(void);                                            /* Ends recording into the command list of the calling thread. */
+SOKOL_GP_API_DECL void sgp_submit_command_list(const sgp_command_list* list);                 /* Appends the commands of a recorded command list to the draw command queue. */
+
+/* Static batches, draws uploaded once and transformed on the GPU every frame. */
+SOKOL_GP_API_DECL sgp_static_batch* sgp_make_static_batch(const sgp_command_list* list);      /* Bakes the draws recorded in a command list into a static batch, must be called from the thread that called `sgp_setup`. */
+SOKOL_GP_API_DECL void sgp_destroy_static_batch(sgp_static_batch* batch);                     /* Destroys a static batch and its vertex buffer. */
+SOKOL_GP_API_DECL void sgp_draw_static_batch(const sgp_static_batch* batch);                  /* Draws a static batch with the current transform, as if its draws were recorded again. */
+
+/* Texture atlases, packing small images at runtime so their draws can be batched together. */
+SOKOL_GP_API_DECL sgp_atlas* sgp_make_atlas(const sgp_atlas_desc* desc);                      /* Creates an empty atlas, its pages are created as images are added. */
+SOKOL_GP_API_DECL void sgp_destroy_atlas(sgp_atlas* atlas);                                   /* Destroys an atlas and its page images. */
+SOKOL_GP_API_DECL sgp_atlas_image sgp_atlas_add_image(sgp_atlas* atlas, int width, int height, const void* pixels); /* Packs a RGBA8 image into a page, it is visible after the next `sgp_atlas_upload`. */
+SOKOL_GP_API_DECL void sgp_atlas_upload(sgp_atlas* atlas);                                    /* Uploads the pages changed by added images, at most once per frame, before drawing with them. */
+SOKOL_GP_API_DECL sgp_rect sgp_atlas_src_rect(const sgp_atlas_image* image, sgp_rect src_rect); /* Offsets a source region of an added image into its page, to draw only part of it. */
+
+#ifdef SGP_TRACE
+/* Chrome trace JSON writer, can be loaded in chrome://tracing or Perfetto. */
+typedef struct sgp_chrome_trace {
+    FILE* file;
+    uint32_t num_events;
+} sgp_chrome_trace;
+
+SOKOL_GP_API_DECL void sgp_chrome_trace_begin(sgp_chrome_trace* trace, FILE* file); /* Starts writing a Chrome trace into a file. */
+SOKOL_GP_API_DECL void sgp_chrome_trace_end(sgp_chrome_trace* trace);               /* Finishes writing a Chrome trace, the file is not closed. */
+SOKOL_GP_API_DECL void sgp_chrome_trace_func(const sgp_trace_event* event, void* user_data); /* Tracer callback, user data must be a sgp_chrome_trace. */
+#endif
 
 #ifdef __cplusplus
 } // extern "C"
@@ -677,31 +1112,119 @@ SOKOL_GP_API_DECL sgp_desc sgp_query_desc(void);    /* Returns description of th
 #endif
 #endif
 
+#if defined(SGP_TRACE) || defined(SGP_FLUSH_TIMING)
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <mach/mach_time.h>
+#elif defined(__EMSCRIPTEN__)
+#include <emscripten/emscripten.h>
+#else
+#include <time.h>
+#endif
+#endif // SGP_TRACE || SGP_FLUSH_TIMING
+
+#if !defined(SGP_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define _SGP_SIMD_SSE2
+#include <emmintrin.h>
+#elif !defined(SGP_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64))
+#define _SGP_SIMD_NEON
+#include <arm_neon.h>
+#elif !defined(SGP_NO_SIMD) && defined(__wasm_simd128__)
+#define _SGP_SIMD_WASM
+#include <wasm_simd128.h>
+#endif
+
+#if defined(__cplusplus) && __cplusplus >= 201103L
+#define _SGP_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#define _SGP_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define _SGP_THREAD_LOCAL _Thread_local
+#else
+#define _SGP_THREAD_LOCAL __thread
+#endif
+
 #define _SGP_IMPOSSIBLE_ID 0xffffffffU
 
 enum {
     _SGP_INIT_COOKIE = 0xCAFED0D,
     _SGP_DEFAULT_MAX_VERTICES = 65536,
     _SGP_DEFAULT_MAX_COMMANDS = 16384,
-    _SGP_MAX_MOVE_VERTICES = 96,
-    _SGP_MAX_STACK_DEPTH = 64
+    _SGP_DEFAULT_MAX_SPRITES = 16384,
+    _SGP_DEFAULT_LIST_MAX_VERTICES = 4096,
+    _SGP_DEFAULT_LIST_MAX_COMMANDS = 1024,
+    _SGP_DEFAULT_LIST_MAX_SPRITES = 1024,
+    _SGP_MAX_RETIRED_BUFFERS = 8,
+    _SGP_MAX_STACK_DEPTH = 64,
+    _SGP_MAX_TASKS = 64,
+    _SGP_DEFAULT_TASK_MIN_VERTICES = 65536,
+    _SGP_DEFAULT_MAX_TASKS = 8,
+    _SGP_MERGE_GRID_SIZE = 16,
+    _SGP_MERGE_GRID_MAX_TILES = 16,
+    _SGP_MERGE_GRID_MIN_INTER_CMDS = 8,
+    _SGP_SORT_MIN_GRID_SIZE = 8,
+    _SGP_SORT_MAX_GRID_SIZE = 128,
+    _SGP_SORT_CELL_ENTRIES = 4,
+    _SGP_MULTI_TEXTURE_SLOTS = 4,
+    _SGP_VS_ATTR_TEXTURE_SLOT = 2,
+    _SGP_CONTEXT_SLOT_SHIFT = 16,
+    _SGP_CONTEXT_SLOT_MASK = (1 << _SGP_CONTEXT_SLOT_SHIFT) - 1,
+    _SGP_CAPTURE_MAGIC = 0x43504753, // "SGPC"
+    _SGP_CAPTURE_VERSION = 5
 };
 
 typedef struct _sgp_region {
     float x1, y1, x2, y2;
 } _sgp_region;
 
+// draw command being sorted, draws of the same layer and key are batched together
+typedef struct _sgp_sort_item {
+    uint32_t command;   // index of the draw command, keeps the order of draws in the same layer and key
+    uint32_t key;       // index of the first sorted draw with the same pipeline, textures and uniform
+    uint32_t layer;     // draws can't move before draws of lower layers
+} _sgp_sort_item;
+
+// draw touching a cell of the sort grid
+typedef struct _sgp_sort_entry {
+    _sgp_region region;
+    uint32_t layer;
+    uint32_t key;
+} _sgp_sort_entry;
+
+// cell of the grid over the screen used while sorting, it holds the draws of the highest layers touching it,
+// the others are folded into a floor that is assumed to overlap any draw touching the cell
+typedef struct _sgp_sort_cell {
+    uint32_t num_entries;
+    uint32_t floor_layer; // highest folded layer plus one, zero when no draw was folded
+    uint32_t floor_key;   // key of the folded draws of the highest layer, or _SGP_IMPOSSIBLE_ID when they differ
+} _sgp_sort_cell;
+
+// vertex uploaded when compact vertices are enabled, the position and texture coordinate are snorm16
+typedef struct _sgp_compact_vertex {
+    int16_t coord[4];
+    sgp_color_ub4 color;
+} _sgp_compact_vertex;
+
 typedef struct _sgp_draw_args {
     sg_pipeline pip;
     sgp_textures_uniform textures;
     _sgp_region region;
     uint32_t uniform_index;
-    uint32_t vertex_index;
-    uint32_t num_vertices;
+    uint32_t vertex_index; // first sprite of instanced draws
+    uint32_t num_vertices; // number of sprites of instanced draws
+    bool indexed; // quads drawn with the shared index buffer
+    sg_buffer vertex_buf; // vertex buffer of static batch draws
 } _sgp_draw_args;
 
 typedef union _sgp_command_args {
-    _sgp_draw_args draw;
+    _sgp_draw_args draw; // also used by instanced and static draws
     sgp_irect viewport;
     sgp_irect scissor;
 } _sgp_command_args;
@@ -710,7 +1233,9 @@ typedef enum _sgp_command_type {
     SGP_COMMAND_NONE = 0,
     SGP_COMMAND_DRAW,
     SGP_COMMAND_VIEWPORT,
-    SGP_COMMAND_SCISSOR
+    SGP_COMMAND_SCISSOR,
+    SGP_COMMAND_DRAW_INSTANCED,
+    SGP_COMMAND_DRAW_STATIC
 } _sgp_command_type;
 
 typedef struct _sgp_command {
@@ -718,6 +1243,35 @@ typedef struct _sgp_command {
     _sgp_command_args args;
 } _sgp_command;
 
+typedef struct _sgp_capture_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vertex_size;
+    uint32_t uniform_size;
+    uint32_t command_size;
+    uint32_t resource_size;
+    uint32_t sprite_size;
+    uint32_t texture_slots;
+    int32_t frame_width;
+    int32_t frame_height;
+    uint32_t num_resources;
+    uint32_t num_commands;
+    uint32_t num_vertices;
+    uint32_t num_uniforms;
+    uint32_t num_sprites;
+} _sgp_capture_header;
+
+#ifdef SGP_TRACE
+static const char* _sgp_command_names[] = {
+    "sgp_command_none",
+    "sgp_command_draw",
+    "sgp_command_viewport",
+    "sgp_command_scissor",
+    "sgp_command_draw_instanced",
+    "sgp_command_draw_static"
+};
+#endif
+
 typedef struct _sgp_context {
     uint32_t init_cookie;
     sgp_error last_error;
@@ -726,20 +1280,71 @@ typedef struct _sgp_context {
     // resources
     sg_shader shader;
     sg_buffer vertex_buf;
+    size_t vertex_buf_size;
+    sg_buffer index_buf;
+    sg_index_type index_type;
+    uint32_t index_buf_quads;
     sg_image white_img;
     sg_sampler nearest_smp;
     sg_pipeline pipelines[_SG_PRIMITIVETYPE_NUM * _SGP_BLENDMODE_NUM];
+    sg_pipeline quad_pipelines[_SGP_BLENDMODE_NUM];
+    sg_shader sprite_shader;
+    sg_buffer sprite_buf;
+    size_t sprite_buf_size;
+    sg_pipeline sprite_pipelines[_SGP_BLENDMODE_NUM];
+    sg_shader transform_shader;
+    sg_pipeline transform_pipelines[_SG_PRIMITIVETYPE_NUM * _SGP_BLENDMODE_NUM];
+    sg_shader multi_texture_shader;
+    sg_pipeline multi_texture_pipelines[_SG_PRIMITIVETYPE_NUM * _SGP_BLENDMODE_NUM];
+    sg_pipeline multi_texture_quad_pipelines[_SGP_BLENDMODE_NUM];
+    sg_buffer slot_buf;
+    size_t slot_buf_size;
 
     // command queue
     uint32_t cur_vertex;
     uint32_t cur_uniform;
     uint32_t cur_command;
+    uint32_t cur_sprite;
     uint32_t num_vertices;
     uint32_t num_uniforms;
     uint32_t num_commands;
+    uint32_t num_sprites;
     sgp_vertex* vertices;
     sgp_uniform* uniforms;
     _sgp_command* commands;
+    sgp_sprite* sprites;
+
+    // vertices packed on flush when compact vertices are enabled
+    _sgp_compact_vertex* compact_vertices;
+    uint32_t num_compact_vertices;
+
+    // texture slot of each vertex since the base vertex, written on flush when multi texture batching packs draws
+    float* vertex_slots;
+    uint32_t num_vertex_slots;
+
+    // batch optimizer scratch, indexes of intermediate commands
+    uint32_t* inter_cmds;
+    // tiles over the clip space with the index plus one of the last draw command touching them, or a higher one,
+    // except the last queued draw command, whose region still grows while draws are merged into it
+    uint32_t merge_grid[_SGP_MERGE_GRID_SIZE * _SGP_MERGE_GRID_SIZE];
+    uint32_t merge_grid_last; // index plus one of the last queued draw command, zero when there is none
+    uint32_t merge_grid_large; // index plus one of the last draw command touching too many tiles to be marked
+
+    // sorted batching scratch, grown on flush following the commands and vertices capacity
+    _sgp_sort_item* sort_items;
+    uint32_t* sort_keys;
+    uint32_t num_sort_keys;
+    _sgp_command* sort_commands;
+    uint32_t num_sort_commands;
+    sgp_vertex* sort_vertices;
+    uint32_t num_sort_vertices;
+    _sgp_sort_cell* sort_grid;
+    _sgp_sort_entry* sort_entries;
+
+    // buffers replaced while growing, destroyed on the next frame
+    sg_buffer retired_bufs[_SGP_MAX_RETIRED_BUFFERS];
+    uint32_t num_retired_bufs;
+    uint32_t retired_frame_index;
 
     // state tracking
     sgp_state state;
@@ -749,9 +1354,98 @@ typedef struct _sgp_context {
     uint32_t cur_state;
     sgp_mat2x3 transform_stack[_SGP_MAX_STACK_DEPTH];
     sgp_state state_stack[_SGP_MAX_STACK_DEPTH];
+
+    // statistics of the last flush
+    sgp_stats stats;
+
+    // capacity tracking
+    sgp_high_water_marks marks;
+    bool capacity_warned;
+
+    // command list recording, its commands are submitted to the context it was made from instead of flushed
+    bool command_list;
+    struct _sgp_context* owner_ctx;
+    struct _sgp_context* prev_ctx;
+    sgp_isize list_frame_size;
+    bool list_projected;
 } _sgp_context;
 
-static _sgp_context _sgp;
+// parameters of a builtin pipeline, all 32 bits so keys compare with memcmp
+typedef struct _sgp_pipeline_key {
+    uint32_t shader_id;
+    uint32_t primitive_type;
+    uint32_t index_type;
+    uint32_t blend_mode;
+    uint32_t color_format;
+    uint32_t depth_format;
+    uint32_t sample_count;
+    uint32_t compact;
+} _sgp_pipeline_key;
+
+typedef struct _sgp_shared_pipeline {
+    _sgp_pipeline_key key;
+    sg_pipeline pip;
+} _sgp_shared_pipeline;
+
+// resources that every context uses the same way, made with the default context and destroyed with it
+typedef struct _sgp_shared_resources {
+    sg_shader shader;
+    sg_shader sprite_shader;
+    sg_shader transform_shader;
+    sg_shader multi_texture_shader;
+    sg_image white_img;
+    sg_sampler nearest_smp;
+    // builtin pipelines, contexts with the same formats use the same ones
+    _sgp_shared_pipeline* pipelines;
+    uint32_t num_pipelines;
+    uint32_t max_pipelines;
+} _sgp_shared_resources;
+
+struct sgp_command_list {
+    _sgp_context ctx;
+};
+
+// vertices are in the coordinates of the command list frame, its draws use the transform pipelines
+struct sgp_static_batch {
+    _sgp_context* owner_ctx;
+    sg_buffer vertex_buf;
+    _sgp_region region;
+    uint32_t num_draws;
+    _sgp_draw_args* draws;
+};
+
+// top edge of the packed images, the skyline spans the whole page width from left to right
+typedef struct _sgp_atlas_node {
+    int x, y, w;
+} _sgp_atlas_node;
+
+// pixels are kept on the CPU, since images can only be updated as a whole
+typedef struct _sgp_atlas_page {
+    sg_image image;
+    uint8_t* pixels;
+    _sgp_atlas_node* nodes;
+    int num_nodes;
+    bool dirty;
+    uint32_t upload_frame_index;
+} _sgp_atlas_page;
+
+struct sgp_atlas {
+    sgp_atlas_desc desc;
+    uint32_t num_pages;
+    _sgp_atlas_page* pages;
+};
+
+// every thread draws into the main context, unless it is recording a command list
+static _sgp_context _sgp_main_ctx;
+static _SGP_THREAD_LOCAL _sgp_context* _sgp_ctx = &_sgp_main_ctx;
+#define _sgp (*_sgp_ctx)
+
+// contexts made with sgp_make_context, the default one is always the first,
+// handle ids keep the slot index plus one in the lower bits and a generation counter in the upper bits
+static _sgp_context* _sgp_contexts[SGP_MAX_CONTEXTS] = {&_sgp_main_ctx};
+static uint32_t _sgp_context_ids[SGP_MAX_CONTEXTS] = {1};
+
+static _sgp_shared_resources _sgp_shared;
 
 static const sgp_mat2x3 _sgp_mat3_identity = {{
     {1.0f, 0.0f, 0.0f},
@@ -760,6 +1454,60 @@ static const sgp_mat2x3 _sgp_mat3_identity = {{
 
 static const sgp_color_ub4 _sgp_white_color = {255, 255, 255, 255};
 
+// every quad is made of 2 triangles from its 4 vertices, in the same order as non indexed rectangles
+static const uint32_t _sgp_quad_indices[6] = {0, 1, 2, 3, 0, 2};
+
+#if defined(SGP_TRACE) || defined(SGP_FLUSH_TIMING)
+static uint64_t _sgp_now_ns(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)freq.QuadPart);
+#elif defined(__APPLE__)
+    mach_timebase_info_data_t timebase;
+    mach_timebase_info(&timebase);
+    return mach_absolute_time() * timebase.numer / timebase.denom;
+#elif defined(__EMSCRIPTEN__)
+    return (uint64_t)(emscripten_get_now() * 1e6);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000 + (uint64_t)ts.tv_nsec;
+#endif
+}
+#endif // SGP_TRACE || SGP_FLUSH_TIMING
+
+#ifdef SGP_FLUSH_TIMING
+#define _SGP_FLUSH_TIMED(field, call) do { \
+    uint64_t _sgp_start_ns = _sgp_now_ns(); \
+    call; \
+    stats->field += _sgp_now_ns() - _sgp_start_ns; \
+} while(0)
+#else
+#define _SGP_FLUSH_TIMED(field, call) call
+#endif
+
+#ifdef SGP_TRACE
+
+static void _sgp_trace(const char* name, sgp_trace_phase phase, uint32_t arg) {
+    if (_sgp.desc.tracer.func) {
+        sgp_trace_event event;
+        event.name = name;
+        event.phase = phase;
+        event.time_ns = _sgp_now_ns();
+        event.arg = arg;
+        _sgp.desc.tracer.func(&event, _sgp.desc.tracer.user_data);
+    }
+}
+
+#define _SGP_TRACE_BEGIN(name, arg) _sgp_trace(name, SGP_TRACE_BEGIN, arg)
+#define _SGP_TRACE_END(name) _sgp_trace(name, SGP_TRACE_END, 0)
+#else
+#define _SGP_TRACE_BEGIN(name, arg)
+#define _SGP_TRACE_END(name)
+#endif // SGP_TRACE
+
 ////////////////////////////////////////////////////////////////////////////////
 // Shaders
 
@@ -1505,1519 +2253,7079 @@ static const uint8_t sgp_fs_source_wgsl[682] = {
     0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x66,0x72,0x61,0x67,0x43,0x6f,
     0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
+/*
+    #version 410
 
-////////////////////////////////////////////////////////////////////////////////
-
-static void _sgp_set_error(sgp_error error) {
-    _sgp.last_error = error;
-    SOKOL_LOG(sgp_get_error_message(error));
-}
-
-static sg_blend_state _sgp_blend_state(sgp_blend_mode blend_mode) {
-    sg_blend_state blend;
-    memset(&blend, 0, sizeof(sg_blend_state));
-    switch (blend_mode) {
-        case SGP_BLENDMODE_NONE:
-            blend.enabled = false;
-            blend.src_factor_rgb = SG_BLENDFACTOR_ONE;
-            blend.dst_factor_rgb = SG_BLENDFACTOR_ZERO;
-            blend.op_rgb = SG_BLENDOP_ADD;
-            blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
-            blend.dst_factor_alpha = SG_BLENDFACTOR_ZERO;
-            blend.op_alpha = SG_BLENDOP_ADD;
-            break;
-        case SGP_BLENDMODE_BLEND:
-            blend.enabled = true;
-            blend.src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA;
-            blend.dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-            blend.op_rgb = SG_BLENDOP_ADD;
-            blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
-            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-            blend.op_alpha = SG_BLENDOP_ADD;
-            break;
-        case SGP_BLENDMODE_BLEND_PREMULTIPLIED:
-            blend.enabled = true;
-            blend.src_factor_rgb = SG_BLENDFACTOR_ONE;
-            blend.dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-            blend.op_rgb = SG_BLENDOP_ADD;
-            blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
-            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-            blend.op_alpha = SG_BLENDOP_ADD;
-            break;
-        case SGP_BLENDMODE_ADD:
-            blend.enabled = true;
-            blend.src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA;
-            blend.dst_factor_rgb = SG_BLENDFACTOR_ONE;
-            blend.op_rgb = SG_BLENDOP_ADD;
-            blend.src_factor_alpha = SG_BLENDFACTOR_ZERO;
-            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE;
-            blend.op_alpha = SG_BLENDOP_ADD;
-            break;
-        case SGP_BLENDMODE_ADD_PREMULTIPLIED:
-            blend.enabled = true;
-            blend.src_factor_rgb = SG_BLENDFACTOR_ONE;
-            blend.dst_factor_rgb = SG_BLENDFACTOR_ONE;
-            blend.op_rgb = SG_BLENDOP_ADD;
-            blend.src_factor_alpha = SG_BLENDFACTOR_ZERO;
-            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE;
-            blend.op_alpha = SG_BLENDOP_ADD;
-            break;
-        case SGP_BLENDMODE_MOD:
-            blend.enabled = true;
-            blend.src_factor_rgb = SG_BLENDFACTOR_DST_COLOR;
-            blend.dst_factor_rgb = SG_BLENDFACTOR_ZERO;
-            blend.op_rgb = SG_BLENDOP_ADD;
-            blend.src_factor_alpha = SG_BLENDFACTOR_ZERO;
-            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE;
-            blend.op_alpha = SG_BLENDOP_ADD;
-            break;
-        case SGP_BLENDMODE_MUL:
-            blend.enabled = true;
-            blend.src_factor_rgb = SG_BLENDFACTOR_DST_COLOR;
-            blend.dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-            blend.op_rgb = SG_BLENDOP_ADD;
-            blend.src_factor_alpha = SG_BLENDFACTOR_DST_ALPHA;
-            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-            blend.op_alpha = SG_BLENDOP_ADD;
-            break;
-        default:
-            blend.enabled = false;
-            blend.src_factor_rgb = SG_BLENDFACTOR_ONE;
-            blend.dst_factor_rgb = SG_BLENDFACTOR_ZERO;
-            blend.op_rgb = SG_BLENDOP_ADD;
-            blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
-            blend.dst_factor_alpha = SG_BLENDFACTOR_ZERO;
-            blend.op_alpha = SG_BLENDOP_ADD;
-            SOKOL_UNREACHABLE;
-            break;
-    }
-    return blend;
-}
+    uniform vec4 sprite_params[2];
+    layout(location = 0) in vec4 dst_rect;
+    layout(location = 3) in float rotation;
+    layout(location = 1) in vec4 src_rect;
+    layout(location = 0) out vec2 texUV;
+    layout(location = 1) out vec4 iColor;
+    layout(location = 2) in vec4 color;
 
-static sg_pipeline _sgp_make_pipeline(sg_shader shader, sg_primitive_type primitive_type, sgp_blend_mode blend_mode,
-                                      sg_pixel_format color_format, sg_pixel_format depth_format, int sample_count, bool has_vs_color) {
-    // create pipeline
-    sg_pipeline_desc pip_desc;
-    memset(&pip_desc, 0, sizeof(sg_pipeline_desc));
-    pip_desc.shader = shader;
-    pip_desc.layout.buffers[0].stride = sizeof(sgp_vertex);
-    pip_desc.layout.attrs[SGP_VS_ATTR_COORD].offset = offsetof(sgp_vertex, position);
-    pip_desc.layout.attrs[SGP_VS_ATTR_COORD].format = SG_VERTEXFORMAT_FLOAT4;
-    if (has_vs_color) {
-        pip_desc.layout.attrs[SGP_VS_ATTR_COLOR].offset = offsetof(sgp_vertex, color);
-        pip_desc.layout.attrs[SGP_VS_ATTR_COLOR].format = SG_VERTEXFORMAT_UBYTE4N;
+    void main()
+    {
+        vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+        vec2 half_size = dst_rect.zw * 0.5;
+        vec2 p = (corner * dst_rect.zw) - half_size;
+        float s = sin(rotation);
+        float c = cos(rotation);
+        vec3 pos = vec3(((p.x * c) - (p.y * s)) + (dst_rect.x + half_size.x), ((p.x * s) + (p.y * c)) + (dst_rect.y + half_size.y), 1.0);
+        gl_Position = vec4(dot(sprite_params[0].xyz, pos), dot(sprite_params[1].xyz, pos), 0.0, 1.0);
+        texUV = (src_rect.xy + (corner * src_rect.zw)) * vec2(sprite_params[0].w, sprite_params[1].w);
+        iColor = color;
     }
-    pip_desc.sample_count = sample_count;
-    pip_desc.depth.pixel_format = depth_format;
-    pip_desc.colors[0].pixel_format = color_format;
-    pip_desc.colors[0].blend = _sgp_blend_state(blend_mode);
-    pip_desc.primitive_type = primitive_type;
 
-    sg_pipeline pip = sg_make_pipeline(&pip_desc);
-    if (pip.id != SG_INVALID_ID && sg_query_pipeline_state(pip) != SG_RESOURCESTATE_VALID) {
-        sg_destroy_pipeline(pip);
-        pip.id = SG_INVALID_ID;
-    }
-    return pip;
-}
+*/
+static const uint8_t sgp_vs_sprite_source_glsl410[864] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x70,0x72,0x69,0x74,
+    0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,
+    0x63,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,
+    0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,
+    0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x26,0x20,0x31,0x29,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,
+    0x44,0x20,0x3e,0x3e,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x64,
+    0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x28,
+    0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,
+    0x74,0x2e,0x7a,0x77,0x29,0x20,0x2d,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,0x3d,
+    0x20,0x73,0x69,0x6e,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x20,0x3d,0x20,0x63,0x6f,
+    0x73,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x63,0x29,0x20,0x2d,0x20,0x28,0x70,
+    0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,0x29,0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,
+    0x72,0x65,0x63,0x74,0x2e,0x78,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,
+    0x7a,0x65,0x2e,0x78,0x29,0x2c,0x20,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x73,
+    0x29,0x20,0x2b,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x63,0x29,0x29,0x20,0x2b,
+    0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x79,0x20,0x2b,0x20,0x68,
+    0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x79,0x29,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,0x28,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,
+    0x20,0x28,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,
+    0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,
+    0x63,0x74,0x2e,0x7a,0x77,0x29,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x28,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,
+    0x77,0x2c,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x5d,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
 
-static sg_pipeline _sgp_lookup_pipeline(sg_primitive_type primitive_type, sgp_blend_mode blend_mode) {
-    uint32_t pip_index = (primitive_type * _SGP_BLENDMODE_NUM) + blend_mode;
-    if (_sgp.pipelines[pip_index].id != SG_INVALID_ID) {
-        return _sgp.pipelines[pip_index];
-    }
+    uniform vec4 sprite_params[2];
+    layout(location = 0) in vec4 dst_rect;
+    layout(location = 3) in float rotation;
+    layout(location = 1) in vec4 src_rect;
+    out vec2 texUV;
+    out vec4 iColor;
+    layout(location = 2) in vec4 color;
 
-    sg_pipeline pip = _sgp_make_pipeline(_sgp.shader, primitive_type, blend_mode, _sgp.desc.color_format, _sgp.desc.depth_format, _sgp.desc.sample_count, true);
-    if (pip.id != SG_INVALID_ID) {
-        _sgp.pipelines[pip_index] = pip;
+    void main()
+    {
+        vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+        vec2 half_size = dst_rect.zw * 0.5;
+        vec2 p = (corner * dst_rect.zw) - half_size;
+        float s = sin(rotation);
+        float c = cos(rotation);
+        vec3 pos = vec3(((p.x * c) - (p.y * s)) + (dst_rect.x + half_size.x), ((p.x * s) + (p.y * c)) + (dst_rect.y + half_size.y), 1.0);
+        gl_Position = vec4(dot(sprite_params[0].xyz, pos), dot(sprite_params[1].xyz, pos), 0.0, 1.0);
+        texUV = (src_rect.xy + (corner * src_rect.zw)) * vec2(sprite_params[0].w, sprite_params[1].w);
+        iColor = color;
     }
-    return pip;
-}
 
-static sg_shader _sgp_make_common_shader(void) {
-    sg_backend backend = sg_query_backend();
-    sg_shader_desc desc;
-    memset(&desc, 0, sizeof(desc));
-    desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
-    desc.images[0].multisampled = false;
-    desc.images[0].image_type = SG_IMAGETYPE_2D;
-    desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
-    desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
-    desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
-    desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
-    desc.image_sampler_pairs[0].image_slot = 0;
-    desc.image_sampler_pairs[0].sampler_slot = 0;
+*/
+static const uint8_t sgp_vs_sprite_source_glsl300es[825] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x64,0x73,0x74,
+    0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x72,0x63,0x5f,
+    0x72,0x65,0x63,0x74,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x74,
+    0x65,0x78,0x55,0x56,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x69,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,
+    0x49,0x44,0x20,0x26,0x20,0x31,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,
+    0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x3e,0x3e,0x20,0x31,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x61,0x6c,0x66,
+    0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,
+    0x2e,0x7a,0x77,0x20,0x2a,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,
+    0x2a,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x20,0x2d,
+    0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x72,0x6f,
+    0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x63,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x72,0x6f,0x74,0x61,0x74,
+    0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x28,0x28,0x70,0x2e,0x78,0x20,
+    0x2a,0x20,0x63,0x29,0x20,0x2d,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,
+    0x29,0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x20,
+    0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x2c,0x20,
+    0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x70,0x2e,
+    0x79,0x20,0x2a,0x20,0x63,0x29,0x29,0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,0x72,
+    0x65,0x63,0x74,0x2e,0x79,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,
+    0x65,0x2e,0x79,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x64,0x6f,0x74,0x28,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,
+    0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x28,0x73,0x72,0x63,0x5f,0x72,
+    0x65,0x63,0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x20,0x2a,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x29,
+    0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x28,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x2c,0x20,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x77,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    cbuffer sprite_params : register(b0)
+    {
+        float4 _19_mvp_x : packoffset(c0);
+        float4 _19_mvp_y : packoffset(c1);
+    };
 
-    // GLCORE / GLES3 only
-    desc.attrs[SGP_VS_ATTR_COORD].glsl_name = "coord";
-    desc.attrs[SGP_VS_ATTR_COLOR].glsl_name = "color";
-    desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
 
-    // D3D11 only
-    desc.attrs[SGP_VS_ATTR_COORD].hlsl_sem_name = "TEXCOORD";
-    desc.attrs[SGP_VS_ATTR_COORD].hlsl_sem_index = 0;
-    desc.attrs[SGP_VS_ATTR_COLOR].hlsl_sem_name = "TEXCOORD";
-    desc.attrs[SGP_VS_ATTR_COLOR].hlsl_sem_index = 1;
-    desc.vertex_func.d3d11_target = "vs_4_0";
-    desc.fragment_func.d3d11_target = "ps_4_0";
+    static float4 gl_Position;
+    static int gl_VertexIndex;
+    static float4 dst_rect;
+    static float rotation;
+    static float4 src_rect;
+    static float2 texUV;
+    static float4 iColor;
+    static float4 color;
 
-    // entry
-    switch (backend) {
-        case SG_BACKEND_METAL_MACOS:
-        case SG_BACKEND_METAL_IOS:
-        case SG_BACKEND_METAL_SIMULATOR:
-            desc.vertex_func.entry = "main0";
-            desc.fragment_func.entry = "main0";
-            break;
-        default:
-            desc.vertex_func.entry = "main";
-            desc.fragment_func.entry = "main";
-            break;
-    }
+    struct SPIRV_Cross_Input
+    {
+        float4 dst_rect : TEXCOORD0;
+        float4 src_rect : TEXCOORD1;
+        float4 color : TEXCOORD2;
+        float rotation : TEXCOORD3;
+        uint gl_VertexIndex : SV_VertexID;
+    };
 
-    // source
-    switch (backend) {
-        case SG_BACKEND_GLCORE:
-            desc.vertex_func.source = (const char*)sgp_vs_source_glsl410;
-            desc.fragment_func.source = (const char*)sgp_fs_source_glsl410;
+    struct SPIRV_Cross_Output
+    {
+        float2 texUV : TEXCOORD0;
+        float4 iColor : TEXCOORD1;
+        float4 gl_Position : SV_Position;
+    };
+
+    void vert_main()
+    {
+        float2 corner = float2(float(gl_VertexIndex & 1), float(gl_VertexIndex >> 1));
+        float2 half_size = dst_rect.zw * 0.5f;
+        float2 p = (corner * dst_rect.zw) - half_size;
+        float s = sin(rotation);
+        float c = cos(rotation);
+        float3 pos = float3(((p.x * c) - (p.y * s)) + (dst_rect.x + half_size.x), ((p.x * s) + (p.y * c)) + (dst_rect.y + half_size.y), 1.0f);
+        gl_Position = float4(dot(_19_mvp_x.xyz, pos), dot(_19_mvp_y.xyz, pos), 0.0f, 1.0f);
+        texUV = (src_rect.xy + (corner * src_rect.zw)) * float2(_19_mvp_x.w, _19_mvp_y.w);
+        iColor = color;
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        gl_VertexIndex = int(stage_input.gl_VertexIndex);
+        dst_rect = stage_input.dst_rect;
+        rotation = stage_input.rotation;
+        src_rect = stage_input.src_rect;
+        color = stage_input.color;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.texUV = texUV;
+        stage_output.iColor = iColor;
+        return stage_output;
+    }
+*/
+static const uint8_t sgp_vs_sprite_source_hlsl4[1677] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x5f,0x78,0x20,0x3a,0x20,0x70,0x61,
+    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,
+    0x5f,0x79,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x74,0x20,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x64,0x73,
+    0x74,0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x72,0x63,
+    0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x64,0x73,
+    0x74,0x5f,0x72,0x65,0x63,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,
+    0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,
+    0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x53,0x56,0x5f,
+    0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,
+    0x64,0x65,0x78,0x20,0x26,0x20,0x31,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3e,
+    0x3e,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x64,0x73,
+    0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x20,0x3d,
+    0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x64,0x73,0x74,0x5f,0x72,
+    0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x20,0x2d,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,
+    0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,
+    0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x20,0x3d,0x20,
+    0x63,0x6f,0x73,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x63,
+    0x29,0x20,0x2d,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,0x29,0x20,0x2b,
+    0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x20,0x2b,0x20,0x68,
+    0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x2c,0x20,0x28,0x28,0x70,
+    0x2e,0x78,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,
+    0x20,0x63,0x29,0x29,0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,
+    0x2e,0x79,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x79,
+    0x29,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x5f,0x78,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,
+    0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,
+    0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x28,0x73,
+    0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x63,0x6f,
+    0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,
+    0x7a,0x77,0x29,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x31,
+    0x39,0x5f,0x6d,0x76,0x70,0x5f,0x78,0x2e,0x77,0x2c,0x20,0x5f,0x31,0x39,0x5f,0x6d,
+    0x76,0x70,0x5f,0x79,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+    0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x28,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,
+    0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x20,0x3d,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,
+    0x63,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x72,0x63,
+    0x5f,0x72,0x65,0x63,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct sprite_params
+    {
+        float4 mvp_x;
+        float4 mvp_y;
+    };
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float4 gl_Position [[position]];
+    };
+
+    struct main0_in
+    {
+        float4 dst_rect [[attribute(0)]];
+        float4 src_rect [[attribute(1)]];
+        float4 color [[attribute(2)]];
+        float rotation [[attribute(3)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant sprite_params& _19 [[buffer(0)]], uint gl_VertexIndex [[vertex_id]])
+    {
+        main0_out out = {};
+        float2 corner = float2(float(int(gl_VertexIndex) & 1), float(int(gl_VertexIndex) >> 1));
+        float2 half_size = in.dst_rect.zw * 0.5;
+        float2 p = (corner * in.dst_rect.zw) - half_size;
+        float s = sin(in.rotation);
+        float c = cos(in.rotation);
+        float3 pos = float3(((p.x * c) - (p.y * s)) + (in.dst_rect.x + half_size.x), ((p.x * s) + (p.y * c)) + (in.dst_rect.y + half_size.y), 1.0);
+        out.gl_Position = float4(dot(_19.mvp_x.xyz, pos), dot(_19.mvp_y.xyz, pos), 0.0, 1.0);
+        out.texUV = (in.src_rect.xy + (corner * in.src_rect.zw)) * float2(_19.mvp_x.w, _19.mvp_y.w);
+        out.iColor = in.color;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_sprite_source_metal_macos[1221] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,0x5f,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,0x5f,
+    0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x72,0x63,0x5f,0x72,
+    0x65,0x63,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,
+    0x78,0x20,0x5b,0x5b,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,0x6e,0x74,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,
+    0x26,0x20,0x31,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,0x6e,0x74,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,
+    0x3e,0x3e,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x20,0x2a,0x20,
+    0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x20,0x3d,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x69,0x6e,
+    0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x20,0x2d,0x20,
+    0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x69,0x6e,0x2e,
+    0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x63,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x69,0x6e,0x2e,
+    0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x63,0x29,0x20,0x2d,0x20,
+    0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,
+    0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x20,0x2b,0x20,0x68,0x61,
+    0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x2c,0x20,0x28,0x28,0x70,0x2e,
+    0x78,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,
+    0x63,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,
+    0x63,0x74,0x2e,0x79,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,
+    0x2e,0x79,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,
+    0x6d,0x76,0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,
+    0x55,0x56,0x20,0x3d,0x20,0x28,0x69,0x6e,0x2e,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,
+    0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,
+    0x20,0x69,0x6e,0x2e,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,
+    0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x31,0x39,0x2e,0x6d,
+    0x76,0x70,0x5f,0x78,0x2e,0x77,0x2c,0x20,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,
+    0x79,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct sprite_params
+    {
+        float4 mvp_x;
+        float4 mvp_y;
+    };
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float4 gl_Position [[position]];
+    };
+
+    struct main0_in
+    {
+        float4 dst_rect [[attribute(0)]];
+        float4 src_rect [[attribute(1)]];
+        float4 color [[attribute(2)]];
+        float rotation [[attribute(3)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant sprite_params& _19 [[buffer(0)]], uint gl_VertexIndex [[vertex_id]])
+    {
+        main0_out out = {};
+        float2 corner = float2(float(int(gl_VertexIndex) & 1), float(int(gl_VertexIndex) >> 1));
+        float2 half_size = in.dst_rect.zw * 0.5;
+        float2 p = (corner * in.dst_rect.zw) - half_size;
+        float s = sin(in.rotation);
+        float c = cos(in.rotation);
+        float3 pos = float3(((p.x * c) - (p.y * s)) + (in.dst_rect.x + half_size.x), ((p.x * s) + (p.y * c)) + (in.dst_rect.y + half_size.y), 1.0);
+        out.gl_Position = float4(dot(_19.mvp_x.xyz, pos), dot(_19.mvp_y.xyz, pos), 0.0, 1.0);
+        out.texUV = (in.src_rect.xy + (corner * in.src_rect.zw)) * float2(_19.mvp_x.w, _19.mvp_y.w);
+        out.iColor = in.color;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_sprite_source_metal_ios[1221] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,0x5f,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,0x5f,
+    0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x72,0x63,0x5f,0x72,
+    0x65,0x63,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,
+    0x78,0x20,0x5b,0x5b,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,0x6e,0x74,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,
+    0x26,0x20,0x31,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,0x6e,0x74,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,
+    0x3e,0x3e,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x20,0x2a,0x20,
+    0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x20,0x3d,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x69,0x6e,
+    0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,0x20,0x2d,0x20,
+    0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x69,0x6e,0x2e,
+    0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x63,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x69,0x6e,0x2e,
+    0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x63,0x29,0x20,0x2d,0x20,
+    0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,
+    0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x20,0x2b,0x20,0x68,0x61,
+    0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x2c,0x20,0x28,0x28,0x70,0x2e,
+    0x78,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,
+    0x63,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x64,0x73,0x74,0x5f,0x72,0x65,
+    0x63,0x74,0x2e,0x79,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,
+    0x2e,0x79,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,
+    0x6d,0x76,0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,
+    0x55,0x56,0x20,0x3d,0x20,0x28,0x69,0x6e,0x2e,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,
+    0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,
+    0x20,0x69,0x6e,0x2e,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x29,
+    0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x31,0x39,0x2e,0x6d,
+    0x76,0x70,0x5f,0x78,0x2e,0x77,0x2c,0x20,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,
+    0x79,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct sprite_params {
+      /_ @offset(0) _/
+      mvp_x : vec4f,
+      /_ @offset(16) _/
+      mvp_y : vec4f,
+    }
+
+    var<private> gl_VertexIndex : i32;
+
+    var<private> dst_rect : vec4f;
+
+    var<private> rotation : f32;
+
+    var<private> src_rect : vec4f;
+
+    @group(0) @binding(0) var<uniform> x_19 : sprite_params;
+
+    var<private> gl_Position : vec4f;
+
+    var<private> texUV : vec2f;
+
+    var<private> iColor : vec4f;
+
+    var<private> color : vec4f;
+
+    fn main_1() {
+      let corner : vec2f = vec2f(f32((gl_VertexIndex & 1i)), f32((gl_VertexIndex >> 1u)));
+      let half_size : vec2f = (dst_rect.zw * 0.5f);
+      let p : vec2f = ((corner * dst_rect.zw) - half_size);
+      let s : f32 = sin(rotation);
+      let c : f32 = cos(rotation);
+      let pos : vec3f = vec3f((((p.x * c) - (p.y * s)) + (dst_rect.x + half_size.x)), (((p.x * s) + (p.y * c)) + (dst_rect.y + half_size.y)), 1.0f);
+      gl_Position = vec4f(dot(x_19.mvp_x.xyz, pos), dot(x_19.mvp_y.xyz, pos), 0.0f, 1.0f);
+      texUV = ((src_rect.xy + (corner * src_rect.zw)) * vec2f(x_19.mvp_x.w, x_19.mvp_y.w));
+      iColor = color;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      texUV_1 : vec2f,
+      @location(1)
+      iColor_1 : vec4f,
+    }
+
+    @vertex
+    fn main(@builtin(vertex_index) gl_VertexIndex_param : u32, @location(0) dst_rect_param : vec4f, @location(3) rotation_param : f32, @location(1) src_rect_param : vec4f, @location(2) color_param : vec4f) -> main_out {
+      gl_VertexIndex = bitcast<i32>(gl_VertexIndex_param);
+      dst_rect = dst_rect_param;
+      rotation = rotation_param;
+      src_rect = src_rect_param;
+      color = color_param;
+      main_1();
+      return main_out(gl_Position, texUV, iColor);
+    }
+
+*/
+static const uint8_t sgp_vs_sprite_source_wgsl[1655] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,
+    0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,
+    0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x76,0x70,0x5f,0x78,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x76,0x70,0x5f,0x79,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,
+    0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x69,0x33,0x32,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x64,0x73,0x74,
+    0x5f,0x72,0x65,0x63,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x72,0x6f,0x74,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x73,0x72,0x63,0x5f,0x72,
+    0x65,0x63,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x67,
+    0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
+    0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,
+    0x20,0x78,0x5f,0x31,0x39,0x20,0x3a,0x20,0x73,0x70,0x72,0x69,0x74,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,
+    0x61,0x74,0x65,0x3e,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,
+    0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x66,0x28,0x66,0x33,
+    0x32,0x28,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,
+    0x78,0x20,0x26,0x20,0x31,0x69,0x29,0x29,0x2c,0x20,0x66,0x33,0x32,0x28,0x28,0x67,
+    0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x20,0x3e,0x3e,
+    0x20,0x31,0x75,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x68,0x61,
+    0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,
+    0x3d,0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x20,0x2a,
+    0x20,0x30,0x2e,0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x70,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x28,0x28,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x20,0x2a,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,
+    0x29,0x20,0x2d,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x73,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,
+    0x73,0x69,0x6e,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x63,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x63,
+    0x6f,0x73,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,0x66,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,
+    0x20,0x63,0x29,0x20,0x2d,0x20,0x28,0x70,0x2e,0x79,0x20,0x2a,0x20,0x73,0x29,0x29,
+    0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x20,0x2b,
+    0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x29,0x2c,0x20,
+    0x28,0x28,0x28,0x70,0x2e,0x78,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x70,
+    0x2e,0x79,0x20,0x2a,0x20,0x63,0x29,0x29,0x20,0x2b,0x20,0x28,0x64,0x73,0x74,0x5f,
+    0x72,0x65,0x63,0x74,0x2e,0x79,0x20,0x2b,0x20,0x68,0x61,0x6c,0x66,0x5f,0x73,0x69,
+    0x7a,0x65,0x2e,0x79,0x29,0x29,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x28,0x64,0x6f,0x74,0x28,0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,
+    0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,
+    0x6f,0x74,0x28,0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,0x79,
+    0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,
+    0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,
+    0x28,0x28,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,
+    0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,
+    0x63,0x74,0x2e,0x7a,0x77,0x29,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x66,0x28,
+    0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x78,0x2e,0x77,0x2c,0x20,0x78,0x5f,
+    0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x77,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,
+    0x20,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,
+    0x56,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,
+    0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x76,0x65,0x72,0x74,
+    0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x29,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,
+    0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,
+    0x20,0x75,0x33,0x32,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
+    0x30,0x29,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x20,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x73,0x72,0x63,0x5f,0x72,
+    0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,
+    0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,
+    0x64,0x65,0x78,0x20,0x3d,0x20,0x62,0x69,0x74,0x63,0x61,0x73,0x74,0x3c,0x69,0x33,
+    0x32,0x3e,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,
+    0x78,0x5f,0x70,0x61,0x72,0x61,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x64,0x73,0x74,0x5f,
+    0x72,0x65,0x63,0x74,0x20,0x3d,0x20,0x64,0x73,0x74,0x5f,0x72,0x65,0x63,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x20,0x3d,
+    0x20,0x73,0x72,0x63,0x5f,0x72,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,
+    0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,
+    0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x2c,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 410
+
+    uniform vec4 transform_params[2];
+    layout(location = 0) in vec4 coord;
+    layout(location = 0) out vec2 texUV;
+    layout(location = 1) out vec4 iColor;
+    layout(location = 1) in vec4 color;
+
+    void main()
+    {
+        vec3 pos = vec3(coord.xy, 1.0);
+        gl_Position = vec4(dot(transform_params[0].xyz, pos), dot(transform_params[1].xyz, pos), 0.0, 1.0);
+        gl_PointSize = 1.0;
+        texUV = coord.zw;
+        iColor = color;
+    }
+
+*/
+static const uint8_t sgp_vs_transform_source_glsl410[420] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x72,0x61,0x6e,0x73,
+    0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6f,
+    0x72,0x64,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x33,0x28,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,
+    0x28,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,
+    0x64,0x6f,0x74,0x28,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,
+    0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,
+    0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    uniform vec4 transform_params[2];
+    layout(location = 0) in vec4 coord;
+    out vec2 texUV;
+    out vec4 iColor;
+    layout(location = 1) in vec4 color;
+
+    void main()
+    {
+        vec3 pos = vec3(coord.xy, 1.0);
+        gl_Position = vec4(dot(transform_params[0].xyz, pos), dot(transform_params[1].xyz, pos), 0.0, 1.0);
+        gl_PointSize = 1.0;
+        texUV = coord.zw;
+        iColor = color;
+    }
+
+*/
+static const uint8_t sgp_vs_transform_source_glsl300es[381] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,
+    0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x63,
+    0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,0x28,0x74,0x72,0x61,0x6e,0x73,0x66,
+    0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,
+    0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x74,0x72,0x61,
+    0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,
+    0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    cbuffer transform_params : register(b0)
+    {
+        float4 _19_mvp_x : packoffset(c0);
+        float4 _19_mvp_y : packoffset(c1);
+    };
+
+
+    static float4 gl_Position;
+    static float gl_PointSize;
+    static float4 coord;
+    static float2 texUV;
+    static float4 iColor;
+    static float4 color;
+
+    struct SPIRV_Cross_Input
+    {
+        float4 coord : TEXCOORD0;
+        float4 color : TEXCOORD1;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float2 texUV : TEXCOORD0;
+        float4 iColor : TEXCOORD1;
+        float4 gl_Position : SV_Position;
+    };
+
+    void vert_main()
+    {
+        float3 pos = float3(coord.xy, 1.0f);
+        gl_Position = float4(dot(_19_mvp_x.xyz, pos), dot(_19_mvp_y.xyz, pos), 0.0f, 1.0f);
+        gl_PointSize = 1.0f;
+        texUV = coord.zw;
+        iColor = color;
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        coord = stage_input.coord;
+        color = stage_input.color;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.texUV = texUV;
+        stage_output.iColor = iColor;
+        return stage_output;
+    }
+*/
+static const uint8_t sgp_vs_transform_source_hlsl4[1016] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,
+    0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x5f,0x78,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x5f,
+    0x6d,0x76,0x70,0x5f,0x79,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,
+    0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6f,0x72,0x64,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x66,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,
+    0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,
+    0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x5f,0x6d,0x76,0x70,
+    0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,
+    0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,
+    0x63,0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6f,0x72,0x64,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
+    0x74,0x2e,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x55,0x56,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x69,0x43,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct transform_params
+    {
+        float4 mvp_x;
+        float4 mvp_y;
+    };
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float4 gl_Position [[position]];
+        float gl_PointSize [[point_size]];
+    };
+
+    struct main0_in
+    {
+        float4 coord [[attribute(0)]];
+        float4 color [[attribute(1)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant transform_params& _19 [[buffer(0)]])
+    {
+        main0_out out = {};
+        float3 pos = float3(in.coord.xy, 1.0);
+        out.gl_Position = float4(dot(_19.mvp_x.xyz, pos), dot(_19.mvp_y.xyz, pos), 0.0, 1.0);
+        out.gl_PointSize = 1.0;
+        out.texUV = in.coord.zw;
+        out.iColor = in.color;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_transform_source_metal_macos[756] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,
+    0x5f,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,
+    0x76,0x70,0x5f,0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,
+    0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,
+    0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,
+    0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,
+    0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,
+    0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,
+    0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,
+    0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,
+    0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,
+    0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,
+    0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x69,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct transform_params
+    {
+        float4 mvp_x;
+        float4 mvp_y;
+    };
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float4 gl_Position [[position]];
+        float gl_PointSize [[point_size]];
+    };
+
+    struct main0_in
+    {
+        float4 coord [[attribute(0)]];
+        float4 color [[attribute(1)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant transform_params& _19 [[buffer(0)]])
+    {
+        main0_out out = {};
+        float3 pos = float3(in.coord.xy, 1.0);
+        out.gl_Position = float4(dot(_19.mvp_x.xyz, pos), dot(_19.mvp_y.xyz, pos), 0.0, 1.0);
+        out.gl_PointSize = 1.0;
+        out.texUV = in.coord.zw;
+        out.iColor = in.color;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_transform_source_metal_ios[756] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,0x76,0x70,
+    0x5f,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6d,
+    0x76,0x70,0x5f,0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,
+    0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,
+    0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,
+    0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,
+    0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,
+    0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,
+    0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,
+    0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x78,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,
+    0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,
+    0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,
+    0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x69,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct transform_params {
+      /_ @offset(0) _/
+      mvp_x : vec4f,
+      /_ @offset(16) _/
+      mvp_y : vec4f,
+    }
+
+    var<private> coord : vec4f;
+
+    @group(0) @binding(0) var<uniform> x_19 : transform_params;
+
+    var<private> gl_Position : vec4f;
+
+    var<private> texUV : vec2f;
+
+    var<private> iColor : vec4f;
+
+    var<private> color : vec4f;
+
+    fn main_1() {
+      let pos : vec3f = vec3f(coord.xy, 1.0f);
+      gl_Position = vec4f(dot(x_19.mvp_x.xyz, pos), dot(x_19.mvp_y.xyz, pos), 0.0f, 1.0f);
+      texUV = coord.zw;
+      iColor = color;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      texUV_1 : vec2f,
+      @location(1)
+      iColor_1 : vec4f,
+    }
+
+    @vertex
+    fn main(@location(0) coord_param : vec4f, @location(1) color_param : vec4f) -> main_out {
+      coord = coord_param;
+      color = color_param;
+      main_1();
+      return main_out(gl_Position, texUV, iColor);
+    }
+
+*/
+static const uint8_t sgp_vs_transform_source_wgsl[892] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x76,0x70,0x5f,0x78,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x31,0x36,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x6d,0x76,0x70,
+    0x5f,0x79,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x76,
+    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6f,0x72,
+    0x64,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,
+    0x75,0x70,0x28,0x30,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x30,
+    0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x78,
+    0x5f,0x31,0x39,0x20,0x3a,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
+    0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x70,0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x33,0x66,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x63,0x6f,0x6f,0x72,
+    0x64,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x28,0x64,0x6f,0x74,0x28,0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,
+    0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x64,0x6f,0x74,
+    0x28,0x78,0x5f,0x31,0x39,0x2e,0x6d,0x76,0x70,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,
+    0x20,0x70,0x6f,0x73,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x63,0x6f,
+    0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,
+    0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x28,0x30,0x29,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x5f,0x31,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x31,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,
+    0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x63,0x6f,0x6f,0x72,0x64,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x29,
+    0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,
+    0x20,0x63,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,
+    0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x2c,0x20,0x69,
+    0x43,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 410
+
+    layout(location = 0) in vec4 coord;
+    layout(location = 0) out vec2 texUV;
+    layout(location = 1) out vec4 iColor;
+    layout(location = 1) in vec4 color;
+    layout(location = 2) out float texSlot;
+    layout(location = 2) in float slot;
+
+    void main()
+    {
+        gl_Position = vec4(coord.xy, 0.0, 1.0);
+        gl_PointSize = 1.0;
+        texUV = coord.zw;
+        iColor = color;
+        texSlot = slot;
+    }
+
+*/
+static const uint8_t sgp_vs_multi_texture_source_glsl410[386] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6f,0x72,0x64,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x32,0x29,0x20,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,
+    0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,
+    0x78,0x53,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+/*
+    #version 410
+
+    uniform sampler2D iTexChannel0_iSmpChannel0;
+    uniform sampler2D iTexChannel1_iSmpChannel1;
+    uniform sampler2D iTexChannel2_iSmpChannel2;
+    uniform sampler2D iTexChannel3_iSmpChannel3;
+
+    layout(location = 0) in vec2 texUV;
+    layout(location = 2) in float texSlot;
+    layout(location = 0) out vec4 fragColor;
+    layout(location = 1) in vec4 iColor;
+
+    void main()
+    {
+        vec4 c0 = texture(iTexChannel0_iSmpChannel0, texUV);
+        vec4 c1 = texture(iTexChannel1_iSmpChannel1, texUV);
+        vec4 c2 = texture(iTexChannel2_iSmpChannel2, texUV);
+        vec4 c3 = texture(iTexChannel3_iSmpChannel3, texUV);
+        fragColor = ((texSlot < 0.5) ? c0 : ((texSlot < 1.5) ? c1 : ((texSlot < 2.5) ? c2 : c3))) * iColor;
+    }
+
+*/
+static const uint8_t sgp_fs_multi_texture_source_glsl410[699] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x5f,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,
+    0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x31,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,0x78,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x32,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x32,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x33,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,
+    0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x63,0x30,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x5f,0x69,0x53,
+    0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2c,0x20,0x74,0x65,0x78,0x55,
+    0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x31,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x31,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x31,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x32,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x5f,
+    0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x2c,0x20,0x74,0x65,
+    0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,
+    0x33,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,
+    0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x33,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,
+    0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x30,0x2e,0x35,0x29,0x20,
+    0x3f,0x20,0x63,0x30,0x20,0x3a,0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,
+    0x20,0x3c,0x20,0x31,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x31,0x20,0x3a,0x20,0x28,
+    0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x32,0x2e,0x35,0x29,0x20,
+    0x3f,0x20,0x63,0x32,0x20,0x3a,0x20,0x63,0x33,0x29,0x29,0x29,0x20,0x2a,0x20,0x69,
+    0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    layout(location = 0) in vec4 coord;
+    out vec2 texUV;
+    out vec4 iColor;
+    layout(location = 1) in vec4 color;
+    out float texSlot;
+    layout(location = 2) in float slot;
+
+    void main()
+    {
+        gl_Position = vec4(coord.xy, 0.0, 1.0);
+        gl_PointSize = 1.0;
+        texUV = coord.zw;
+        iColor = color;
+        texSlot = slot;
+    }
+
+*/
+static const uint8_t sgp_vs_multi_texture_source_glsl300es[326] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,
+    0x6f,0x72,0x64,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,
+    0x78,0x55,0x56,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,
+    0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,
+    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,
+    0x63,0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x73,0x6c,0x6f,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp sampler2D iTexChannel0_iSmpChannel0;
+    uniform highp sampler2D iTexChannel1_iSmpChannel1;
+    uniform highp sampler2D iTexChannel2_iSmpChannel2;
+    uniform highp sampler2D iTexChannel3_iSmpChannel3;
+
+    in highp vec2 texUV;
+    in highp float texSlot;
+    layout(location = 0) out highp vec4 fragColor;
+    in highp vec4 iColor;
+
+    void main()
+    {
+        highp vec4 c0 = texture(iTexChannel0_iSmpChannel0, texUV);
+        highp vec4 c1 = texture(iTexChannel1_iSmpChannel1, texUV);
+        highp vec4 c2 = texture(iTexChannel2_iSmpChannel2, texUV);
+        highp vec4 c3 = texture(iTexChannel3_iSmpChannel3, texUV);
+        fragColor = ((texSlot < 0.5) ? c0 : ((texSlot < 1.5) ? c1 : ((texSlot < 2.5) ? c2 : c3))) * iColor;
+    }
+
+*/
+static const uint8_t sgp_fs_multi_texture_source_glsl300es[757] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x30,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,0x78,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x31,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x31,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x54,0x65,
+    0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x32,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x5f,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,
+    0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x30,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x30,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,
+    0x6c,0x30,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x31,0x20,0x3d,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,
+    0x6e,0x65,0x6c,0x31,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x31,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x32,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x32,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,
+    0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x33,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,
+    0x6c,0x33,0x5f,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2c,
+    0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,
+    0x6f,0x74,0x20,0x3c,0x20,0x30,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x30,0x20,0x3a,
+    0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x31,0x2e,0x35,
+    0x29,0x20,0x3f,0x20,0x63,0x31,0x20,0x3a,0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,
+    0x6f,0x74,0x20,0x3c,0x20,0x32,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x32,0x20,0x3a,
+    0x20,0x63,0x33,0x29,0x29,0x29,0x20,0x2a,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    static float4 gl_Position;
+    static float gl_PointSize;
+    static float4 coord;
+    static float2 texUV;
+    static float4 iColor;
+    static float4 color;
+    static float texSlot;
+    static float slot;
+
+    struct SPIRV_Cross_Input
+    {
+        float4 coord : TEXCOORD0;
+        float4 color : TEXCOORD1;
+        float slot : TEXCOORD2;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float2 texUV : TEXCOORD0;
+        float4 iColor : TEXCOORD1;
+        float texSlot : TEXCOORD2;
+        float4 gl_Position : SV_Position;
+    };
+
+    void vert_main()
+    {
+        gl_Position = float4(coord.xy, 0.0f, 1.0f);
+        gl_PointSize = 1.0f;
+        texUV = coord.zw;
+        iColor = color;
+        texSlot = slot;
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        coord = stage_input.coord;
+        color = stage_input.color;
+        slot = stage_input.slot;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.texUV = texUV;
+        stage_output.iColor = iColor;
+        stage_output.texSlot = texSlot;
+        return stage_output;
+    }
+*/
+static const uint8_t sgp_vs_multi_texture_source_hlsl4[995] = {
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,
+    0x6f,0x74,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,
+    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6f,0x72,0x64,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,
+    0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x63,0x6f,0x6f,0x72,0x64,0x2e,
+    0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,
+    0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,
+    0x78,0x55,0x56,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,
+    0x3d,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
+    0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6f,0x72,
+    0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,
+    0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x00,
+};
+/*
+    Texture2D<float4> iTexChannel0 : register(t0);
+    SamplerState iSmpChannel0 : register(s0);
+    Texture2D<float4> iTexChannel1 : register(t1);
+    SamplerState iSmpChannel1 : register(s1);
+    Texture2D<float4> iTexChannel2 : register(t2);
+    SamplerState iSmpChannel2 : register(s2);
+    Texture2D<float4> iTexChannel3 : register(t3);
+    SamplerState iSmpChannel3 : register(s3);
+
+    static float2 texUV;
+    static float texSlot;
+    static float4 fragColor;
+    static float4 iColor;
+
+    struct SPIRV_Cross_Input
+    {
+        float2 texUV : TEXCOORD0;
+        float4 iColor : TEXCOORD1;
+        float texSlot : TEXCOORD2;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float4 fragColor : SV_Target0;
+    };
+
+    void frag_main()
+    {
+        float4 c0 = iTexChannel0.Sample(iSmpChannel0, texUV);
+        float4 c1 = iTexChannel1.Sample(iSmpChannel1, texUV);
+        float4 c2 = iTexChannel2.Sample(iSmpChannel2, texUV);
+        float4 c3 = iTexChannel3.Sample(iSmpChannel3, texUV);
+        fragColor = ((texSlot < 0.5f) ? c0 : ((texSlot < 1.5f) ? c1 : ((texSlot < 2.5f) ? c2 : c3))) * iColor;
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        texUV = stage_input.texUV;
+        texSlot = stage_input.texSlot;
+        iColor = stage_input.iColor;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.fragColor = fragColor;
+        return stage_output;
+    }
+*/
+static const uint8_t sgp_fs_multi_texture_source_hlsl4[1277] = {
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x20,0x3a,
+    0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x69,0x53,0x6d,0x70,
+    0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x69,0x54,0x65,0x78,0x43,
+    0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x74,0x31,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,
+    0x74,0x61,0x74,0x65,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x31,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x31,0x29,
+    0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,
+    0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x32,0x29,0x3b,
+    0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x69,0x53,
+    0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x32,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x69,0x54,0x65,
+    0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x74,0x33,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x33,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,
+    0x33,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,
+    0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x30,0x20,0x3d,
+    0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2e,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x30,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x31,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,
+    0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,
+    0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x2c,0x20,0x74,0x65,0x78,
+    0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x32,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x32,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x32,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x33,0x20,0x3d,0x20,0x69,
+    0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2e,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2c,
+    0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,
+    0x6f,0x74,0x20,0x3c,0x20,0x30,0x2e,0x35,0x66,0x29,0x20,0x3f,0x20,0x63,0x30,0x20,
+    0x3a,0x20,0x28,0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x31,0x2e,
+    0x35,0x66,0x29,0x20,0x3f,0x20,0x63,0x31,0x20,0x3a,0x20,0x28,0x28,0x74,0x65,0x78,
+    0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x32,0x2e,0x35,0x66,0x29,0x20,0x3f,0x20,0x63,
+    0x32,0x20,0x3a,0x20,0x63,0x33,0x29,0x29,0x29,0x20,0x2a,0x20,0x69,0x43,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x55,0x56,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float texSlot [[user(locn2)]];
+        float4 gl_Position [[position]];
+        float gl_PointSize [[point_size]];
+    };
+
+    struct main0_in
+    {
+        float4 coord [[attribute(0)]];
+        float4 color [[attribute(1)]];
+        float slot [[attribute(2)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]])
+    {
+        main0_out out = {};
+        out.gl_Position = float4(in.coord.xy, 0.0, 1.0);
+        out.gl_PointSize = 1.0;
+        out.texUV = in.coord.zw;
+        out.iColor = in.color;
+        out.texSlot = in.slot;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_multi_texture_source_metal_macos[659] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,
+    0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x5b,
+    0x5b,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,
+    0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,
+    0x2e,0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,
+    0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
+    0x2e,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,0x53,
+    0x6c,0x6f,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main0_out
+    {
+        float4 fragColor [[color(0)]];
+    };
+
+    struct main0_in
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float texSlot [[user(locn2)]];
+    };
+
+    fragment main0_out main0(main0_in in [[stage_in]], texture2d<float> iTexChannel0 [[texture(0)]], texture2d<float> iTexChannel1 [[texture(1)]], texture2d<float> iTexChannel2 [[texture(2)]], texture2d<float> iTexChannel3 [[texture(3)]], sampler iSmpChannel0 [[sampler(0)]], sampler iSmpChannel1 [[sampler(1)]], sampler iSmpChannel2 [[sampler(2)]], sampler iSmpChannel3 [[sampler(3)]])
+    {
+        main0_out out = {};
+        float4 c0 = iTexChannel0.sample(iSmpChannel0, in.texUV);
+        float4 c1 = iTexChannel1.sample(iSmpChannel1, in.texUV);
+        float4 c2 = iTexChannel2.sample(iSmpChannel2, in.texUV);
+        float4 c3 = iTexChannel3.sample(iSmpChannel3, in.texUV);
+        out.fragColor = ((in.texSlot < 0.5) ? c0 : ((in.texSlot < 1.5) ? c1 : ((in.texSlot < 2.5) ? c2 : c3))) * in.iColor;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_fs_multi_texture_source_metal_macos[1049] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,
+    0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x20,0x5b,
+    0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x54,
+    0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x5b,0x5b,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x33,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x20,
+    0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,
+    0x6e,0x65,0x6c,0x31,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x31,
+    0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x5b,
+    0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x33,0x29,0x5d,0x5d,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,
+    0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x30,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x30,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,
+    0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x31,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,
+    0x6c,0x31,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x31,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x32,
+    0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x2e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x32,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x33,0x20,0x3d,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2e,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,
+    0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x28,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,
+    0x30,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x30,0x20,0x3a,0x20,0x28,0x28,0x69,0x6e,
+    0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x31,0x2e,0x35,0x29,0x20,
+    0x3f,0x20,0x63,0x31,0x20,0x3a,0x20,0x28,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x53,
+    0x6c,0x6f,0x74,0x20,0x3c,0x20,0x32,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x32,0x20,
+    0x3a,0x20,0x63,0x33,0x29,0x29,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,0x43,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main0_out
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float texSlot [[user(locn2)]];
+        float4 gl_Position [[position]];
+        float gl_PointSize [[point_size]];
+    };
+
+    struct main0_in
+    {
+        float4 coord [[attribute(0)]];
+        float4 color [[attribute(1)]];
+        float slot [[attribute(2)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]])
+    {
+        main0_out out = {};
+        out.gl_Position = float4(in.coord.xy, 0.0, 1.0);
+        out.gl_PointSize = 1.0;
+        out.texUV = in.coord.zw;
+        out.iColor = in.color;
+        out.texSlot = in.slot;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_vs_multi_texture_source_metal_ios[659] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,
+    0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,0x53,0x69,0x7a,0x65,0x20,0x5b,
+    0x5b,0x70,0x6f,0x69,0x6e,0x74,0x5f,0x73,0x69,0x7a,0x65,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,
+    0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x63,0x6f,0x6f,0x72,0x64,
+    0x2e,0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x69,0x6e,0x74,
+    0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,
+    0x6f,0x6f,0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
+    0x2e,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x74,0x65,0x78,0x53,
+    0x6c,0x6f,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main0_out
+    {
+        float4 fragColor [[color(0)]];
+    };
+
+    struct main0_in
+    {
+        float2 texUV [[user(locn0)]];
+        float4 iColor [[user(locn1)]];
+        float texSlot [[user(locn2)]];
+    };
+
+    fragment main0_out main0(main0_in in [[stage_in]], texture2d<float> iTexChannel0 [[texture(0)]], texture2d<float> iTexChannel1 [[texture(1)]], texture2d<float> iTexChannel2 [[texture(2)]], texture2d<float> iTexChannel3 [[texture(3)]], sampler iSmpChannel0 [[sampler(0)]], sampler iSmpChannel1 [[sampler(1)]], sampler iSmpChannel2 [[sampler(2)]], sampler iSmpChannel3 [[sampler(3)]])
+    {
+        main0_out out = {};
+        float4 c0 = iTexChannel0.sample(iSmpChannel0, in.texUV);
+        float4 c1 = iTexChannel1.sample(iSmpChannel1, in.texUV);
+        float4 c2 = iTexChannel2.sample(iSmpChannel2, in.texUV);
+        float4 c3 = iTexChannel3.sample(iSmpChannel3, in.texUV);
+        out.fragColor = ((in.texSlot < 0.5) ? c0 : ((in.texSlot < 1.5) ? c1 : ((in.texSlot < 2.5) ? c2 : c3))) * in.iColor;
+        return out;
+    }
+
+*/
+static const uint8_t sgp_fs_multi_texture_source_metal_ios[1049] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,
+    0x65,0x78,0x55,0x56,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x3e,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x20,0x5b,
+    0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x54,
+    0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x5b,0x5b,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x33,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x20,
+    0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,
+    0x6e,0x65,0x6c,0x31,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x31,
+    0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x5b,
+    0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x33,0x29,0x5d,0x5d,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,
+    0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x30,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x30,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,
+    0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,
+    0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x31,0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,
+    0x6c,0x31,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,
+    0x61,0x6e,0x6e,0x65,0x6c,0x31,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x32,
+    0x20,0x3d,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x2e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,
+    0x65,0x6c,0x32,0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x33,0x20,0x3d,0x20,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2e,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x28,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,
+    0x2c,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x28,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,
+    0x30,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x30,0x20,0x3a,0x20,0x28,0x28,0x69,0x6e,
+    0x2e,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3c,0x20,0x31,0x2e,0x35,0x29,0x20,
+    0x3f,0x20,0x63,0x31,0x20,0x3a,0x20,0x28,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x53,
+    0x6c,0x6f,0x74,0x20,0x3c,0x20,0x32,0x2e,0x35,0x29,0x20,0x3f,0x20,0x63,0x32,0x20,
+    0x3a,0x20,0x63,0x33,0x29,0x29,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,0x43,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    var<private> coord : vec4f;
+
+    var<private> texUV : vec2f;
+
+    var<private> iColor : vec4f;
+
+    var<private> color : vec4f;
+
+    var<private> texSlot : f32;
+
+    var<private> slot : f32;
+
+    var<private> gl_Position : vec4f;
+
+    fn main_1() {
+      gl_Position = vec4f(coord.xy, 0.0f, 1.0f);
+      texUV = coord.zw;
+      iColor = color;
+      texSlot = slot;
+      return;
+    }
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      texUV_1 : vec2f,
+      @location(1)
+      iColor_1 : vec4f,
+      @location(2)
+      texSlot_1 : f32,
+    }
+
+    @vertex
+    fn main(@location(0) coord_param : vec4f, @location(1) color_param : vec4f, @location(2) slot_param : f32) -> main_out {
+      coord = coord_param;
+      color = color_param;
+      slot = slot_param;
+      main_1();
+      return main_out(gl_Position, texUV, iColor, texSlot);
+    }
+
+*/
+static const uint8_t sgp_vs_multi_texture_source_wgsl[812] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6f,0x72,0x64,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,
+    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,
+    0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,
+    0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x74,0x65,0x78,0x53,0x6c,
+    0x6f,0x74,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,
+    0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x73,0x6c,0x6f,0x74,0x20,0x3a,0x20,0x66,
+    0x33,0x32,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,
+    0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x63,0x6f,0x6f,0x72,
+    0x64,0x2e,0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,
+    0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x63,0x6f,0x6f,
+    0x72,0x64,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x53,0x6c,
+    0x6f,0x74,0x20,0x3d,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,
+    0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x74,0x65,0x78,0x55,0x56,0x5f,0x31,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x0a,0x20,0x20,0x74,0x65,0x78,0x53,
+    0x6c,0x6f,0x74,0x5f,0x31,0x20,0x3a,0x20,0x66,0x33,0x32,0x2c,0x0a,0x7d,0x0a,0x0a,
+    0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x63,0x6f,0x6f,
+    0x72,0x64,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,
+    0x20,0x73,0x6c,0x6f,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x66,0x33,
+    0x32,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,
+    0x0a,0x20,0x20,0x63,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x63,0x6f,0x6f,0x72,0x64,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,
+    0x20,0x73,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x73,0x6c,0x6f,0x74,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,
+    0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x74,
+    0x65,0x78,0x55,0x56,0x2c,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x74,0x65,
+    0x78,0x53,0x6c,0x6f,0x74,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    diagnostic(off, derivative_uniformity);
+
+    @group(1) @binding(64) var iTexChannel0 : texture_2d<f32>;
+
+    @group(1) @binding(80) var iSmpChannel0 : sampler;
+
+    @group(1) @binding(65) var iTexChannel1 : texture_2d<f32>;
+
+    @group(1) @binding(81) var iSmpChannel1 : sampler;
+
+    @group(1) @binding(66) var iTexChannel2 : texture_2d<f32>;
+
+    @group(1) @binding(82) var iSmpChannel2 : sampler;
+
+    @group(1) @binding(67) var iTexChannel3 : texture_2d<f32>;
+
+    @group(1) @binding(83) var iSmpChannel3 : sampler;
+
+    var<private> texUV : vec2f;
+
+    var<private> texSlot : f32;
+
+    var<private> fragColor : vec4f;
+
+    var<private> iColor : vec4f;
+
+    fn main_1() {
+      let c0 : vec4f = textureSample(iTexChannel0, iSmpChannel0, texUV);
+      let c1 : vec4f = textureSample(iTexChannel1, iSmpChannel1, texUV);
+      let c2 : vec4f = textureSample(iTexChannel2, iSmpChannel2, texUV);
+      let c3 : vec4f = textureSample(iTexChannel3, iSmpChannel3, texUV);
+      fragColor = (select(c0, select(c1, select(c2, c3, (texSlot >= 2.5f)), (texSlot >= 1.5f)), (texSlot >= 0.5f)) * iColor);
+      return;
+    }
+
+    struct main_out {
+      @location(0)
+      fragColor_1 : vec4f,
+    }
+
+    @fragment
+    fn main(@location(0) texUV_param : vec2f, @location(1) iColor_param : vec4f, @location(2) texSlot_param : f32) -> main_out {
+      texUV = texUV_param;
+      iColor = iColor_param;
+      texSlot = texSlot_param;
+      main_1();
+      return main_out(fragColor);
+    }
+
+*/
+static const uint8_t sgp_fs_multi_texture_source_wgsl[1350] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x34,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,
+    0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,
+    0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x38,0x30,0x29,0x20,0x76,0x61,0x72,0x20,
+    0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x20,0x3a,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x35,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,
+    0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,
+    0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x38,0x31,0x29,0x20,0x76,0x61,0x72,0x20,
+    0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,0x20,0x3a,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x36,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,
+    0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,
+    0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x38,0x32,0x29,0x20,0x76,0x61,0x72,0x20,
+    0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x20,0x3a,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x37,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,
+    0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,
+    0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x38,0x33,0x29,0x20,0x76,0x61,0x72,0x20,
+    0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x20,0x3a,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
+    0x76,0x61,0x74,0x65,0x3e,0x20,0x74,0x65,0x78,0x55,0x56,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
+    0x65,0x3e,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3a,0x20,0x66,0x33,0x32,
+    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
+    0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,
+    0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x63,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2c,0x20,0x69,
+    0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x30,0x2c,0x20,0x74,0x65,0x78,
+    0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x63,0x31,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,
+    0x6c,0x31,0x2c,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x31,
+    0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x63,0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x54,0x65,0x78,0x43,
+    0x68,0x61,0x6e,0x6e,0x65,0x6c,0x32,0x2c,0x20,0x69,0x53,0x6d,0x70,0x43,0x68,0x61,
+    0x6e,0x6e,0x65,0x6c,0x32,0x2c,0x20,0x74,0x65,0x78,0x55,0x56,0x29,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x63,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,
+    0x69,0x54,0x65,0x78,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2c,0x20,0x69,0x53,
+    0x6d,0x70,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x33,0x2c,0x20,0x74,0x65,0x78,0x55,
+    0x56,0x29,0x3b,0x0a,0x20,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x28,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x63,0x30,0x2c,0x20,0x73,0x65,
+    0x6c,0x65,0x63,0x74,0x28,0x63,0x31,0x2c,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,
+    0x63,0x32,0x2c,0x20,0x63,0x33,0x2c,0x20,0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,
+    0x20,0x3e,0x3d,0x20,0x32,0x2e,0x35,0x66,0x29,0x29,0x2c,0x20,0x28,0x74,0x65,0x78,
+    0x53,0x6c,0x6f,0x74,0x20,0x3e,0x3d,0x20,0x31,0x2e,0x35,0x66,0x29,0x29,0x2c,0x20,
+    0x28,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x35,0x66,
+    0x29,0x29,0x20,0x2a,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x66,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x0a,
+    0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x28,0x30,0x29,0x20,0x74,0x65,0x78,0x55,0x56,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x66,0x33,0x32,0x29,0x20,0x2d,
+    0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x74,
+    0x65,0x78,0x55,0x56,0x20,0x3d,0x20,0x74,0x65,0x78,0x55,0x56,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x69,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,
+    0x43,0x6f,0x6c,0x6f,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x74,
+    0x65,0x78,0x53,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x74,0x65,0x78,0x53,0x6c,0x6f,0x74,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,
+    0x6e,0x5f,0x6f,0x75,0x74,0x28,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void _sgp_set_error(sgp_error error) {
+    _sgp.last_error = error;
+    SOKOL_LOG(sgp_get_error_message(error));
+}
+
+static sg_blend_state _sgp_blend_state(sgp_blend_mode blend_mode) {
+    sg_blend_state blend;
+    memset(&blend, 0, sizeof(sg_blend_state));
+    switch (blend_mode) {
+        case SGP_BLENDMODE_NONE:
+            blend.enabled = false;
+            blend.src_factor_rgb = SG_BLENDFACTOR_ONE;
+            blend.dst_factor_rgb = SG_BLENDFACTOR_ZERO;
+            blend.op_rgb = SG_BLENDOP_ADD;
+            blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
+            blend.dst_factor_alpha = SG_BLENDFACTOR_ZERO;
+            blend.op_alpha = SG_BLENDOP_ADD;
+            break;
+        case SGP_BLENDMODE_BLEND:
+            blend.enabled = true;
+            blend.src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA;
+            blend.dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+            blend.op_rgb = SG_BLENDOP_ADD;
+            blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
+            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+            blend.op_alpha = SG_BLENDOP_ADD;
+            break;
+        case SGP_BLENDMODE_BLEND_PREMULTIPLIED:
+            blend.enabled = true;
+            blend.src_factor_rgb = SG_BLENDFACTOR_ONE;
+            blend.dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+            blend.op_rgb = SG_BLENDOP_ADD;
+            blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
+            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+            blend.op_alpha = SG_BLENDOP_ADD;
+            break;
+        case SGP_BLENDMODE_ADD:
+            blend.enabled = true;
+            blend.src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA;
+            blend.dst_factor_rgb = SG_BLENDFACTOR_ONE;
+            blend.op_rgb = SG_BLENDOP_ADD;
+            blend.src_factor_alpha = SG_BLENDFACTOR_ZERO;
+            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE;
+            blend.op_alpha = SG_BLENDOP_ADD;
+            break;
+        case SGP_BLENDMODE_ADD_PREMULTIPLIED:
+            blend.enabled = true;
+            blend.src_factor_rgb = SG_BLENDFACTOR_ONE;
+            blend.dst_factor_rgb = SG_BLENDFACTOR_ONE;
+            blend.op_rgb = SG_BLENDOP_ADD;
+            blend.src_factor_alpha = SG_BLENDFACTOR_ZERO;
+            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE;
+            blend.op_alpha = SG_BLENDOP_ADD;
+            break;
+        case SGP_BLENDMODE_MOD:
+            blend.enabled = true;
+            blend.src_factor_rgb = SG_BLENDFACTOR_DST_COLOR;
+            blend.dst_factor_rgb = SG_BLENDFACTOR_ZERO;
+            blend.op_rgb = SG_BLENDOP_ADD;
+            blend.src_factor_alpha = SG_BLENDFACTOR_ZERO;
+            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE;
+            blend.op_alpha = SG_BLENDOP_ADD;
+            break;
+        case SGP_BLENDMODE_MUL:
+            blend.enabled = true;
+            blend.src_factor_rgb = SG_BLENDFACTOR_DST_COLOR;
+            blend.dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+            blend.op_rgb = SG_BLENDOP_ADD;
+            blend.src_factor_alpha = SG_BLENDFACTOR_DST_ALPHA;
+            blend.dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+            blend.op_alpha = SG_BLENDOP_ADD;
+            break;
+        default:
+            blend.enabled = false;
+            blend.src_factor_rgb = SG_BLENDFACTOR_ONE;
+            blend.dst_factor_rgb = SG_BLENDFACTOR_ZERO;
+            blend.op_rgb = SG_BLENDOP_ADD;
+            blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
+            blend.dst_factor_alpha = SG_BLENDFACTOR_ZERO;
+            blend.op_alpha = SG_BLENDOP_ADD;
+            SOKOL_UNREACHABLE;
+            break;
+    }
+    return blend;
+}
+
+static sg_pipeline _sgp_make_pipeline(sg_shader shader, sg_primitive_type primitive_type, sg_index_type index_type, sgp_blend_mode blend_mode,
+                                      sg_pixel_format color_format, sg_pixel_format depth_format, int sample_count, bool has_vs_color, bool compact, bool multi_texture) {
+    // create pipeline, compact vertices are converted to floats by the GPU so shaders are the same
+    sg_pipeline_desc pip_desc;
+    memset(&pip_desc, 0, sizeof(sg_pipeline_desc));
+    pip_desc.shader = shader;
+    pip_desc.layout.buffers[0].stride = compact ? (int)sizeof(_sgp_compact_vertex) : (int)sizeof(sgp_vertex);
+    if (compact) {
+        pip_desc.layout.attrs[SGP_VS_ATTR_COORD].offset = offsetof(_sgp_compact_vertex, coord);
+        pip_desc.layout.attrs[SGP_VS_ATTR_COORD].format = SG_VERTEXFORMAT_SHORT4N;
+    } else {
+        pip_desc.layout.attrs[SGP_VS_ATTR_COORD].offset = offsetof(sgp_vertex, position);
+        pip_desc.layout.attrs[SGP_VS_ATTR_COORD].format = SG_VERTEXFORMAT_FLOAT4;
+    }
+    if (has_vs_color) {
+        pip_desc.layout.attrs[SGP_VS_ATTR_COLOR].offset = compact ? offsetof(_sgp_compact_vertex, color) : offsetof(sgp_vertex, color);
+        pip_desc.layout.attrs[SGP_VS_ATTR_COLOR].format = SG_VERTEXFORMAT_UBYTE4N;
+    }
+    if (multi_texture) {
+        // texture slots come in a separate buffer, so vertices keep the same layout
+        pip_desc.layout.buffers[1].stride = (int)sizeof(float);
+        pip_desc.layout.attrs[_SGP_VS_ATTR_TEXTURE_SLOT].buffer_index = 1;
+        pip_desc.layout.attrs[_SGP_VS_ATTR_TEXTURE_SLOT].format = SG_VERTEXFORMAT_FLOAT;
+    }
+    pip_desc.sample_count = sample_count;
+    pip_desc.depth.pixel_format = depth_format;
+    pip_desc.colors[0].pixel_format = color_format;
+    pip_desc.colors[0].blend = _sgp_blend_state(blend_mode);
+    pip_desc.primitive_type = primitive_type;
+    pip_desc.index_type = index_type;
+
+    sg_pipeline pip = sg_make_pipeline(&pip_desc);
+    if (pip.id != SG_INVALID_ID && sg_query_pipeline_state(pip) != SG_RESOURCESTATE_VALID) {
+        sg_destroy_pipeline(pip);
+        pip.id = SG_INVALID_ID;
+    }
+    return pip;
+}
+
+static sg_pipeline _sgp_make_sprite_pipeline(sgp_blend_mode blend_mode) {
+    // every instance is a sgp_sprite expanded into a 4 vertices triangle strip,
+    // the vertex shader computes the corners from the vertex index, so there is no per vertex buffer
+    sg_pipeline_desc pip_desc;
+    memset(&pip_desc, 0, sizeof(sg_pipeline_desc));
+    pip_desc.shader = _sgp.sprite_shader;
+    pip_desc.layout.buffers[0].stride = sizeof(sgp_sprite);
+    pip_desc.layout.buffers[0].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+    pip_desc.layout.attrs[0].offset = offsetof(sgp_sprite, dst);
+    pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT4;
+    pip_desc.layout.attrs[1].offset = offsetof(sgp_sprite, src);
+    pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_FLOAT4;
+    pip_desc.layout.attrs[2].offset = offsetof(sgp_sprite, color);
+    pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_UBYTE4N;
+    pip_desc.layout.attrs[3].offset = offsetof(sgp_sprite, rotation);
+    pip_desc.layout.attrs[3].format = SG_VERTEXFORMAT_FLOAT;
+    pip_desc.sample_count = _sgp.desc.sample_count;
+    pip_desc.depth.pixel_format = _sgp.desc.depth_format;
+    pip_desc.colors[0].pixel_format = _sgp.desc.color_format;
+    pip_desc.colors[0].blend = _sgp_blend_state(blend_mode);
+    pip_desc.primitive_type = SG_PRIMITIVETYPE_TRIANGLE_STRIP;
+
+    sg_pipeline pip = sg_make_pipeline(&pip_desc);
+    if (pip.id != SG_INVALID_ID && sg_query_pipeline_state(pip) != SG_RESOURCESTATE_VALID) {
+        sg_destroy_pipeline(pip);
+        pip.id = SG_INVALID_ID;
+    }
+    return pip;
+}
+
+// returns the builtin pipeline of a shader for the formats of the current context, making it if no context did yet
+static sg_pipeline _sgp_lookup_shared_pipeline(sg_shader shader, sg_primitive_type primitive_type, sg_index_type index_type, sgp_blend_mode blend_mode, bool compact) {
+    _sgp_pipeline_key key;
+    key.shader_id = shader.id;
+    key.primitive_type = (uint32_t)primitive_type;
+    key.index_type = (uint32_t)index_type;
+    key.blend_mode = (uint32_t)blend_mode;
+    key.color_format = (uint32_t)_sgp.desc.color_format;
+    key.depth_format = (uint32_t)_sgp.desc.depth_format;
+    key.sample_count = (uint32_t)_sgp.desc.sample_count;
+    key.compact = compact ? 1 : 0;
+    for (uint32_t i=0;i<_sgp_shared.num_pipelines;++i) {
+        if (memcmp(&_sgp_shared.pipelines[i].key, &key, sizeof(_sgp_pipeline_key)) == 0) {
+            return _sgp_shared.pipelines[i].pip;
+        }
+    }
+
+    sg_pipeline pip = {SG_INVALID_ID};
+    if (_sgp_shared.num_pipelines == _sgp_shared.max_pipelines) {
+        uint32_t max_pipelines = _sg_max(_sgp_shared.max_pipelines * 2, 64);
+        _sgp_shared_pipeline* pipelines = (_sgp_shared_pipeline*) _sg_malloc(max_pipelines * sizeof(_sgp_shared_pipeline));
+        if (!pipelines) {
+            return pip;
+        }
+        if (_sgp_shared.pipelines) {
+            memcpy(pipelines, _sgp_shared.pipelines, _sgp_shared.num_pipelines * sizeof(_sgp_shared_pipeline));
+            _sg_free(_sgp_shared.pipelines);
+        }
+        _sgp_shared.pipelines = pipelines;
+        _sgp_shared.max_pipelines = max_pipelines;
+    }
+    if (shader.id == _sgp.sprite_shader.id) {
+        pip = _sgp_make_sprite_pipeline(blend_mode);
+    } else {
+        pip = _sgp_make_pipeline(shader, primitive_type, index_type, blend_mode, _sgp.desc.color_format, _sgp.desc.depth_format, _sgp.desc.sample_count,
+                                 true, compact, shader.id == _sgp.multi_texture_shader.id);
+    }
+    if (pip.id != SG_INVALID_ID) {
+        _sgp_shared.pipelines[_sgp_shared.num_pipelines].key = key;
+        _sgp_shared.pipelines[_sgp_shared.num_pipelines].pip = pip;
+        _sgp_shared.num_pipelines++;
+    }
+    return pip;
+}
+
+// returns the float vertices variant of a compact builtin pipeline, or an invalid pipeline when it's not one
+static sg_pipeline _sgp_lookup_float_pipeline(sg_pipeline pip) {
+    for (uint32_t i=0;i<_sgp_shared.num_pipelines;++i) {
+        const _sgp_pipeline_key* key = &_sgp_shared.pipelines[i].key;
+        if (_sgp_shared.pipelines[i].pip.id == pip.id && key->compact) {
+            sg_shader shader = {key->shader_id};
+            return _sgp_lookup_shared_pipeline(shader, (sg_primitive_type)key->primitive_type, (sg_index_type)key->index_type,
+                                               (sgp_blend_mode)key->blend_mode, false);
+        }
+    }
+    sg_pipeline invalid_pip = {SG_INVALID_ID};
+    return invalid_pip;
+}
+
+static sg_pipeline _sgp_lookup_pipeline(sg_primitive_type primitive_type, sgp_blend_mode blend_mode) {
+    uint32_t pip_index = (primitive_type * _SGP_BLENDMODE_NUM) + blend_mode;
+    if (_sgp.pipelines[pip_index].id != SG_INVALID_ID) {
+        return _sgp.pipelines[pip_index];
+    }
+
+    sg_pipeline pip = _sgp_lookup_shared_pipeline(_sgp.shader, primitive_type, SG_INDEXTYPE_NONE, blend_mode, _sgp.desc.compact_vertices);
+    if (pip.id != SG_INVALID_ID) {
+        _sgp.pipelines[pip_index] = pip;
+    }
+    return pip;
+}
+
+static sg_pipeline _sgp_lookup_quad_pipeline(sgp_blend_mode blend_mode) {
+    if (_sgp.quad_pipelines[blend_mode].id != SG_INVALID_ID) {
+        return _sgp.quad_pipelines[blend_mode];
+    }
+
+    sg_pipeline pip = _sgp_lookup_shared_pipeline(_sgp.shader, SG_PRIMITIVETYPE_TRIANGLES, _sgp.index_type, blend_mode, _sgp.desc.compact_vertices);
+    if (pip.id != SG_INVALID_ID) {
+        _sgp.quad_pipelines[blend_mode] = pip;
+    }
+    return pip;
+}
+
+static sg_pipeline _sgp_lookup_transform_pipeline(sg_primitive_type primitive_type, sgp_blend_mode blend_mode) {
+    uint32_t pip_index = (primitive_type * _SGP_BLENDMODE_NUM) + blend_mode;
+    if (_sgp.transform_pipelines[pip_index].id != SG_INVALID_ID) {
+        return _sgp.transform_pipelines[pip_index];
+    }
+
+    // local positions don't fit compact vertices, so these are never compact
+    sg_pipeline pip = _sgp_lookup_shared_pipeline(_sgp.transform_shader, primitive_type, SG_INDEXTYPE_NONE, blend_mode, false);
+    if (pip.id != SG_INVALID_ID) {
+        _sgp.transform_pipelines[pip_index] = pip;
+    }
+    return pip;
+}
+
+// returns the multi texture variant of a builtin pipeline drawing lists of primitives, or an invalid pipeline
+static sg_pipeline _sgp_lookup_multi_texture_pipeline(sg_pipeline pip) {
+    sg_pipeline mt_pip = {SG_INVALID_ID};
+    if (_sgp.multi_texture_shader.id == SG_INVALID_ID) {
+        return mt_pip;
+    }
+    static const sg_primitive_type primitive_types[3] = {SG_PRIMITIVETYPE_TRIANGLES, SG_PRIMITIVETYPE_LINES, SG_PRIMITIVETYPE_POINTS};
+    for (int blend_mode=0;blend_mode<_SGP_BLENDMODE_NUM;++blend_mode) {
+        if (_sgp.quad_pipelines[blend_mode].id == pip.id) {
+            if (_sgp.multi_texture_quad_pipelines[blend_mode].id == SG_INVALID_ID) {
+                _sgp.multi_texture_quad_pipelines[blend_mode] = _sgp_lookup_shared_pipeline(_sgp.multi_texture_shader, SG_PRIMITIVETYPE_TRIANGLES, _sgp.index_type,
+                    (sgp_blend_mode)blend_mode, _sgp.desc.compact_vertices);
+            }
+            return _sgp.multi_texture_quad_pipelines[blend_mode];
+        }
+        for (int i=0;i<3;++i) {
+            uint32_t pip_index = (primitive_types[i] * _SGP_BLENDMODE_NUM) + (uint32_t)blend_mode;
+            if (_sgp.pipelines[pip_index].id == pip.id) {
+                if (_sgp.multi_texture_pipelines[pip_index].id == SG_INVALID_ID) {
+                    _sgp.multi_texture_pipelines[pip_index] = _sgp_lookup_shared_pipeline(_sgp.multi_texture_shader, primitive_types[i], SG_INDEXTYPE_NONE,
+                        (sgp_blend_mode)blend_mode, _sgp.desc.compact_vertices);
+                }
+                return _sgp.multi_texture_pipelines[pip_index];
+            }
+        }
+    }
+    return mt_pip;
+}
+
+static sg_pipeline _sgp_lookup_sprite_pipeline(sgp_blend_mode blend_mode) {
+    if (_sgp.sprite_pipelines[blend_mode].id != SG_INVALID_ID) {
+        return _sgp.sprite_pipelines[blend_mode];
+    }
+
+    sg_pipeline pip = _sgp_lookup_shared_pipeline(_sgp.sprite_shader, SG_PRIMITIVETYPE_TRIANGLE_STRIP, SG_INDEXTYPE_NONE, blend_mode, false);
+    if (pip.id != SG_INVALID_ID) {
+        _sgp.sprite_pipelines[blend_mode] = pip;
+    }
+    return pip;
+}
+
+static void _sgp_retire_buffer(sg_buffer buf) {
+    // the buffer may still be used by draws of this frame, it is destroyed on the next frame
+    SOKOL_ASSERT(_sgp.num_retired_bufs < _SGP_MAX_RETIRED_BUFFERS);
+    _sgp.retired_bufs[_sgp.num_retired_bufs++] = buf;
+    _sgp.retired_frame_index = _sg.frame_index;
+}
+
+static void _sgp_release_retired_buffers(void) {
+    if (_sgp.num_retired_bufs > 0 && _sgp.retired_frame_index != _sg.frame_index) {
+        for (uint32_t i=0;i<_sgp.num_retired_bufs;++i) {
+            sg_destroy_buffer(_sgp.retired_bufs[i]);
+        }
+        _sgp.num_retired_bufs = 0;
+    }
+}
+
+static bool _sgp_make_index_buffer(uint32_t num_quads) {
+    _sgp_release_retired_buffers();
+    if (_sgp.num_retired_bufs >= _SGP_MAX_RETIRED_BUFFERS) {
+        return false;
+    }
+
+    uint32_t num_indices = num_quads * 6;
+    bool index16 = _sgp.index_type == SG_INDEXTYPE_UINT16;
+    size_t size = num_indices * (index16 ? sizeof(uint16_t) : sizeof(uint32_t));
+    void* indices = _sg_malloc(size);
+    if (!indices) {
+        return false;
+    }
+    for (uint32_t i=0;i<num_indices;++i) {
+        uint32_t index = (i / 6) * 4 + _sgp_quad_indices[i % 6];
+        if (index16) {
+            ((uint16_t*)indices)[i] = (uint16_t)index;
+        } else {
+            ((uint32_t*)indices)[i] = index;
+        }
+    }
+
+    sg_buffer_desc index_buf_desc;
+    memset(&index_buf_desc, 0, sizeof(sg_buffer_desc));
+    index_buf_desc.type = SG_BUFFERTYPE_INDEXBUFFER;
+    index_buf_desc.usage = SG_USAGE_IMMUTABLE;
+    index_buf_desc.data.ptr = indices;
+    index_buf_desc.data.size = size;
+    sg_buffer index_buf = sg_make_buffer(&index_buf_desc);
+    _sg_free(indices);
+    if (sg_query_buffer_state(index_buf) != SG_RESOURCESTATE_VALID) {
+        sg_destroy_buffer(index_buf);
+        return false;
+    }
+    if (_sgp.index_buf.id != SG_INVALID_ID) {
+        _sgp_retire_buffer(_sgp.index_buf);
+    }
+    _sgp.index_buf = index_buf;
+    _sgp.index_buf_quads = num_quads;
+    return true;
+}
+
+typedef enum _sgp_shader_kind {
+    _SGP_SHADER_COMMON,
+    _SGP_SHADER_SPRITE,
+    _SGP_SHADER_TRANSFORM,
+    _SGP_SHADER_MULTI_TEXTURE
+} _sgp_shader_kind;
+
+static inline const char* _sgp_select_vs_source(_sgp_shader_kind kind, const uint8_t* common, const uint8_t* sprite, const uint8_t* transform, const uint8_t* multi_texture) {
+    switch (kind) {
+        case _SGP_SHADER_SPRITE: return (const char*)sprite;
+        case _SGP_SHADER_TRANSFORM: return (const char*)transform;
+        case _SGP_SHADER_MULTI_TEXTURE: return (const char*)multi_texture;
+        default: return (const char*)common;
+    }
+}
+
+static inline const char* _sgp_select_fs_source(_sgp_shader_kind kind, const uint8_t* common, const uint8_t* multi_texture) {
+    return (const char*)(kind == _SGP_SHADER_MULTI_TEXTURE ? multi_texture : common);
+}
+
+static sg_shader _sgp_make_common_shader(_sgp_shader_kind kind) {
+    sg_backend backend = sg_query_backend();
+    sg_shader_desc desc;
+    memset(&desc, 0, sizeof(desc));
+    desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    desc.images[0].multisampled = false;
+    desc.images[0].image_type = SG_IMAGETYPE_2D;
+    desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+    desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+    desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    desc.image_sampler_pairs[0].image_slot = 0;
+    desc.image_sampler_pairs[0].sampler_slot = 0;
+
+    // GLCORE / GLES3 only
+    desc.image_sampler_pairs[0].glsl_name = "iTexChannel0_iSmpChannel0";
+
+    // the multi texture shader samples a texture per slot, each one with its own sampler
+    if (kind == _SGP_SHADER_MULTI_TEXTURE) {
+        static const char* pair_names[_SGP_MULTI_TEXTURE_SLOTS] = {
+            "iTexChannel0_iSmpChannel0", "iTexChannel1_iSmpChannel1", "iTexChannel2_iSmpChannel2", "iTexChannel3_iSmpChannel3"
+        };
+        for (int i=0;i<_SGP_MULTI_TEXTURE_SLOTS;++i) {
+            desc.images[i] = desc.images[0];
+            desc.images[i].hlsl_register_t_n = (uint8_t)i;
+            desc.images[i].msl_texture_n = (uint8_t)i;
+            desc.images[i].wgsl_group1_binding_n = (uint8_t)(64 + i);
+            desc.samplers[i] = desc.samplers[0];
+            desc.samplers[i].hlsl_register_s_n = (uint8_t)i;
+            desc.samplers[i].msl_sampler_n = (uint8_t)i;
+            desc.samplers[i].wgsl_group1_binding_n = (uint8_t)(80 + i);
+            desc.image_sampler_pairs[i].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[i].image_slot = (uint8_t)i;
+            desc.image_sampler_pairs[i].sampler_slot = (uint8_t)i;
+            desc.image_sampler_pairs[i].glsl_name = pair_names[i];
+        }
+        desc.attrs[_SGP_VS_ATTR_TEXTURE_SLOT].glsl_name = "slot";
+        desc.attrs[_SGP_VS_ATTR_TEXTURE_SLOT].hlsl_sem_name = "TEXCOORD";
+        desc.attrs[_SGP_VS_ATTR_TEXTURE_SLOT].hlsl_sem_index = 2;
+    }
+
+    // D3D11 only
+    desc.vertex_func.d3d11_target = "vs_4_0";
+    desc.fragment_func.d3d11_target = "ps_4_0";
+
+    // attributes and uniforms
+    if (kind == _SGP_SHADER_SPRITE) {
+        // one sgp_sprite per instance, the transform and texture size come in a vertex uniform
+        static const char* sprite_attr_names[4] = {"dst_rect", "src_rect", "color", "rotation"};
+        for (int i=0;i<4;++i) {
+            desc.attrs[i].glsl_name = sprite_attr_names[i];
+            desc.attrs[i].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[i].hlsl_sem_index = (uint8_t)i;
+        }
+        desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+        desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+        desc.uniform_blocks[0].size = 8 * sizeof(float);
+        desc.uniform_blocks[0].hlsl_register_b_n = 0;
+        desc.uniform_blocks[0].msl_buffer_n = 0;
+        desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+        desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+        desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+        desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "sprite_params";
+    } else {
+        desc.attrs[SGP_VS_ATTR_COORD].glsl_name = "coord";
+        desc.attrs[SGP_VS_ATTR_COLOR].glsl_name = "color";
+        desc.attrs[SGP_VS_ATTR_COORD].hlsl_sem_name = "TEXCOORD";
+        desc.attrs[SGP_VS_ATTR_COORD].hlsl_sem_index = 0;
+        desc.attrs[SGP_VS_ATTR_COLOR].hlsl_sem_name = "TEXCOORD";
+        desc.attrs[SGP_VS_ATTR_COLOR].hlsl_sem_index = 1;
+    }
+    if (kind == _SGP_SHADER_TRANSFORM) {
+        // the transform matrix comes in a vertex uniform
+        desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+        desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+        desc.uniform_blocks[0].size = 8 * sizeof(float);
+        desc.uniform_blocks[0].hlsl_register_b_n = 0;
+        desc.uniform_blocks[0].msl_buffer_n = 0;
+        desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+        desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+        desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+        desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "transform_params";
+    }
+
+    // entry
+    switch (backend) {
+        case SG_BACKEND_METAL_MACOS:
+        case SG_BACKEND_METAL_IOS:
+        case SG_BACKEND_METAL_SIMULATOR:
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.entry = "main0";
+            break;
+        default:
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.entry = "main";
+            break;
+    }
+
+    // source
+    switch (backend) {
+        case SG_BACKEND_GLCORE:
+            desc.vertex_func.source = _sgp_select_vs_source(kind, sgp_vs_source_glsl410, sgp_vs_sprite_source_glsl410, sgp_vs_transform_source_glsl410, sgp_vs_multi_texture_source_glsl410);
+            desc.fragment_func.source = _sgp_select_fs_source(kind, sgp_fs_source_glsl410, sgp_fs_multi_texture_source_glsl410);
             break;
         case SG_BACKEND_GLES3:
-            desc.vertex_func.source = (const char*)sgp_vs_source_glsl300es;
-            desc.fragment_func.source = (const char*)sgp_fs_source_glsl300es;
+            desc.vertex_func.source = _sgp_select_vs_source(kind, sgp_vs_source_glsl300es, sgp_vs_sprite_source_glsl300es, sgp_vs_transform_source_glsl300es, sgp_vs_multi_texture_source_glsl300es);
+            desc.fragment_func.source = _sgp_select_fs_source(kind, sgp_fs_source_glsl300es, sgp_fs_multi_texture_source_glsl300es);
             break;
         case SG_BACKEND_D3D11:
-            desc.vertex_func.source = (const char*)sgp_vs_source_hlsl4;
-            desc.fragment_func.source = (const char*)sgp_fs_source_hlsl4;
+            desc.vertex_func.source = _sgp_select_vs_source(kind, sgp_vs_source_hlsl4, sgp_vs_sprite_source_hlsl4, sgp_vs_transform_source_hlsl4, sgp_vs_multi_texture_source_hlsl4);
+            desc.fragment_func.source = _sgp_select_fs_source(kind, sgp_fs_source_hlsl4, sgp_fs_multi_texture_source_hlsl4);
             break;
         case SG_BACKEND_METAL_MACOS:
-            desc.vertex_func.source = (const char*)sgp_vs_source_metal_macos;
-            desc.fragment_func.source = (const char*)sgp_fs_source_metal_macos;
+            desc.vertex_func.source = _sgp_select_vs_source(kind, sgp_vs_source_metal_macos, sgp_vs_sprite_source_metal_macos, sgp_vs_transform_source_metal_macos, sgp_vs_multi_texture_source_metal_macos);
+            desc.fragment_func.source = _sgp_select_fs_source(kind, sgp_fs_source_metal_macos, sgp_fs_multi_texture_source_metal_macos);
             break;
         case SG_BACKEND_METAL_IOS:
         case SG_BACKEND_METAL_SIMULATOR:
-            desc.vertex_func.source = (const char*)sgp_vs_source_metal_ios;
-            desc.fragment_func.source = (const char*)sgp_fs_source_metal_ios;
+            desc.vertex_func.source = _sgp_select_vs_source(kind, sgp_vs_source_metal_ios, sgp_vs_sprite_source_metal_ios, sgp_vs_transform_source_metal_ios, sgp_vs_multi_texture_source_metal_ios);
+            desc.fragment_func.source = _sgp_select_fs_source(kind, sgp_fs_source_metal_ios, sgp_fs_multi_texture_source_metal_ios);
             break;
         case SG_BACKEND_WGPU:
-            desc.vertex_func.source = (const char*)sgp_vs_source_wgsl;
-            desc.fragment_func.source = (const char*)sgp_fs_source_wgsl;
+            desc.vertex_func.source = _sgp_select_vs_source(kind, sgp_vs_source_wgsl, sgp_vs_sprite_source_wgsl, sgp_vs_transform_source_wgsl, sgp_vs_multi_texture_source_wgsl);
+            desc.fragment_func.source = _sgp_select_fs_source(kind, sgp_fs_source_wgsl, sgp_fs_multi_texture_source_wgsl);
             break;
         case SG_BACKEND_DUMMY:
             desc.vertex_func.source = "";
             desc.fragment_func.source = "";
             break;
-        default: {
-            // Unsupported backend
-            sg_shader shd;
-            shd.id = SG_INVALID_ID;
-            return shd;
+        default: {
+            // Unsupported backend
+            sg_shader shd;
+            shd.id = SG_INVALID_ID;
+            return shd;
+        }
+    }
+
+    return sg_make_shader(&desc);
+}
+
+static void _sgp_shutdown_context(void);
+
+// creates the white texture, nearest sampler and common shaders into the shared resources, returns the error of the first that fails
+static sgp_error _sgp_make_shared_resources(void) {
+    // create white texture
+    uint32_t pixels[4];
+    memset(pixels, 0xFF, sizeof(pixels));
+    sg_image_desc white_img_desc;
+    memset(&white_img_desc, 0, sizeof(sg_image_desc));
+    white_img_desc.type = SG_IMAGETYPE_2D;
+    white_img_desc.width = 2;
+    white_img_desc.height = 2;
+    white_img_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
+    white_img_desc.data.subimage[0][0].ptr = pixels;
+    white_img_desc.data.subimage[0][0].size = sizeof(pixels);
+    white_img_desc.label = "sgp-white-texture";
+    _sgp_shared.white_img = sg_make_image(&white_img_desc);
+    if (sg_query_image_state(_sgp_shared.white_img) != SG_RESOURCESTATE_VALID) {
+        return SGP_ERROR_MAKE_WHITE_IMAGE_FAILED;
+    }
+
+    // create nearest sampler
+    sg_sampler_desc nearest_smp_desc;
+    memset(&nearest_smp_desc, 0, sizeof(sg_sampler_desc));
+    nearest_smp_desc.label = "sgp-nearest-sampler";
+    _sgp_shared.nearest_smp = sg_make_sampler(&nearest_smp_desc);
+    if (sg_query_sampler_state(_sgp_shared.nearest_smp) != SG_RESOURCESTATE_VALID) {
+        return SGP_ERROR_MAKE_NEAREST_SAMPLER_FAILED;
+    }
+
+    // create common shader
+    _sgp_shared.shader = _sgp_make_common_shader(_SGP_SHADER_COMMON);
+    if (sg_query_shader_state(_sgp_shared.shader) != SG_RESOURCESTATE_VALID) {
+        return SGP_ERROR_MAKE_COMMON_SHADER_FAILED;
+    }
+
+    // create sprite shader
+    _sgp_shared.sprite_shader = _sgp_make_common_shader(_SGP_SHADER_SPRITE);
+    if (sg_query_shader_state(_sgp_shared.sprite_shader) != SG_RESOURCESTATE_VALID) {
+        return SGP_ERROR_MAKE_COMMON_SHADER_FAILED;
+    }
+
+    // create transform shader, its pipelines are created on first use
+    _sgp_shared.transform_shader = _sgp_make_common_shader(_SGP_SHADER_TRANSFORM);
+    if (sg_query_shader_state(_sgp_shared.transform_shader) != SG_RESOURCESTATE_VALID) {
+        return SGP_ERROR_MAKE_COMMON_SHADER_FAILED;
+    }
+    return SGP_NO_ERROR;
+}
+
+static void _sgp_destroy_shared_resources(void) {
+    for (uint32_t i=0;i<_sgp_shared.num_pipelines;++i) {
+        sg_destroy_pipeline(_sgp_shared.pipelines[i].pip);
+    }
+    if (_sgp_shared.pipelines) {
+        _sg_free(_sgp_shared.pipelines);
+    }
+    if (_sgp_shared.shader.id != SG_INVALID_ID) {
+        sg_destroy_shader(_sgp_shared.shader);
+    }
+    if (_sgp_shared.sprite_shader.id != SG_INVALID_ID) {
+        sg_destroy_shader(_sgp_shared.sprite_shader);
+    }
+    if (_sgp_shared.transform_shader.id != SG_INVALID_ID) {
+        sg_destroy_shader(_sgp_shared.transform_shader);
+    }
+    if (_sgp_shared.multi_texture_shader.id != SG_INVALID_ID) {
+        sg_destroy_shader(_sgp_shared.multi_texture_shader);
+    }
+    if (_sgp_shared.white_img.id != SG_INVALID_ID) {
+        sg_destroy_image(_sgp_shared.white_img);
+    }
+    if (_sgp_shared.nearest_smp.id != SG_INVALID_ID) {
+        sg_destroy_sampler(_sgp_shared.nearest_smp);
+    }
+    memset(&_sgp_shared, 0, sizeof(_sgp_shared_resources));
+}
+
+// like _sg_def, but SGP_BATCH_OPTIMIZER_OFF gives 0
+static inline uint32_t _sgp_def_or_off(uint32_t val, uint32_t def) {
+    return val == SGP_BATCH_OPTIMIZER_OFF ? 0 : _sg_def(val, def);
+}
+
+static void _sgp_setup_context(const sgp_desc* desc) {
+    SOKOL_ASSERT(_sgp.init_cookie == 0);
+
+    if (!sg_isvalid()) {
+        _sgp_set_error(SGP_ERROR_SOKOL_INVALID);
+        return;
+    }
+
+    // init
+    _sgp.init_cookie = _SGP_INIT_COOKIE;
+    _sgp.last_error = SGP_NO_ERROR;
+
+    // set desc default values
+    _sgp.desc = *desc;
+    _sgp.desc.max_vertices = _sg_def(desc->max_vertices, _SGP_DEFAULT_MAX_VERTICES);
+    _sgp.desc.max_commands = _sg_def(desc->max_commands, _SGP_DEFAULT_MAX_COMMANDS);
+    _sgp.desc.max_sprites = _sg_def(desc->max_sprites, _SGP_DEFAULT_MAX_SPRITES);
+    _sgp.desc.color_format = _sg_def(desc->color_format, _sg.desc.environment.defaults.color_format);
+    _sgp.desc.depth_format = _sg_def(desc->depth_format, _sg.desc.environment.defaults.depth_format);
+    _sgp.desc.sample_count = _sg_def(desc->sample_count, _sg.desc.environment.defaults.sample_count);
+    _sgp.desc.batch_optimizer_depth = _sgp_def_or_off(desc->batch_optimizer_depth, SGP_BATCH_OPTIMIZER_DEPTH);
+    _sgp.desc.batch_optimizer_max_move_vertices = _sgp_def_or_off(desc->batch_optimizer_max_move_vertices, SGP_BATCH_OPTIMIZER_MAX_MOVE_VERTICES);
+    _sgp.desc.capacity_callback.threshold = _sg_def_flt(desc->capacity_callback.threshold, 0.9f);
+    _sgp.desc.dispatcher.min_vertices = _sg_def(desc->dispatcher.min_vertices, _SGP_DEFAULT_TASK_MIN_VERTICES);
+    _sgp.desc.dispatcher.max_tasks = _sg_min(_sg_def(desc->dispatcher.max_tasks, _SGP_DEFAULT_MAX_TASKS), _SGP_MAX_TASKS);
+    _sgp.desc.multi_texture_batching = desc->multi_texture_batching && SGP_TEXTURE_SLOTS >= _SGP_MULTI_TEXTURE_SLOTS;
+
+    // allocate buffers
+    _sgp.num_vertices = _sgp.desc.max_vertices;
+    _sgp.num_commands = _sgp.desc.max_commands;
+    _sgp.num_uniforms = _sgp.desc.max_commands;
+    _sgp.num_sprites = _sgp.desc.max_sprites;
+    _sgp.vertices = (sgp_vertex*) _sg_malloc(_sgp.num_vertices * sizeof(sgp_vertex));
+    _sgp.uniforms = (sgp_uniform*) _sg_malloc(_sgp.num_uniforms * sizeof(sgp_uniform));
+    _sgp.commands = (_sgp_command*) _sg_malloc(_sgp.num_commands * sizeof(_sgp_command));
+    _sgp.sprites = (sgp_sprite*) _sg_malloc(_sgp.num_sprites * sizeof(sgp_sprite));
+    if (!_sgp.vertices || !_sgp.uniforms || !_sgp.commands || !_sgp.sprites) {
+        _sgp_shutdown_context();
+        _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+        return;
+    }
+    memset(_sgp.vertices, 0, _sgp.num_vertices * sizeof(sgp_vertex));
+    memset(_sgp.uniforms, 0, _sgp.num_uniforms * sizeof(sgp_uniform));
+    memset(_sgp.commands, 0, _sgp.num_commands * sizeof(_sgp_command));
+    memset(_sgp.sprites, 0, _sgp.num_sprites * sizeof(sgp_sprite));
+    if (_sgp.desc.compact_vertices) {
+        _sgp.num_compact_vertices = _sgp.num_vertices;
+        _sgp.compact_vertices = (_sgp_compact_vertex*) _sg_malloc(_sgp.num_compact_vertices * sizeof(_sgp_compact_vertex));
+        if (!_sgp.compact_vertices) {
+            _sgp_shutdown_context();
+            _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+            return;
+        }
+    }
+    if (_sgp.desc.multi_texture_batching) {
+        _sgp.num_vertex_slots = _sgp.num_vertices;
+        _sgp.vertex_slots = (float*) _sg_malloc(_sgp.num_vertex_slots * sizeof(float));
+        if (!_sgp.vertex_slots) {
+            _sgp_shutdown_context();
+            _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+            return;
+        }
+        memset(_sgp.vertex_slots, 0, _sgp.num_vertex_slots * sizeof(float));
+    }
+
+    // allocate batch optimizer scratch
+    if (_sgp.desc.batch_optimizer_depth > 0) {
+        _sgp.inter_cmds = (uint32_t*) _sg_malloc(_sgp.desc.batch_optimizer_depth * sizeof(uint32_t));
+        if (!_sgp.inter_cmds) {
+            _sgp_shutdown_context();
+            _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+            return;
+        }
+    }
+
+    // create vertex buffer
+    sg_buffer_desc vertex_buf_desc;
+    memset(&vertex_buf_desc, 0, sizeof(sg_buffer_desc));
+    vertex_buf_desc.size = (size_t)_sgp.num_vertices * sizeof(sgp_vertex);
+    vertex_buf_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+    vertex_buf_desc.usage = SG_USAGE_STREAM;
+
+    _sgp.vertex_buf = sg_make_buffer(&vertex_buf_desc);
+    _sgp.vertex_buf_size = vertex_buf_desc.size;
+    if (sg_query_buffer_state(_sgp.vertex_buf) != SG_RESOURCESTATE_VALID) {
+        _sgp_shutdown_context();
+        _sgp_set_error(SGP_ERROR_MAKE_VERTEX_BUFFER_FAILED);
+        return;
+    }
+
+    // create sprite instances buffer
+    sg_buffer_desc sprite_buf_desc;
+    memset(&sprite_buf_desc, 0, sizeof(sg_buffer_desc));
+    sprite_buf_desc.size = (size_t)(_sgp.num_sprites * sizeof(sgp_sprite));
+    sprite_buf_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+    sprite_buf_desc.usage = SG_USAGE_STREAM;
+
+    _sgp.sprite_buf = sg_make_buffer(&sprite_buf_desc);
+    _sgp.sprite_buf_size = sprite_buf_desc.size;
+    if (sg_query_buffer_state(_sgp.sprite_buf) != SG_RESOURCESTATE_VALID) {
+        _sgp_shutdown_context();
+        _sgp_set_error(SGP_ERROR_MAKE_SPRITE_BUFFER_FAILED);
+        return;
+    }
+
+    // create texture slots buffer, with a slot per vertex
+    if (_sgp.desc.multi_texture_batching) {
+        sg_buffer_desc slot_buf_desc;
+        memset(&slot_buf_desc, 0, sizeof(sg_buffer_desc));
+        slot_buf_desc.size = (size_t)_sgp.num_vertices * sizeof(float);
+        slot_buf_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+        slot_buf_desc.usage = SG_USAGE_STREAM;
+
+        _sgp.slot_buf = sg_make_buffer(&slot_buf_desc);
+        _sgp.slot_buf_size = slot_buf_desc.size;
+        if (sg_query_buffer_state(_sgp.slot_buf) != SG_RESOURCESTATE_VALID) {
+            _sgp_shutdown_context();
+            _sgp_set_error(SGP_ERROR_MAKE_VERTEX_BUFFER_FAILED);
+            return;
+        }
+    }
+
+    // create the resources shared by every context, along with the default context
+    if (_sgp_ctx == &_sgp_main_ctx) {
+        sgp_error error = _sgp_make_shared_resources();
+        if (error != SGP_NO_ERROR) {
+            _sgp_shutdown_context();
+            _sgp_set_error(error);
+            return;
+        }
+    }
+
+    // create multi texture shader, its pipelines are created on first use
+    if (_sgp.desc.multi_texture_batching && _sgp_shared.multi_texture_shader.id == SG_INVALID_ID) {
+        _sgp_shared.multi_texture_shader = _sgp_make_common_shader(_SGP_SHADER_MULTI_TEXTURE);
+        if (sg_query_shader_state(_sgp_shared.multi_texture_shader) != SG_RESOURCESTATE_VALID) {
+            sg_destroy_shader(_sgp_shared.multi_texture_shader);
+            _sgp_shared.multi_texture_shader.id = SG_INVALID_ID;
+            _sgp_shutdown_context();
+            _sgp_set_error(SGP_ERROR_MAKE_COMMON_SHADER_FAILED);
+            return;
+        }
+    }
+
+    // the context only references the shared resources
+    _sgp.shader = _sgp_shared.shader;
+    _sgp.sprite_shader = _sgp_shared.sprite_shader;
+    _sgp.transform_shader = _sgp_shared.transform_shader;
+    if (_sgp.desc.multi_texture_batching) {
+        _sgp.multi_texture_shader = _sgp_shared.multi_texture_shader;
+    }
+    _sgp.white_img = _sgp_shared.white_img;
+    _sgp.nearest_smp = _sgp_shared.nearest_smp;
+
+    // create common pipelines
+    bool pips_ok = true;
+    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLES, SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLES, SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_POINTS, SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_POINTS, SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_LINES, SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_LINES, SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLE_STRIP, SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLE_STRIP, SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_LINE_STRIP, SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_LINE_STRIP, SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_sprite_pipeline(SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
+    pips_ok = pips_ok && _sgp_lookup_sprite_pipeline(SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
+    if (!pips_ok) {
+        _sgp_shutdown_context();
+        _sgp_set_error(SGP_ERROR_MAKE_COMMON_PIPELINE_FAILED);
+        return;
+    }
+
+    // create quad index buffer and pipelines,
+    // 16 bit indexes are enough when the vertices buffer never holds more than 65536 vertices
+    if (_sgp.desc.indexed_quads) {
+        _sgp.index_type = (_sgp.num_vertices <= 65536 && !_sgp.desc.grow_buffers) ? SG_INDEXTYPE_UINT16 : SG_INDEXTYPE_UINT32;
+        if (!_sgp_make_index_buffer((_sgp.num_vertices + 3) / 4)) {
+            _sgp_shutdown_context();
+            _sgp_set_error(SGP_ERROR_MAKE_INDEX_BUFFER_FAILED);
+            return;
+        }
+        pips_ok = pips_ok && _sgp_lookup_quad_pipeline(SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
+        pips_ok = pips_ok && _sgp_lookup_quad_pipeline(SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
+        if (!pips_ok) {
+            _sgp_shutdown_context();
+            _sgp_set_error(SGP_ERROR_MAKE_COMMON_PIPELINE_FAILED);
+            return;
+        }
+    }
+}
+
+static void _sgp_shutdown_context(void) {
+    if (_sgp.init_cookie == 0) {
+        return; // not initialized
+    }
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state == 0);
+    if (_sgp.vertices) {
+        _sg_free(_sgp.vertices);
+    }
+    if (_sgp.uniforms) {
+        _sg_free(_sgp.uniforms);
+    }
+    if (_sgp.commands) {
+        _sg_free(_sgp.commands);
+    }
+    if (_sgp.sprites) {
+        _sg_free(_sgp.sprites);
+    }
+    if (_sgp.compact_vertices) {
+        _sg_free(_sgp.compact_vertices);
+    }
+    if (_sgp.vertex_slots) {
+        _sg_free(_sgp.vertex_slots);
+    }
+    if (_sgp.inter_cmds) {
+        _sg_free(_sgp.inter_cmds);
+    }
+    if (_sgp.sort_items) {
+        _sg_free(_sgp.sort_items);
+        _sg_free(_sgp.sort_keys);
+        _sg_free(_sgp.sort_commands);
+    }
+    if (_sgp.sort_vertices) {
+        _sg_free(_sgp.sort_vertices);
+    }
+    if (_sgp.sort_grid) {
+        _sg_free(_sgp.sort_grid);
+        _sg_free(_sgp.sort_entries);
+    }
+    if (_sgp.vertex_buf.id != SG_INVALID_ID) {
+        sg_destroy_buffer(_sgp.vertex_buf);
+    }
+    if (_sgp.index_buf.id != SG_INVALID_ID) {
+        sg_destroy_buffer(_sgp.index_buf);
+    }
+    if (_sgp.sprite_buf.id != SG_INVALID_ID) {
+        sg_destroy_buffer(_sgp.sprite_buf);
+    }
+    if (_sgp.slot_buf.id != SG_INVALID_ID) {
+        sg_destroy_buffer(_sgp.slot_buf);
+    }
+    for (uint32_t i=0;i<_sgp.num_retired_bufs;++i) {
+        sg_destroy_buffer(_sgp.retired_bufs[i]);
+    }
+    // the shared resources outlive every other context
+    if (_sgp_ctx == &_sgp_main_ctx) {
+        _sgp_destroy_shared_resources();
+    }
+    memset(&_sgp, 0, sizeof(_sgp_context));
+}
+
+// returns NULL for invalid handles and handles of destroyed contexts, even when their slot was reused
+static _sgp_context* _sgp_lookup_context(sgp_context ctx) {
+    uint32_t slot = (ctx.id & _SGP_CONTEXT_SLOT_MASK);
+    if (slot == 0 || slot > SGP_MAX_CONTEXTS || _sgp_context_ids[slot-1] != ctx.id) {
+        return NULL;
+    }
+    return _sgp_contexts[slot-1];
+}
+
+void sgp_setup(const sgp_desc* desc) {
+    // the default context is current in the thread that sets it up
+    _sgp_ctx = &_sgp_main_ctx;
+    _sgp_setup_context(desc);
+}
+
+void sgp_shutdown(void) {
+    // other contexts can't outlive the default one
+    for (uint32_t i=1;i<SGP_MAX_CONTEXTS;++i) {
+        if (_sgp_contexts[i]) {
+            sgp_context ctx = {_sgp_context_ids[i]};
+            sgp_destroy_context(ctx);
+        }
+    }
+    _sgp_ctx = &_sgp_main_ctx;
+    _sgp_shutdown_context();
+}
+
+sgp_context sgp_make_context(const sgp_desc* desc) {
+    SOKOL_ASSERT(_sgp_main_ctx.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(!_sgp.command_list);
+    SOKOL_ASSERT(desc);
+    sgp_context handle = {SG_INVALID_ID};
+
+    // find a free slot, the first one is the default context
+    uint32_t slot = 1;
+    while (slot < SGP_MAX_CONTEXTS && _sgp_contexts[slot]) {
+        slot++;
+    }
+    if (slot >= SGP_MAX_CONTEXTS) {
+        _sgp_set_error(SGP_ERROR_CONTEXTS_FULL);
+        return handle;
+    }
+    _sgp_context* ctx = (_sgp_context*) _sg_malloc(sizeof(_sgp_context));
+    if (!ctx) {
+        _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+        return handle;
+    }
+    memset(ctx, 0, sizeof(_sgp_context));
+
+    // set up the new context the same way as the default one, errors are reported in the current context
+    _sgp_context* prev_ctx = _sgp_ctx;
+    _sgp_ctx = ctx;
+    _sgp_setup_context(desc);
+    bool valid = _sgp.init_cookie == _SGP_INIT_COOKIE;
+    sgp_error error = _sgp.last_error;
+    _sgp_ctx = prev_ctx;
+    if (!valid) {
+        _sg_free(ctx);
+        _sgp_set_error(error);
+        return handle;
+    }
+    _sgp_contexts[slot] = ctx;
+    uint32_t generation = (_sgp_context_ids[slot] >> _SGP_CONTEXT_SLOT_SHIFT) + 1;
+    _sgp_context_ids[slot] = (generation << _SGP_CONTEXT_SLOT_SHIFT) | (slot + 1);
+    handle.id = _sgp_context_ids[slot];
+    return handle;
+}
+
+void sgp_destroy_context(sgp_context ctx) {
+    _sgp_context* context = _sgp_lookup_context(ctx);
+    SOKOL_ASSERT(context); // the context was already destroyed
+    SOKOL_ASSERT(context != &_sgp_main_ctx); // the default context is destroyed by sgp_shutdown
+    if (!context || context == &_sgp_main_ctx) {
+        return;
+    }
+    _sgp_context* prev_ctx = _sgp_ctx;
+    _sgp_ctx = context;
+    _sgp_shutdown_context();
+    _sgp_ctx = prev_ctx == context ? &_sgp_main_ctx : prev_ctx;
+    _sg_free(context);
+    _sgp_contexts[(ctx.id & _SGP_CONTEXT_SLOT_MASK)-1] = NULL;
+}
+
+void sgp_set_context(sgp_context ctx) {
+    SOKOL_ASSERT(!_sgp.command_list);
+    _sgp_context* context = _sgp_lookup_context(ctx);
+    SOKOL_ASSERT(context); // the context was destroyed or its handle is invalid
+    if (context) {
+        _sgp_ctx = context;
+    }
+}
+
+sgp_context sgp_get_context(void) {
+    SOKOL_ASSERT(!_sgp.command_list);
+    sgp_context handle = {SG_INVALID_ID};
+    for (uint32_t i=0;i<SGP_MAX_CONTEXTS;++i) {
+        if (_sgp_contexts[i] == _sgp_ctx) {
+            handle.id = _sgp_context_ids[i];
+            break;
+        }
+    }
+    return handle;
+}
+
+sgp_context sgp_default_context(void) {
+    sgp_context handle = {1};
+    return handle;
+}
+
+bool sgp_is_valid(void) {
+    return _sgp.init_cookie == _SGP_INIT_COOKIE;
+}
+
+sgp_error sgp_get_last_error(void) {
+    return _sgp.last_error;
+}
+
+const char* sgp_get_error_message(sgp_error error_code) {
+    switch (error_code) {
+        case SGP_NO_ERROR:
+            return "No error";
+        case SGP_ERROR_SOKOL_INVALID:
+            return "Sokol is not initialized";
+        case SGP_ERROR_VERTICES_FULL:
+            return "SGP vertices buffer is full";
+        case SGP_ERROR_UNIFORMS_FULL:
+            return "SGP uniform buffer is full";
+        case SGP_ERROR_COMMANDS_FULL:
+            return "SGP command buffer is full";
+        case SGP_ERROR_VERTICES_OVERFLOW:
+            return "SGP vertices buffer overflow";
+        case SGP_ERROR_TRANSFORM_STACK_OVERFLOW:
+            return "SGP transform stack overflow";
+        case SGP_ERROR_TRANSFORM_STACK_UNDERFLOW:
+            return "SGP transform stack underflow";
+        case SGP_ERROR_STATE_STACK_OVERFLOW:
+            return "SGP state stack overflow";
+        case SGP_ERROR_STATE_STACK_UNDERFLOW:
+            return "SGP state stack underflow";
+        case SGP_ERROR_ALLOC_FAILED:
+            return "SGP failed to allocate buffers";
+        case SGP_ERROR_MAKE_VERTEX_BUFFER_FAILED:
+            return "SGP failed to create vertex buffer";
+        case SGP_ERROR_MAKE_WHITE_IMAGE_FAILED:
+            return "SGP failed to create white image";
+        case SGP_ERROR_MAKE_NEAREST_SAMPLER_FAILED:
+            return "SGP failed to create nearest sampler";
+        case SGP_ERROR_MAKE_COMMON_SHADER_FAILED:
+            return "SGP failed to create the common shader";
+        case SGP_ERROR_MAKE_COMMON_PIPELINE_FAILED:
+            return "SGP failed to create the common pipeline";
+        case SGP_ERROR_CAPTURE_INVALID:
+            return "SGP capture is invalid or incompatible";
+        case SGP_ERROR_CAPTURE_UNRESOLVED:
+            return "SGP capture resource could not be resolved";
+        case SGP_ERROR_MAKE_INDEX_BUFFER_FAILED:
+            return "SGP failed to create index buffer";
+        case SGP_ERROR_SPRITES_FULL:
+            return "SGP sprites buffer is full";
+        case SGP_ERROR_SPRITES_OVERFLOW:
+            return "SGP sprites buffer overflow";
+        case SGP_ERROR_MAKE_SPRITE_BUFFER_FAILED:
+            return "SGP failed to create sprite buffer";
+        case SGP_ERROR_CONTEXTS_FULL:
+            return "SGP contexts pool is full";
+        case SGP_ERROR_STATIC_BATCH_UNSUPPORTED:
+            return "SGP static batches only support draws with builtin pipelines";
+        case SGP_ERROR_ATLAS_FULL:
+            return "SGP atlas has no room left for the image";
+        case SGP_ERROR_MAKE_ATLAS_PAGE_FAILED:
+            return "SGP failed to create atlas page image";
+        case SGP_ERROR_STATIC_BATCH_PROJECTED:
+            return "SGP static batches don't support command lists changing the projection";
+        default:
+            return "Invalid error code";
+    }
+}
+
+sg_pipeline sgp_make_pipeline(const sgp_pipeline_desc* desc) {
+    sg_primitive_type primitive_type = _sg_def(desc->primitive_type, SG_PRIMITIVETYPE_TRIANGLES);
+    sgp_blend_mode blend_mode = _sg_def(desc->blend_mode, SGP_BLENDMODE_NONE);
+    sg_pixel_format color_format = _sg_def(desc->color_format, _sgp.desc.color_format);
+    sg_pixel_format depth_format = _sg_def(desc->depth_format, _sgp.desc.depth_format);
+    int sample_count = _sg_def(desc->sample_count, _sgp.desc.sample_count);
+    return _sgp_make_pipeline(desc->shader, primitive_type, SG_INDEXTYPE_NONE, blend_mode, color_format, depth_format, sample_count, desc->has_vs_color, false, false);
+}
+
+static inline sgp_mat2x3 _sgp_default_proj(int width, int height) {
+    // matrix to convert screen coordinate system
+    // to the usual the coordinate system used on the backends
+    sgp_mat2x3 mat = {{
+        {2.0f/(float)width,                0.0f, -1.0f},
+        {      0.0f,        -2.0f/(float)height,  1.0f}
+    }};
+    return mat;
+}
+
+static bool _sgp_grow_stream_buffer(sg_buffer* buf, size_t* buf_size, size_t size) {
+    _sgp_release_retired_buffers();
+    if (_sgp.num_retired_bufs >= _SGP_MAX_RETIRED_BUFFERS) {
+        return false;
+    }
+
+    // the current buffer may still be used by draws of this frame,
+    // so a new one is created and the current one is retired until the next frame
+    sg_buffer_desc buf_desc;
+    memset(&buf_desc, 0, sizeof(sg_buffer_desc));
+    buf_desc.size = *buf_size * 2;
+    while (buf_desc.size < size) {
+        buf_desc.size *= 2;
+    }
+    buf_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+    buf_desc.usage = SG_USAGE_STREAM;
+    sg_buffer new_buf = sg_make_buffer(&buf_desc);
+    if (sg_query_buffer_state(new_buf) != SG_RESOURCESTATE_VALID) {
+        sg_destroy_buffer(new_buf);
+        return false;
+    }
+    _sgp_retire_buffer(*buf);
+    *buf = new_buf;
+    *buf_size = buf_desc.size;
+    return true;
+}
+
+void sgp_begin(int width, int height) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    if (SOKOL_UNLIKELY(_sgp.cur_state >= _SGP_MAX_STACK_DEPTH)) {
+        _sgp_set_error(SGP_ERROR_STATE_STACK_OVERFLOW);
+        return;
+    }
+    _SGP_TRACE_BEGIN("sgp_begin", _sgp.cur_state);
+
+    // begin reset last error
+    _sgp.last_error = SGP_NO_ERROR;
+
+    // vertex buffers replaced in a previous frame are not used anymore
+    _sgp_release_retired_buffers();
+
+    // a nested frame of another size inside a command list projects its draws differently than the list frame
+    if (_sgp.command_list && _sgp.cur_state > 0 &&
+        (width != _sgp.state.frame_size.w || height != _sgp.state.frame_size.h)) {
+        _sgp.list_projected = true;
+    }
+
+    // save current state
+    _sgp.state_stack[_sgp.cur_state++] = _sgp.state;
+
+    // reset to default state
+    _sgp.state.frame_size.w = width; _sgp.state.frame_size.h = height;
+    _sgp.state.viewport.x = 0; _sgp.state.viewport.y = 0;
+    _sgp.state.viewport.w = width; _sgp.state.viewport.h = height;
+    _sgp.state.scissor.x = 0; _sgp.state.scissor.y = 0;
+    _sgp.state.scissor.w = -1; _sgp.state.scissor.h = -1;
+    _sgp.state.proj = _sgp_default_proj(width, height);
+    _sgp.state.transform = _sgp_mat3_identity;
+    _sgp.state.mvp = _sgp.state.proj;
+    _sgp.state.thickness = _sg_max(1.0f / width, 1.0f / height);
+    _sgp.state.color = _sgp_white_color;
+    memset(&_sgp.state.uniform, 0, sizeof(sgp_uniform));
+    _sgp.state.uniform.vs_size = 0;
+    _sgp.state.uniform.fs_size = 0;
+    _sgp.state.blend_mode = SGP_BLENDMODE_NONE;
+    _sgp.state.gpu_transform = false;
+    _sgp.state.batch_optimizer_depth = _sgp.desc.batch_optimizer_depth;
+    _sgp.state.batch_optimizer_max_move_vertices = _sgp.desc.batch_optimizer_max_move_vertices;
+    _sgp.state._base_vertex = _sgp.cur_vertex;
+    _sgp.state._base_uniform = _sgp.cur_uniform;
+    _sgp.state._base_command = _sgp.cur_command;
+    _sgp.state._base_sprite = _sgp.cur_sprite;
+    memset(&_sgp.state._stats, 0, sizeof(sgp_stats));
+
+    _sgp.state.textures.count = 1;
+    _sgp.state.textures.images[0] = _sgp.white_img;
+    _sgp.state.textures.samplers[0] = _sgp.nearest_smp;
+    sg_image img = {SG_INVALID_ID};
+    for (int i=1;i<SGP_TEXTURE_SLOTS;++i) {
+        _sgp.state.textures.images[i] = img;
+        _sgp.state.textures.samplers[i] = _sgp.nearest_smp;
+    }
+    _SGP_TRACE_END("sgp_begin");
+}
+
+static inline int16_t _sgp_pack_snorm16(float v) {
+    // clamp without branches, NaN included, then round to nearest by truncating a positive value
+    v = v > -1.0f ? v : -1.0f;
+    v = v < 1.0f ? v : 1.0f;
+    return (int16_t)((int32_t)(v * 32767.0f + 32768.5f) - 32768);
+}
+
+// checks that every draw uses a compact builtin pipeline, custom pipelines always take float vertices
+static bool _sgp_has_only_compact_draws(uint32_t start_command, uint32_t end_command) {
+    uint32_t compact_pip_id = SG_INVALID_ID;
+    for (uint32_t i=start_command;i<end_command;++i) {
+        const _sgp_command* cmd = &_sgp.commands[i];
+        if (cmd->cmd != SGP_COMMAND_DRAW || cmd->args.draw.pip.id == compact_pip_id) {
+            continue;
+        }
+        if (_sgp_lookup_float_pipeline(cmd->args.draw.pip).id == SG_INVALID_ID) {
+            return false;
+        }
+        compact_pip_id = cmd->args.draw.pip.id;
+    }
+    return true;
+}
+
+// packs vertices into the staging array, `fits` is cleared when a position or texture coordinate is out of the [-1, 1] range
+static _sgp_compact_vertex* _sgp_pack_compact_vertices(const sgp_vertex* vertices, uint32_t count, bool* fits) {
+    // the staging array follows the vertices capacity, which may have grown
+    if (_sgp.num_compact_vertices < count) {
+        _sgp_compact_vertex* compact_vertices = (_sgp_compact_vertex*) _sg_malloc(_sgp.num_vertices * sizeof(_sgp_compact_vertex));
+        if (!compact_vertices) {
+            return NULL;
+        }
+        _sg_free(_sgp.compact_vertices);
+        _sgp.compact_vertices = compact_vertices;
+        _sgp.num_compact_vertices = _sgp.num_vertices;
+    }
+    bool in_range = true;
+    for (uint32_t i=0;i<count;++i) {
+        const sgp_vertex* v = &vertices[i];
+        _sgp_compact_vertex* cv = &_sgp.compact_vertices[i];
+        // written so NaN is out of range too
+        in_range = in_range && v->position.x >= -1.0f && v->position.x <= 1.0f && v->position.y >= -1.0f && v->position.y <= 1.0f &&
+                   v->texcoord.x >= -1.0f && v->texcoord.x <= 1.0f && v->texcoord.y >= -1.0f && v->texcoord.y <= 1.0f;
+        cv->coord[0] = _sgp_pack_snorm16(v->position.x);
+        cv->coord[1] = _sgp_pack_snorm16(v->position.y);
+        cv->coord[2] = _sgp_pack_snorm16(v->texcoord.x);
+        cv->coord[3] = _sgp_pack_snorm16(v->texcoord.y);
+        cv->color = v->color;
+    }
+    *fits = in_range;
+    return _sgp.compact_vertices;
+}
+
+static bool _sgp_reserve_sort_scratch(void) {
+    if (!_sgp.sort_grid) {
+        _sgp.sort_grid = (_sgp_sort_cell*) _sg_malloc(_SGP_SORT_MAX_GRID_SIZE * _SGP_SORT_MAX_GRID_SIZE * sizeof(_sgp_sort_cell));
+        _sgp.sort_entries = (_sgp_sort_entry*) _sg_malloc(_SGP_SORT_MAX_GRID_SIZE * _SGP_SORT_MAX_GRID_SIZE * _SGP_SORT_CELL_ENTRIES * sizeof(_sgp_sort_entry));
+        if (!_sgp.sort_grid || !_sgp.sort_entries) {
+            _sg_free(_sgp.sort_grid);
+            _sg_free(_sgp.sort_entries);
+            _sgp.sort_grid = NULL;
+            _sgp.sort_entries = NULL;
+            return false;
+        }
+    }
+    // the scratch follows the commands and vertices capacity, which may have grown
+    if (_sgp.num_sort_commands < _sgp.num_commands) {
+        if (_sgp.sort_items) {
+            _sg_free(_sgp.sort_items);
+            _sg_free(_sgp.sort_keys);
+            _sg_free(_sgp.sort_commands);
+        }
+        _sgp.num_sort_commands = _sgp.num_commands;
+        // the keys hash table of a segment is a power of two, at least twice its number of draws
+        _sgp.num_sort_keys = 1;
+        while (_sgp.num_sort_keys < _sgp.num_sort_commands * 2) {
+            _sgp.num_sort_keys *= 2;
+        }
+        _sgp.sort_items = (_sgp_sort_item*) _sg_malloc(_sgp.num_sort_commands * 2 * sizeof(_sgp_sort_item));
+        _sgp.sort_keys = (uint32_t*) _sg_malloc(_sgp.num_sort_keys * sizeof(uint32_t));
+        _sgp.sort_commands = (_sgp_command*) _sg_malloc(_sgp.num_sort_commands * sizeof(_sgp_command));
+        if (!_sgp.sort_items || !_sgp.sort_keys || !_sgp.sort_commands) {
+            _sg_free(_sgp.sort_items);
+            _sg_free(_sgp.sort_keys);
+            _sg_free(_sgp.sort_commands);
+            _sgp.sort_items = NULL;
+            _sgp.sort_keys = NULL;
+            _sgp.sort_commands = NULL;
+            _sgp.num_sort_commands = 0;
+            _sgp.num_sort_keys = 0;
+            return false;
+        }
+    }
+    if (_sgp.num_sort_vertices < _sgp.num_vertices) {
+        sgp_vertex* sort_vertices = (sgp_vertex*) _sg_malloc(_sgp.num_vertices * sizeof(sgp_vertex));
+        if (!sort_vertices) {
+            return false;
+        }
+        _sg_free(_sgp.sort_vertices);
+        _sgp.sort_vertices = sort_vertices;
+        _sgp.num_sort_vertices = _sgp.num_vertices;
+    }
+    return true;
+}
+
+static bool _sgp_same_batch(const _sgp_draw_args* a, const _sgp_draw_args* b) {
+    return a->pip.id == b->pip.id &&
+           memcmp(&a->textures, &b->textures, sizeof(sgp_textures_uniform)) == 0 &&
+           (a->uniform_index == b->uniform_index ||
+            (a->uniform_index != _SGP_IMPOSSIBLE_ID && b->uniform_index != _SGP_IMPOSSIBLE_ID &&
+             memcmp(&_sgp.uniforms[a->uniform_index], &_sgp.uniforms[b->uniform_index], sizeof(sgp_uniform)) == 0));
+}
+
+static inline uint32_t _sgp_hash_u32(uint32_t hash, uint32_t value) {
+    return (hash ^ value) * 16777619U;
+}
+
+// finds the key of a draw in the hash table of the segment, the first draw of every key becomes its key
+static uint32_t _sgp_sort_key(uint32_t item_index, const _sgp_draw_args* args, uint32_t keys_mask) {
+    // consecutive draws often share their key
+    if (item_index > 0) {
+        uint32_t key = _sgp.sort_items[item_index - 1].key;
+        if (_sgp_same_batch(args, &_sgp.commands[_sgp.sort_items[key].command].args.draw)) {
+            return key;
         }
     }
+    uint32_t hash = _sgp_hash_u32(2166136261U, args->pip.id);
+    hash = _sgp_hash_u32(hash, args->textures.count);
+    for (uint32_t i=0;i<args->textures.count;++i) {
+        hash = _sgp_hash_u32(hash, args->textures.images[i].id);
+        hash = _sgp_hash_u32(hash, args->textures.samplers[i].id);
+    }
+    if (args->uniform_index != _SGP_IMPOSSIBLE_ID) {
+        const sgp_uniform* uniform = &_sgp.uniforms[args->uniform_index];
+        uint32_t num_words = ((uint32_t)uniform->vs_size + uniform->fs_size + 3) / 4;
+        for (uint32_t i=0;i<num_words;++i) {
+            uint32_t word;
+            memcpy(&word, &uniform->data.bytes[i*4], sizeof(uint32_t));
+            hash = _sgp_hash_u32(hash, word);
+        }
+    }
+    hash ^= hash >> 16;
+    uint32_t slot = hash & keys_mask;
+    while (_sgp.sort_keys[slot] != 0) {
+        uint32_t key = _sgp.sort_keys[slot] - 1;
+        if (_sgp_same_batch(args, &_sgp.commands[_sgp.sort_items[key].command].args.draw)) {
+            return key;
+        }
+        slot = (slot + 1) & keys_mask;
+    }
+    _sgp.sort_keys[slot] = item_index + 1;
+    return item_index;
+}
+
+static inline bool _sgp_regions_overlap(const _sgp_region* a, const _sgp_region* b) {
+    return a->x1 <= b->x2 && b->x1 <= a->x2 && a->y1 <= b->y2 && b->y1 <= a->y2;
+}
+
+// lowest layer a draw can move to, it stays above the previous draws it overlaps,
+// and above the ones of its own layer with a different key, the grid covers the bounds of the draws being sorted
+static uint32_t _sgp_sort_layer(const _sgp_region* bounds, uint32_t grid_size, const _sgp_region* region, uint32_t key) {
+    float scale_x = (float)grid_size / _sg_max(bounds->x2 - bounds->x1, 1e-6f);
+    float scale_y = (float)grid_size / _sg_max(bounds->y2 - bounds->y1, 1e-6f);
+    int max_cell = (int)grid_size - 1;
+    int x1 = _sg_clamp((int)((_sg_max(region->x1, bounds->x1) - bounds->x1) * scale_x), 0, max_cell);
+    int y1 = _sg_clamp((int)((_sg_max(region->y1, bounds->y1) - bounds->y1) * scale_y), 0, max_cell);
+    int x2 = _sg_clamp((int)((_sg_min(region->x2, bounds->x2) - bounds->x1) * scale_x), 0, max_cell);
+    int y2 = _sg_clamp((int)((_sg_min(region->y2, bounds->y2) - bounds->y1) * scale_y), 0, max_cell);
+    uint32_t layer = 0;
+    for (int y=y1;y<=y2;++y) {
+        for (int x=x1;x<=x2;++x) {
+            uint32_t cell_index = (uint32_t)y * grid_size + (uint32_t)x;
+            const _sgp_sort_cell* cell = &_sgp.sort_grid[cell_index];
+            if (cell->floor_layer > 0) {
+                layer = _sg_max(layer, cell->floor_layer - 1 + (cell->floor_key != key ? 1 : 0));
+            }
+            const _sgp_sort_entry* entries = &_sgp.sort_entries[cell_index * _SGP_SORT_CELL_ENTRIES];
+            for (uint32_t i=0;i<cell->num_entries;++i) {
+                if (_sgp_regions_overlap(&entries[i].region, region)) {
+                    layer = _sg_max(layer, entries[i].layer + (entries[i].key != key ? 1 : 0));
+                }
+            }
+        }
+    }
+    for (int y=y1;y<=y2;++y) {
+        for (int x=x1;x<=x2;++x) {
+            uint32_t cell_index = (uint32_t)y * grid_size + (uint32_t)x;
+            _sgp_sort_cell* cell = &_sgp.sort_grid[cell_index];
+            _sgp_sort_entry* entries = &_sgp.sort_entries[cell_index * _SGP_SORT_CELL_ENTRIES];
+            _sgp_sort_entry* entry;
+            if (cell->num_entries < _SGP_SORT_CELL_ENTRIES) {
+                entry = &entries[cell->num_entries++];
+            } else {
+                // the cell is full, fold the draw of the lowest layer into the floor
+                entry = &entries[0];
+                for (uint32_t i=1;i<_SGP_SORT_CELL_ENTRIES;++i) {
+                    if (entries[i].layer < entry->layer) {
+                        entry = &entries[i];
+                    }
+                }
+                if (entry->layer + 1 > cell->floor_layer) {
+                    cell->floor_layer = entry->layer + 1;
+                    cell->floor_key = entry->key;
+                } else if (entry->layer + 1 == cell->floor_layer && entry->key != cell->floor_key) {
+                    cell->floor_key = _SGP_IMPOSSIBLE_ID;
+                }
+            }
+            entry->region = *region;
+            entry->layer = layer;
+            entry->key = key;
+        }
+    }
+    return layer;
+}
+
+// stable counting sort of the draws by layer or key, both are lower than the number of draws
+static void _sgp_counting_sort_items(_sgp_sort_item* dst, const _sgp_sort_item* src, uint32_t num_items, bool by_layer) {
+    // the keys hash table is not needed anymore, it counts the draws of every value
+    uint32_t* counts = _sgp.sort_keys;
+    memset(counts, 0, (num_items + 1) * sizeof(uint32_t));
+    for (uint32_t i=0;i<num_items;++i) {
+        counts[(by_layer ? src[i].layer : src[i].key) + 1]++;
+    }
+    for (uint32_t i=1;i<=num_items;++i) {
+        counts[i] += counts[i-1];
+    }
+    for (uint32_t i=0;i<num_items;++i) {
+        dst[counts[by_layer ? src[i].layer : src[i].key]++] = src[i];
+    }
+}
+
+// orders the keys of every layer to start with the last key of the layer below,
+// and to end with a key found in the layer above, so these draws are merged too
+static void _sgp_rank_sort_layers(_sgp_sort_item* items, _sgp_sort_item* tmp_items, uint32_t num_items) {
+    // the keys hash table is not needed anymore, it marks the keys of the layer above
+    uint32_t* marks = _sgp.sort_keys;
+    memset(marks, 0, num_items * sizeof(uint32_t));
+    uint32_t prev_key = _SGP_IMPOSSIBLE_ID;
+    uint32_t begin = 0;
+    while (begin < num_items) {
+        uint32_t layer = items[begin].layer;
+        uint32_t end = begin + 1;
+        while (end < num_items && items[end].layer == layer) {
+            end++;
+        }
+        uint32_t next_end = end;
+        while (next_end < num_items && items[next_end].layer == layer + 1) {
+            marks[items[next_end].key] = layer + 1;
+            next_end++;
+        }
+        // stable partition of the layer in draws of the previous key, other keys and keys of the next layer
+        if (items[begin].key != items[end - 1].key) {
+            uint32_t num_tmp_items = 0;
+            for (uint32_t rank=0;rank<3;++rank) {
+                for (uint32_t i=begin;i<end;++i) {
+                    uint32_t key = items[i].key;
+                    uint32_t item_rank = key == prev_key ? 0 : (marks[key] == layer + 1 ? 2 : 1);
+                    if (item_rank == rank) {
+                        tmp_items[num_tmp_items++] = items[i];
+                    }
+                }
+            }
+            memcpy(&items[begin], tmp_items, num_tmp_items * sizeof(_sgp_sort_item));
+        }
+        prev_key = items[end - 1].key;
+        begin = end;
+    }
+}
+
+/*
+Reorders the draw commands queued since `sgp_begin` into fewer batches, when sorted batching is enabled.
+The draws between viewport, scissor, instanced and static draw commands are stably sorted by layer and key,
+where a draw gets the lowest layer that keeps it above every previous draw it may overlap,
+then consecutive draws with the same key are merged and their vertices are copied in the new order.
+Returns false and leaves the queue untouched when the scratch memory or the vertices capacity is not enough.
+*/
+static bool _sgp_sort_draws(uint32_t base_command, uint32_t* end_command, uint32_t base_vertex, uint32_t* end_vertex, sgp_stats* stats) {
+    if (!_sgp_reserve_sort_scratch()) {
+        return false;
+    }
+    uint32_t max_vertices = _sgp.num_vertices - base_vertex;
+    uint32_t num_out_commands = 0;
+    uint32_t num_out_vertices = 0;
+    uint32_t num_kept_vertices = _SGP_IMPOSSIBLE_ID; // vertices before the first moved draw are copied only if needed
+    uint32_t num_merged = 0;
+    uint32_t i = base_command;
+    while (i < *end_command) {
+        const _sgp_command* cmd = &_sgp.commands[i];
+        if (cmd->cmd == SGP_COMMAND_NONE) {
+            i++;
+            continue;
+        }
+        // viewport, scissor, instanced and static draws are kept in place
+        if (cmd->cmd != SGP_COMMAND_DRAW) {
+            _sgp.sort_commands[num_out_commands++] = *cmd;
+            i++;
+            continue;
+        }
+
+        // the hash table of keys is sized for the draws of this segment, and the grid covers their bounds
+        uint32_t segment_end = i;
+        uint32_t num_draws = 0;
+        _sgp_region bounds = {1.0f, 1.0f, -1.0f, -1.0f};
+        for (;segment_end < *end_command;++segment_end) {
+            const _sgp_command* segment_cmd = &_sgp.commands[segment_end];
+            if (segment_cmd->cmd == SGP_COMMAND_NONE) {
+                continue;
+            }
+            if (segment_cmd->cmd != SGP_COMMAND_DRAW) {
+                break;
+            }
+            const _sgp_region* region = &segment_cmd->args.draw.region;
+            bounds.x1 = _sg_min(bounds.x1, _sg_max(region->x1, -1.0f));
+            bounds.y1 = _sg_min(bounds.y1, _sg_max(region->y1, -1.0f));
+            bounds.x2 = _sg_max(bounds.x2, _sg_min(region->x2, 1.0f));
+            bounds.y2 = _sg_max(bounds.y2, _sg_min(region->y2, 1.0f));
+            num_draws++;
+        }
+        uint32_t keys_size = 1;
+        while (keys_size < num_draws * 2) {
+            keys_size *= 2;
+        }
+        SOKOL_ASSERT(keys_size <= _sgp.num_sort_keys);
+        memset(_sgp.sort_keys, 0, keys_size * sizeof(uint32_t));
+        // about one cell per draw, so cells hold few draws
+        uint32_t grid_size = _SGP_SORT_MIN_GRID_SIZE;
+        while (grid_size < _SGP_SORT_MAX_GRID_SIZE && grid_size * grid_size < num_draws) {
+            grid_size *= 2;
+        }
+        memset(_sgp.sort_grid, 0, grid_size * grid_size * sizeof(_sgp_sort_cell));
+
+        // assign layers and keys in submission order
+        uint32_t num_items = 0;
+        for (;i < segment_end;++i) {
+            const _sgp_draw_args* args = &_sgp.commands[i].args.draw;
+            if (_sgp.commands[i].cmd == SGP_COMMAND_NONE) {
+                continue;
+            }
+            _sgp_sort_item* item = &_sgp.sort_items[num_items];
+            item->command = i;
+            // strips can't be merged, they get a key of their own
+            const _sg_pipeline_t* pip = _sg_lookup_pipeline(&_sg.pools, args->pip.id);
+            sg_primitive_type primitive_type = pip ? pip->cmn.primitive_type : SG_PRIMITIVETYPE_TRIANGLES;
+            if (primitive_type == SG_PRIMITIVETYPE_TRIANGLE_STRIP || primitive_type == SG_PRIMITIVETYPE_LINE_STRIP) {
+                item->key = num_items;
+            } else {
+                item->key = _sgp_sort_key(num_items, args, keys_size - 1);
+            }
+            item->layer = _sgp_sort_layer(&bounds, grid_size, &args->region, item->key);
+            num_items++;
+        }
+        _sgp_sort_item* tmp_items = &_sgp.sort_items[_sgp.num_sort_commands];
+        _sgp_counting_sort_items(tmp_items, _sgp.sort_items, num_items, false);
+        _sgp_counting_sort_items(_sgp.sort_items, tmp_items, num_items, true);
+        _sgp_rank_sort_layers(_sgp.sort_items, tmp_items, num_items);
+
+        // copy the draws in the new order, merging consecutive draws of the same key
+        _sgp_command* prev_cmd = NULL;
+        uint32_t prev_key = _SGP_IMPOSSIBLE_ID;
+        for (uint32_t j=0;j<num_items;++j) {
+            const _sgp_command* src = &_sgp.commands[_sgp.sort_items[j].command];
+            const _sgp_draw_args* args = &src->args.draw;
+            bool merge = prev_cmd && prev_key == _sgp.sort_items[j].key;
+            if (!merge && args->indexed) {
+                // indexed quads must start at a multiple of 4 vertices
+                num_out_vertices = (num_out_vertices + 3) & ~3U;
+            }
+            if (num_out_vertices + args->num_vertices > max_vertices) {
+                return false;
+            }
+            if (num_kept_vertices == _SGP_IMPOSSIBLE_ID && args->vertex_index != base_vertex + num_out_vertices) {
+                num_kept_vertices = num_out_vertices;
+            }
+            if (num_kept_vertices != _SGP_IMPOSSIBLE_ID) {
+                memcpy(&_sgp.sort_vertices[num_out_vertices], &_sgp.vertices[args->vertex_index], args->num_vertices * sizeof(sgp_vertex));
+            }
+            if (merge) {
+                _sgp_region* region = &prev_cmd->args.draw.region;
+                region->x1 = _sg_min(region->x1, args->region.x1);
+                region->y1 = _sg_min(region->y1, args->region.y1);
+                region->x2 = _sg_max(region->x2, args->region.x2);
+                region->y2 = _sg_max(region->y2, args->region.y2);
+                prev_cmd->args.draw.num_vertices += args->num_vertices;
+                num_merged++;
+            } else {
+                prev_cmd = &_sgp.sort_commands[num_out_commands++];
+                *prev_cmd = *src;
+                prev_cmd->args.draw.vertex_index = base_vertex + num_out_vertices;
+                prev_key = _sgp.sort_items[j].key;
+            }
+            num_out_vertices += args->num_vertices;
+        }
+    }
+
+    memcpy(&_sgp.commands[base_command], _sgp.sort_commands, num_out_commands * sizeof(_sgp_command));
+    if (num_kept_vertices != _SGP_IMPOSSIBLE_ID) {
+        memcpy(&_sgp.vertices[base_vertex + num_kept_vertices], &_sgp.sort_vertices[num_kept_vertices], (num_out_vertices - num_kept_vertices) * sizeof(sgp_vertex));
+    }
+    *end_command = base_command + num_out_commands;
+    *end_vertex = base_vertex + num_out_vertices;
+    stats->num_merged_sorted += num_merged;
+    return true;
+}
+
+static void _sgp_update_high_water_marks(void) {
+    sgp_high_water_marks* marks = &_sgp.marks;
+    marks->num_vertices = _sg_max(marks->num_vertices, _sgp.cur_vertex);
+    marks->num_commands = _sg_max(marks->num_commands, _sgp.cur_command);
+    marks->num_uniforms = _sg_max(marks->num_uniforms, _sgp.cur_uniform);
+    marks->num_sprites = _sg_max(marks->num_sprites, _sgp.cur_sprite);
+
+    // warn only once, the marks can still be queried later
+    if (_sgp.desc.capacity_callback.func && !_sgp.capacity_warned) {
+        float threshold = _sgp.desc.capacity_callback.threshold;
+        if (marks->num_vertices >= threshold * _sgp.num_vertices ||
+            marks->num_commands >= threshold * _sgp.num_commands ||
+            marks->num_uniforms >= threshold * _sgp.num_uniforms ||
+            marks->num_sprites >= threshold * _sgp.num_sprites) {
+            _sgp.capacity_warned = true;
+            _sgp.desc.capacity_callback.func(marks, _sgp.desc.capacity_callback.user_data);
+        }
+    }
+}
+
+// returns the slot of the first texture of a draw, taking a free slot when it is not bound yet,
+// or _SGP_MULTI_TEXTURE_SLOTS when all slots are taken
+static inline uint32_t _sgp_multi_texture_slot(sgp_textures_uniform* textures, const sgp_textures_uniform* draw_textures) {
+    for (uint32_t slot=0;slot<textures->count;++slot) {
+        if (textures->images[slot].id == draw_textures->images[0].id && textures->samplers[slot].id == draw_textures->samplers[0].id) {
+            return slot;
+        }
+    }
+    if (textures->count >= _SGP_MULTI_TEXTURE_SLOTS) {
+        return _SGP_MULTI_TEXTURE_SLOTS;
+    }
+    textures->images[textures->count] = draw_textures->images[0];
+    textures->samplers[textures->count] = draw_textures->samplers[0];
+    return textures->count++;
+}
+
+/*
+Packs consecutive draws of builtin pipelines that differ only by their texture into draws binding up to 4 textures,
+when multi texture batching is enabled. The first draw of each pack covers the vertices of all of them,
+and the texture slot of every packed vertex is written to the vertex slots, indexed from the base vertex.
+Returns whether any draw was packed, so the vertex slots must be uploaded.
+*/
+static bool _sgp_pack_multi_texture_draws(uint32_t base_command, uint32_t end_command, uint32_t base_vertex, sgp_stats* stats) {
+    // the slots follow the vertices capacity, which may have grown
+    if (_sgp.num_vertex_slots < _sgp.num_vertices) {
+        float* vertex_slots = (float*) _sg_malloc(_sgp.num_vertices * sizeof(float));
+        if (!vertex_slots) {
+            return false;
+        }
+        memset(vertex_slots, 0, _sgp.num_vertices * sizeof(float));
+        _sg_free(_sgp.vertex_slots);
+        _sgp.vertex_slots = vertex_slots;
+        _sgp.num_vertex_slots = _sgp.num_vertices;
+    }
+
+    bool packed = false;
+    uint32_t cur_pip_id = SG_INVALID_ID;
+    sg_pipeline multi_texture_pip = {SG_INVALID_ID};
+    uint32_t i = base_command;
+    while (i < end_command) {
+        _sgp_command* first_cmd = &_sgp.commands[i];
+        _sgp_draw_args* first = &first_cmd->args.draw;
+        if (first_cmd->cmd != SGP_COMMAND_DRAW || first->num_vertices == 0 || first->textures.count != 1) {
+            ++i;
+            continue;
+        }
+        if (first->pip.id != cur_pip_id) {
+            cur_pip_id = first->pip.id;
+            multi_texture_pip = _sgp_lookup_multi_texture_pipeline(first->pip);
+        }
+        if (multi_texture_pip.id == SG_INVALID_ID) {
+            ++i;
+            continue;
+        }
+
+        // take the following draws while they continue the vertices and their textures fit in the slots
+        sgp_textures_uniform textures = first->textures;
+        _sgp_region region = first->region;
+        uint32_t end_vertex = first->vertex_index + first->num_vertices;
+        uint32_t num_packed = 1;
+        uint32_t j = i + 1;
+        for (;j<end_command;++j) {
+            _sgp_command* cmd = &_sgp.commands[j];
+            if (cmd->cmd == SGP_COMMAND_NONE) {
+                continue;
+            }
+            _sgp_draw_args* args = &cmd->args.draw;
+            if (cmd->cmd != SGP_COMMAND_DRAW || args->pip.id != first->pip.id || args->uniform_index != first->uniform_index) {
+                break;
+            }
+            if (args->num_vertices == 0) {
+                continue;
+            }
+            if (args->vertex_index != end_vertex || args->textures.count != 1 ||
+                _sgp_multi_texture_slot(&textures, &args->textures) >= _SGP_MULTI_TEXTURE_SLOTS) {
+                break;
+            }
+            region.x1 = _sg_min(region.x1, args->region.x1);
+            region.y1 = _sg_min(region.y1, args->region.y1);
+            region.x2 = _sg_max(region.x2, args->region.x2);
+            region.y2 = _sg_max(region.y2, args->region.y2);
+            end_vertex += args->num_vertices;
+            num_packed++;
+        }
+        if (textures.count < 2) {
+            // the draws share a texture, there is nothing to pack
+            i = j;
+            continue;
+        }
+
+        // write the texture slot of each vertex, then the first draw takes the vertices of the others
+        for (uint32_t k=i;k<j;++k) {
+            _sgp_command* cmd = &_sgp.commands[k];
+            if (cmd->cmd != SGP_COMMAND_DRAW || cmd->args.draw.num_vertices == 0) {
+                continue;
+            }
+            _sgp_draw_args* args = &cmd->args.draw;
+            float slot = (float)_sgp_multi_texture_slot(&textures, &args->textures);
+            float* slots = &_sgp.vertex_slots[args->vertex_index - base_vertex];
+            for (uint32_t v=0;v<args->num_vertices;++v) {
+                slots[v] = slot;
+            }
+            if (k != i) {
+                cmd->cmd = SGP_COMMAND_NONE;
+            }
+        }
+        for (uint32_t slot=textures.count;slot<_SGP_MULTI_TEXTURE_SLOTS;++slot) {
+            // unused slots must still be bound
+            textures.images[slot] = _sgp.white_img;
+            textures.samplers[slot] = _sgp.nearest_smp;
+        }
+        textures.count = _SGP_MULTI_TEXTURE_SLOTS;
+        first->pip = multi_texture_pip;
+        first->textures = textures;
+        first->region = region;
+        first->num_vertices = end_vertex - first->vertex_index;
+        stats->num_merged_textures += num_packed - 1;
+        packed = true;
+        i = j;
+    }
+    return packed;
+}
+
+static void _sgp_merge_grid_add(_sgp_region region, uint32_t command_index);
+
+void sgp_flush(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    SOKOL_ASSERT(!_sgp.command_list);
+    _SGP_TRACE_BEGIN("sgp_flush", _sgp.cur_command - _sgp.state._base_command);
+
+    uint32_t end_command = _sgp.cur_command;
+    uint32_t end_vertex = _sgp.cur_vertex;
+    uint32_t end_sprite = _sgp.cur_sprite;
+    _sgp_update_high_water_marks();
+
+    // rewind indexes
+    _sgp.cur_vertex = _sgp.state._base_vertex;
+    _sgp.cur_uniform = _sgp.state._base_uniform;
+    _sgp.cur_command = _sgp.state._base_command;
+    _sgp.cur_sprite = _sgp.state._base_sprite;
+    if (_sgp.state._base_command == 0) {
+        memset(_sgp.merge_grid, 0, sizeof(_sgp.merge_grid));
+        _sgp.merge_grid_last = 0;
+        _sgp.merge_grid_large = 0;
+    } else if (_sgp.merge_grid_last > _sgp.state._base_command) {
+        // a nested flush keeps the marks of the outer draw commands still queued,
+        // its last draw command is marked too, as its index will be reused
+        _sgp_merge_grid_add(_sgp.commands[_sgp.merge_grid_last - 1].args.draw.region, _sgp.merge_grid_last - 1);
+        _sgp.merge_grid_last = 0;
+    }
+
+    // take recording statistics, the flush statistics are collected below
+    sgp_stats* stats = &_sgp.stats;
+    *stats = _sgp.state._stats;
+    memset(&_sgp.state._stats, 0, sizeof(sgp_stats));
+
+    // draw nothing on errors
+    if (_sgp.last_error != SGP_NO_ERROR) {
+        _SGP_TRACE_END("sgp_flush");
+        return;
+    }
+
+    // nothing to be drawn
+    if (end_command <= _sgp.state._base_command) {
+        _SGP_TRACE_END("sgp_flush");
+        return;
+    }
+
+    // reorder draws into fewer batches, they are flushed in submission order when it can't be done
+    if (_sgp.desc.sorted_batching) {
+        _SGP_TRACE_BEGIN("_sgp_sort_draws", end_command - _sgp.state._base_command);
+        _sgp_sort_draws(_sgp.state._base_command, &end_command, _sgp.state._base_vertex, &end_vertex, stats);
+        _SGP_TRACE_END("_sgp_sort_draws");
+    }
+
+    // pack draws that differ only by their texture, their texture slots are uploaded along the vertices
+    bool multi_texture = false;
+    if (_sgp.desc.multi_texture_batching) {
+        _SGP_TRACE_BEGIN("_sgp_pack_multi_texture_draws", end_command - _sgp.state._base_command);
+        multi_texture = _sgp_pack_multi_texture_draws(_sgp.state._base_command, end_command, _sgp.state._base_vertex, stats);
+        _SGP_TRACE_END("_sgp_pack_multi_texture_draws");
+    }
+
+    // pack vertices when all of them fit compact vertices, otherwise the float ones are uploaded
+    // and the draws use the float variants of their pipelines, so nothing is clamped
+    uint32_t base_vertex = _sgp.state._base_vertex;
+    sg_range vertex_range = {&_sgp.vertices[base_vertex], (end_vertex - base_vertex) * sizeof(sgp_vertex)};
+    bool compact = false;
+    if (_sgp.desc.compact_vertices && _sgp_has_only_compact_draws(_sgp.state._base_command, end_command)) {
+        _SGP_TRACE_BEGIN("_sgp_pack_compact_vertices", end_vertex - base_vertex);
+        const _sgp_compact_vertex* compact_vertices = _sgp_pack_compact_vertices(&_sgp.vertices[base_vertex], end_vertex - base_vertex, &compact);
+        _SGP_TRACE_END("_sgp_pack_compact_vertices");
+        if (!compact_vertices) {
+            _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+            _SGP_TRACE_END("sgp_flush");
+            return;
+        }
+        if (compact) {
+            vertex_range.ptr = compact_vertices;
+            vertex_range.size = (end_vertex - base_vertex) * sizeof(_sgp_compact_vertex);
+        }
+    }
+    uint32_t num_vertices = (uint32_t)vertex_range.size;
+    if (_sgp.desc.grow_buffers && sg_query_buffer_will_overflow(_sgp.vertex_buf, num_vertices)) {
+        _sgp_grow_stream_buffer(&_sgp.vertex_buf, &_sgp.vertex_buf_size, num_vertices);
+    }
+    uint32_t num_quads = (end_vertex - base_vertex + 3) / 4;
+    if (_sgp.index_buf.id != SG_INVALID_ID && num_quads > _sgp.index_buf_quads) {
+        // only happens when growing vertices, the index buffer is created again to cover them
+        if (!_sgp_make_index_buffer(_sg_max(_sgp.index_buf_quads * 2, num_quads))) {
+            _sgp_set_error(SGP_ERROR_MAKE_INDEX_BUFFER_FAILED);
+            _SGP_TRACE_END("sgp_flush");
+            return;
+        }
+    }
+    _SGP_TRACE_BEGIN("sg_append_buffer", num_vertices);
+    int offset;
+    _SGP_FLUSH_TIMED(upload_ns, offset = sg_append_buffer(_sgp.vertex_buf, &vertex_range));
+    _SGP_TRACE_END("sg_append_buffer");
+    if (sg_query_buffer_overflow(_sgp.vertex_buf)) {
+        _sgp_set_error(SGP_ERROR_VERTICES_OVERFLOW);
+        _SGP_TRACE_END("sgp_flush");
+        return;
+    }
+    stats->num_uploaded_vertices = end_vertex - base_vertex;
+    stats->num_compact_vertices = compact ? end_vertex - base_vertex : 0;
+
+    // upload texture slots, only when some draws were packed
+    int slot_offset = 0;
+    if (multi_texture) {
+        uint32_t num_slots = (end_vertex - base_vertex) * sizeof(float);
+        sg_range slot_range = {_sgp.vertex_slots, num_slots};
+        if (_sgp.desc.grow_buffers && sg_query_buffer_will_overflow(_sgp.slot_buf, num_slots)) {
+            _sgp_grow_stream_buffer(&_sgp.slot_buf, &_sgp.slot_buf_size, num_slots);
+        }
+        _SGP_TRACE_BEGIN("sg_append_buffer", num_slots);
+        _SGP_FLUSH_TIMED(upload_ns, slot_offset = sg_append_buffer(_sgp.slot_buf, &slot_range));
+        _SGP_TRACE_END("sg_append_buffer");
+        if (sg_query_buffer_overflow(_sgp.slot_buf)) {
+            _sgp_set_error(SGP_ERROR_VERTICES_OVERFLOW);
+            _SGP_TRACE_END("sgp_flush");
+            return;
+        }
+    }
+
+    // upload sprites, only when some were drawn with instancing
+    uint32_t base_sprite = _sgp.state._base_sprite;
+    int sprite_offset = 0;
+    if (end_sprite > base_sprite) {
+        uint32_t num_sprites = (end_sprite - base_sprite) * sizeof(sgp_sprite);
+        sg_range sprite_range = {&_sgp.sprites[base_sprite], num_sprites};
+        if (_sgp.desc.grow_buffers && sg_query_buffer_will_overflow(_sgp.sprite_buf, num_sprites)) {
+            _sgp_grow_stream_buffer(&_sgp.sprite_buf, &_sgp.sprite_buf_size, num_sprites);
+        }
+        _SGP_TRACE_BEGIN("sg_append_buffer", num_sprites);
+        _SGP_FLUSH_TIMED(upload_ns, sprite_offset = sg_append_buffer(_sgp.sprite_buf, &sprite_range));
+        _SGP_TRACE_END("sg_append_buffer");
+        if (sg_query_buffer_overflow(_sgp.sprite_buf)) {
+            _sgp_set_error(SGP_ERROR_SPRITES_OVERFLOW);
+            _SGP_TRACE_END("sgp_flush");
+            return;
+        }
+        stats->num_uploaded_sprites = end_sprite - base_sprite;
+    }
+
+    uint32_t cur_pip_id = _SGP_IMPOSSIBLE_ID;
+    uint32_t cur_uniform_index = _SGP_IMPOSSIBLE_ID;
+    uint32_t cur_imgs_id[SGP_TEXTURE_SLOTS];
+    for (int i=0;i<SGP_TEXTURE_SLOTS;++i) {
+        cur_imgs_id[i] = _SGP_IMPOSSIBLE_ID;
+    }
+
+    // define the resource bindings
+    sg_bindings bind;
+    memset(&bind, 0, sizeof(sg_bindings));
+    bind.vertex_buffers[0] = _sgp.vertex_buf;
+    bind.vertex_buffer_offsets[0] = offset;
+    if (multi_texture) {
+        // kept bound for all draws, pipelines without texture slots just ignore it
+        bind.vertex_buffers[1] = _sgp.slot_buf;
+        bind.vertex_buffer_offsets[1] = slot_offset;
+    }
+
+    // flush commands
+    for (uint32_t i = _sgp.state._base_command; i < end_command; ++i) {
+        _sgp_command* cmd = &_sgp.commands[i];
+        _SGP_TRACE_BEGIN(_sgp_command_names[cmd->cmd], i);
+        switch (cmd->cmd) {
+            case SGP_COMMAND_VIEWPORT: {
+                sgp_irect* args = &cmd->args.viewport;
+                _SGP_FLUSH_TIMED(viewport_ns, sg_apply_viewport(args->x, args->y, args->w, args->h, true));
+                stats->num_viewport_applies++;
+                break;
+            }
+            case SGP_COMMAND_SCISSOR: {
+                sgp_irect* args = &cmd->args.scissor;
+                _SGP_FLUSH_TIMED(scissor_ns, sg_apply_scissor_rect(args->x, args->y, args->w, args->h, true));
+                stats->num_scissor_applies++;
+                break;
+            }
+            case SGP_COMMAND_DRAW:
+            case SGP_COMMAND_DRAW_INSTANCED:
+            case SGP_COMMAND_DRAW_STATIC: {
+                _sgp_draw_args* args = &cmd->args.draw;
+                if (args->num_vertices == 0) {
+                    break;
+                }
+                bool instanced = cmd->cmd == SGP_COMMAND_DRAW_INSTANCED;
+                bool is_static = cmd->cmd == SGP_COMMAND_DRAW_STATIC;
+                bool apply_bindings = false;
+                bool textures_changed = false;
+                bool apply_uniforms = false;
+                // pipeline
+                if (args->pip.id != cur_pip_id) {
+                    // when pipeline changes we need to re-apply uniforms and bindings
+                    cur_uniform_index = _SGP_IMPOSSIBLE_ID;
+                    apply_bindings = true;
+                    cur_pip_id = args->pip.id;
+                    if (instanced) {
+                        bind.vertex_buffers[0] = _sgp.sprite_buf;
+                        bind.index_buffer.id = SG_INVALID_ID;
+                    } else {
+                        bind.vertex_buffers[0] = _sgp.vertex_buf;
+                        bind.vertex_buffer_offsets[0] = offset;
+                        bind.index_buffer.id = args->indexed ? _sgp.index_buf.id : SG_INVALID_ID;
+                    }
+                    sg_pipeline pip = args->pip;
+                    if (_sgp.desc.compact_vertices && !compact && !instanced && !is_static) {
+                        pip = _sgp_lookup_float_pipeline(pip);
+                        pip = pip.id != SG_INVALID_ID ? pip : args->pip;
+                    }
+                    _SGP_FLUSH_TIMED(pipeline_ns, sg_apply_pipeline(pip));
+                    stats->num_pipeline_applies++;
+                }
+                // bindings
+                for (uint32_t j=0;j<SGP_TEXTURE_SLOTS;++j) {
+                    uint32_t img_id = SG_INVALID_ID;
+                    uint32_t smp_id = SG_INVALID_ID;
+                    if (j < args->textures.count) {
+                        img_id = args->textures.images[j].id;
+                        if (img_id != SG_INVALID_ID) {
+                            smp_id = args->textures.samplers[j].id;
+                        }
+                    }
+                    if (cur_imgs_id[j] != img_id) {
+                        // when an image binding change we need to re-apply bindings
+                        cur_imgs_id[j] = img_id;
+                        bind.images[j].id = img_id;
+                        bind.samplers[j].id = smp_id;
+                        apply_bindings = true;
+                        textures_changed = true;
+                    }
+                }
+                if (instanced) {
+                    // there is no base instance in sg_draw, the sprites are reached with the buffer offset
+                    int instance_offset = sprite_offset + (int)((args->vertex_index - base_sprite) * sizeof(sgp_sprite));
+                    if (bind.vertex_buffer_offsets[0] != instance_offset) {
+                        bind.vertex_buffer_offsets[0] = instance_offset;
+                        apply_bindings = true;
+                    }
+                } else {
+                    // static batches draw from their own vertex buffer
+                    sg_buffer vertex_buf = is_static ? args->vertex_buf : _sgp.vertex_buf;
+                    int vertex_offset = is_static ? 0 : offset;
+                    if (bind.vertex_buffers[0].id != vertex_buf.id || bind.vertex_buffer_offsets[0] != vertex_offset) {
+                        bind.vertex_buffers[0] = vertex_buf;
+                        bind.vertex_buffer_offsets[0] = vertex_offset;
+                        apply_bindings = true;
+                    }
+                }
+                if (apply_bindings) {
+                    _SGP_FLUSH_TIMED(bindings_ns, sg_apply_bindings(&bind));
+                    stats->num_bindings_applies++;
+                    if (textures_changed) {
+                        stats->num_bindings_by_textures++;
+                    } else {
+                        stats->num_bindings_by_pipeline++;
+                    }
+                    apply_uniforms = true;
+                }
+                // uniforms
+                if (cur_uniform_index != args->uniform_index) {
+                    cur_uniform_index = args->uniform_index;
+                    apply_uniforms = true;
+                }
+                if (apply_uniforms && cur_uniform_index != _SGP_IMPOSSIBLE_ID) {
+                    sgp_uniform* uniform = &_sgp.uniforms[cur_uniform_index];
+                    if (uniform->vs_size > 0) {
+                        sg_range uniform_range = {&uniform->data.bytes[0], uniform->vs_size};
+                        _SGP_FLUSH_TIMED(uniforms_ns, sg_apply_uniforms(SGP_UNIFORM_SLOT_VERTEX, &uniform_range));
+                        stats->num_uniforms_applies++;
+                    }
+                    if (uniform->fs_size > 0) {
+                        sg_range uniform_range = {&uniform->data.bytes[uniform->vs_size], uniform->fs_size};
+                        _SGP_FLUSH_TIMED(uniforms_ns, sg_apply_uniforms(SGP_UNIFORM_SLOT_FRAGMENT, &uniform_range));
+                        stats->num_uniforms_applies++;
+                    }
+                }
+                //  draw
+                if (instanced) {
+                    // every sprite is a 4 vertices triangle strip expanded by the vertex shader
+                    _SGP_FLUSH_TIMED(draw_ns, sg_draw(0, 4, (int)args->num_vertices));
+                } else if (is_static) {
+                    _SGP_FLUSH_TIMED(draw_ns, sg_draw((int)args->vertex_index, (int)args->num_vertices, 1));
+                } else if (args->indexed) {
+                    // quads start at a multiple of 4 vertices from the base vertex, see _sgp_next_quad_vertices
+                    _SGP_FLUSH_TIMED(draw_ns, sg_draw((int)((args->vertex_index - base_vertex) / 4 * 6), (int)(args->num_vertices / 4 * 6), 1));
+                } else {
+                    _SGP_FLUSH_TIMED(draw_ns, sg_draw((int)(args->vertex_index - base_vertex), (int)args->num_vertices, 1));
+                }
+                stats->num_draw_calls++;
+                break;
+            }
+            case SGP_COMMAND_NONE: {
+                // this command was optimized away
+                break;
+            }
+        }
+        _SGP_TRACE_END(_sgp_command_names[cmd->cmd]);
+    }
+    _SGP_TRACE_END("sgp_flush");
+}
+
+void sgp_end(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    if (SOKOL_UNLIKELY(_sgp.cur_state <= 0)) {
+        _sgp_set_error(SGP_ERROR_STATE_STACK_UNDERFLOW);
+        return;
+    }
 
-    return sg_make_shader(&desc);
+    // restore old state
+    _sgp.state = _sgp.state_stack[--_sgp.cur_state];
 }
 
-void sgp_setup(const sgp_desc* desc) {
-    SOKOL_ASSERT(_sgp.init_cookie == 0);
+static inline sgp_mat2x3 _sgp_mul_proj_transform(sgp_mat2x3* proj, sgp_mat2x3* transform) {
+    // this actually multiply matrix projection and transform matrix in an optimized way
+    float x = proj->v[0][0], y = proj->v[1][1];
+    sgp_mat2x3 m = {{
+        {x*transform->v[0][0], x*transform->v[0][1], x*transform->v[0][2]+proj->v[0][2]},
+        {y*transform->v[1][0], y*transform->v[1][1], y*transform->v[1][2]+proj->v[1][2]}
+    }};
+    return m;
+}
 
-    if (!sg_isvalid()) {
-        _sgp_set_error(SGP_ERROR_SOKOL_INVALID);
-        return;
+void sgp_project(float left, float right, float top, float bottom) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    float w = right - left;
+    float h = top - bottom;
+    sgp_mat2x3 proj = {{
+        {2.0f/w,   0.0f,  -(right+left)/w},
+        {0.0f,   2.0f/h,  -(top+bottom)/h}
+    }};
+    _sgp.state.proj = proj;
+    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+    if (_sgp.command_list) {
+        _sgp.list_projected = true;
     }
+}
 
-    // init
-    _sgp.init_cookie = _SGP_INIT_COOKIE;
-    _sgp.last_error = SGP_NO_ERROR;
+void sgp_reset_project(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    _sgp.state.proj = _sgp_default_proj(_sgp.state.viewport.w, _sgp.state.viewport.h);
+    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+}
 
-    // set desc default values
-    _sgp.desc = *desc;
-    _sgp.desc.max_vertices = _sg_def(desc->max_vertices, _SGP_DEFAULT_MAX_VERTICES);
-    _sgp.desc.max_commands = _sg_def(desc->max_commands, _SGP_DEFAULT_MAX_COMMANDS);
-    _sgp.desc.color_format = _sg_def(desc->color_format, _sg.desc.environment.defaults.color_format);
-    _sgp.desc.depth_format = _sg_def(desc->depth_format, _sg.desc.environment.defaults.depth_format);
-    _sgp.desc.sample_count = _sg_def(desc->sample_count, _sg.desc.environment.defaults.sample_count);
+void sgp_push_transform(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    if (SOKOL_UNLIKELY(_sgp.cur_transform >= _SGP_MAX_STACK_DEPTH)) {
+        _sgp_set_error(SGP_ERROR_TRANSFORM_STACK_OVERFLOW);
+        return;
+    }
+    _sgp.transform_stack[_sgp.cur_transform++] = _sgp.state.transform;
+}
 
-    // allocate buffers
-    _sgp.num_vertices = _sgp.desc.max_vertices;
-    _sgp.num_commands = _sgp.desc.max_commands;
-    _sgp.num_uniforms = _sgp.desc.max_commands;
-    _sgp.vertices = (sgp_vertex*) _sg_malloc(_sgp.num_vertices * sizeof(sgp_vertex));
-    _sgp.uniforms = (sgp_uniform*) _sg_malloc(_sgp.num_uniforms * sizeof(sgp_uniform));
-    _sgp.commands = (_sgp_command*) _sg_malloc(_sgp.num_commands * sizeof(_sgp_command));
-    if (!_sgp.commands || !_sgp.uniforms || !_sgp.commands) {
-        sgp_shutdown();
-        _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+void sgp_pop_transform(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    if (SOKOL_UNLIKELY(_sgp.cur_transform <= 0)) {
+        _sgp_set_error(SGP_ERROR_TRANSFORM_STACK_UNDERFLOW);
         return;
     }
-    memset(_sgp.vertices, 0, _sgp.num_vertices * sizeof(sgp_vertex));
-    memset(_sgp.uniforms, 0, _sgp.num_uniforms * sizeof(sgp_uniform));
-    memset(_sgp.commands, 0, _sgp.num_commands * sizeof(_sgp_command));
+    _sgp.state.transform = _sgp.transform_stack[--_sgp.cur_transform];
+    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+}
 
-    // create vertex buffer
-    sg_buffer_desc vertex_buf_desc;
-    memset(&vertex_buf_desc, 0, sizeof(sg_buffer_desc));
-    vertex_buf_desc.size = (size_t)(_sgp.num_vertices * sizeof(sgp_vertex));
-    vertex_buf_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
-    vertex_buf_desc.usage = SG_USAGE_STREAM;
+void sgp_reset_transform(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    _sgp.state.transform = _sgp_mat3_identity;
+    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+}
 
-    _sgp.vertex_buf = sg_make_buffer(&vertex_buf_desc);
-    if (sg_query_buffer_state(_sgp.vertex_buf) != SG_RESOURCESTATE_VALID) {
-        sgp_shutdown();
-        _sgp_set_error(SGP_ERROR_MAKE_VERTEX_BUFFER_FAILED);
-        return;
+void sgp_translate(float x, float y) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    // multiply by translate matrix:
+    // 1.0f, 0.0f,    x,
+    // 0.0f, 1.0f,    y,
+    // 0.0f, 0.0f, 1.0f,
+    _sgp.state.transform.v[0][2] += x*_sgp.state.transform.v[0][0] + y*_sgp.state.transform.v[0][1];
+    _sgp.state.transform.v[1][2] += x*_sgp.state.transform.v[1][0] + y*_sgp.state.transform.v[1][1];
+    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+}
+
+void sgp_rotate(float theta) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    float sint = sinf(theta), cost = cosf(theta);
+    // multiply by rotation matrix:
+    // cost, -sint, 0.0f,
+    // sint,  cost, 0.0f,
+    // 0.0f,  0.0f, 1.0f,
+    sgp_mat2x3 transform = {{
+       {cost*_sgp.state.transform.v[0][0]+sint*_sgp.state.transform.v[0][1], -sint*_sgp.state.transform.v[0][0]+cost*_sgp.state.transform.v[0][1], _sgp.state.transform.v[0][2]},
+       {cost*_sgp.state.transform.v[1][0]+sint*_sgp.state.transform.v[1][1], -sint*_sgp.state.transform.v[1][0]+cost*_sgp.state.transform.v[1][1], _sgp.state.transform.v[1][2]}
+    }};
+    _sgp.state.transform = transform;
+    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+}
+
+void sgp_rotate_at(float theta, float x, float y) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    sgp_translate(x, y);
+    sgp_rotate(theta);
+    sgp_translate(-x, -y);
+}
+
+void sgp_scale(float sx, float sy) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    // multiply by scale matrix:
+    //   sx, 0.0f, 0.0f,
+    // 0.0f,   sy, 0.0f,
+    // 0.0f, 0.0f, 1.0f,
+    _sgp.state.transform.v[0][0] *= sx;
+    _sgp.state.transform.v[1][0] *= sx;
+    _sgp.state.transform.v[0][1] *= sy;
+    _sgp.state.transform.v[1][1] *= sy;
+    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+}
+
+void sgp_scale_at(float sx, float sy, float x, float y) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    sgp_translate(x, y);
+    sgp_scale(sx, sy);
+    sgp_translate(-x, -y);
+}
+
+void sgp_set_pipeline(sg_pipeline pipeline) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    _sgp.state.pipeline = pipeline;
+
+    // reset uniforms
+    memset(&_sgp.state.uniform, 0, sizeof(sgp_uniform));
+}
+
+void sgp_reset_pipeline(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    sg_pipeline pip = {SG_INVALID_ID};
+    sgp_set_pipeline(pip);
+}
+
+void sgp_set_uniform(const void* vs_data, uint32_t vs_size, const void *fs_data, uint32_t fs_size) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.state.pipeline.id != SG_INVALID_ID);
+    uint32_t size = vs_size + fs_size;
+    SOKOL_ASSERT(size <= sizeof(float) * SGP_UNIFORM_CONTENT_SLOTS);
+    if (vs_size > 0) {
+        SOKOL_ASSERT(vs_data);
+        memcpy(&_sgp.state.uniform.data.bytes[0], vs_data, vs_size);
+    }
+    if (fs_size > 0) {
+        SOKOL_ASSERT(fs_data);
+        memcpy(&_sgp.state.uniform.data.bytes[vs_size], fs_data, fs_size);
+    }
+    uint32_t old_size = _sgp.state.uniform.vs_size + _sgp.state.uniform.fs_size;
+    if (size < old_size) {
+        // zero old uniform data
+        memset((uint8_t*)(&_sgp.state.uniform) + size, 0, old_size - size);
     }
+    _sgp.state.uniform.vs_size = vs_size;
+    _sgp.state.uniform.fs_size = fs_size;
+}
 
-    // create white texture
-    uint32_t pixels[4];
-    memset(pixels, 0xFF, sizeof(pixels));
-    sg_image_desc white_img_desc;
-    memset(&white_img_desc, 0, sizeof(sg_image_desc));
-    white_img_desc.type = SG_IMAGETYPE_2D;
-    white_img_desc.width = 2;
-    white_img_desc.height = 2;
-    white_img_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
-    white_img_desc.data.subimage[0][0].ptr = pixels;
-    white_img_desc.data.subimage[0][0].size = sizeof(pixels);
-    white_img_desc.label = "sgp-white-texture";
-    _sgp.white_img = sg_make_image(&white_img_desc);
-    if (sg_query_image_state(_sgp.white_img) != SG_RESOURCESTATE_VALID) {
-        sgp_shutdown();
-        _sgp_set_error(SGP_ERROR_MAKE_WHITE_IMAGE_FAILED);
+void sgp_reset_uniform(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.state.pipeline.id != SG_INVALID_ID);
+    sgp_set_uniform(NULL, 0, NULL, 0);
+}
+
+void sgp_set_blend_mode(sgp_blend_mode blend_mode) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    _sgp.state.blend_mode = blend_mode;
+}
+
+void sgp_reset_blend_mode(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    sgp_set_blend_mode(SGP_BLENDMODE_NONE);
+}
+
+void sgp_set_gpu_transform(bool enabled) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    _sgp.state.gpu_transform = enabled;
+}
+
+void sgp_reset_gpu_transform(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    sgp_set_gpu_transform(false);
+}
+
+void sgp_set_batch_optimizer(uint32_t depth, uint32_t max_move_vertices) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    // the depth is bounded by the scratch allocated in setup
+    _sgp.state.batch_optimizer_depth = _sg_min(depth, _sgp.desc.batch_optimizer_depth);
+    _sgp.state.batch_optimizer_max_move_vertices = max_move_vertices;
+}
+
+void sgp_reset_batch_optimizer(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    sgp_set_batch_optimizer(_sgp.desc.batch_optimizer_depth, _sgp.desc.batch_optimizer_max_move_vertices);
+}
+
+void sgp_set_color(float r, float g, float b, float a) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    _sgp.state.color = (sgp_color_ub4){
+        (uint8_t)_sg_clamp(r*255.0f, 0.0f, 255.0f),
+        (uint8_t)_sg_clamp(g*255.0f, 0.0f, 255.0f),
+        (uint8_t)_sg_clamp(b*255.0f, 0.0f, 255.0f),
+        (uint8_t)_sg_clamp(a*255.0f, 0.0f, 255.0f)
+    };
+}
+
+void sgp_reset_color(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    _sgp.state.color = _sgp_white_color;
+}
+
+void sgp_set_image(int channel, sg_image image) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    SOKOL_ASSERT(channel >= 0 && channel < SGP_TEXTURE_SLOTS);
+    if (_sgp.state.textures.images[channel].id == image.id) {
         return;
     }
 
-    // create nearest sampler
-    sg_sampler_desc nearest_smp_desc;
-    memset(&nearest_smp_desc, 0, sizeof(sg_sampler_desc));
-    nearest_smp_desc.label = "sgp-nearest-sampler";
-    _sgp.nearest_smp = sg_make_sampler(&nearest_smp_desc);
-    if (sg_query_sampler_state(_sgp.nearest_smp) != SG_RESOURCESTATE_VALID) {
-        sgp_shutdown();
-        _sgp_set_error(SGP_ERROR_MAKE_NEAREST_SAMPLER_FAILED);
-        return;
+    _sgp.state.textures.images[channel] = image;
+
+    // recalculate textures count
+    int textures_count = (int)_sgp.state.textures.count;
+    for (int i=_sg_max(channel, textures_count-1);i>=0;--i) {
+        if (_sgp.state.textures.images[i].id != SG_INVALID_ID) {
+            textures_count = i + 1;
+            break;
+        }
     }
+    _sgp.state.textures.count = (uint32_t)textures_count;
+}
 
-    // create common shader
-    _sgp.shader = _sgp_make_common_shader();
-    if (sg_query_shader_state(_sgp.shader) != SG_RESOURCESTATE_VALID) {
-        sgp_shutdown();
-        _sgp_set_error(SGP_ERROR_MAKE_COMMON_SHADER_FAILED);
-        return;
-    }
+void sgp_unset_image(int channel) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    sg_image img = {SG_INVALID_ID};
+    sgp_set_image(channel, img);
+}
 
-    // create common pipelines
-    bool pips_ok = true;
-    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLES, SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
-    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLES, SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
-    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_POINTS, SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
-    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_POINTS, SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
-    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_LINES, SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
-    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_LINES, SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
-    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLE_STRIP, SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
-    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLE_STRIP, SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
-    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_LINE_STRIP, SGP_BLENDMODE_NONE).id != SG_INVALID_ID;
-    pips_ok = pips_ok && _sgp_lookup_pipeline(SG_PRIMITIVETYPE_LINE_STRIP, SGP_BLENDMODE_BLEND).id != SG_INVALID_ID;
-    if (!pips_ok) {
-        sgp_shutdown();
-        _sgp_set_error(SGP_ERROR_MAKE_COMMON_PIPELINE_FAILED);
-        return;
+void sgp_reset_image(int channel) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    if (channel == 0) {
+        // channel 0 always use white image
+        sgp_set_image(channel, _sgp.white_img);
+    } else {
+        sg_image img = {SG_INVALID_ID};
+        sgp_set_image(channel, img);
     }
 }
 
-void sgp_shutdown(void) {
-    if (_sgp.init_cookie == 0) {
-        return; // not initialized
-    }
+void sgp_set_sampler(int channel, sg_sampler sampler) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state == 0);
-    if (_sgp.vertices) {
-        _sg_free(_sgp.vertices);
-    }
-    if (_sgp.uniforms) {
-        _sg_free(_sgp.uniforms);
-    }
-    if (_sgp.commands) {
-        _sg_free(_sgp.commands);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    SOKOL_ASSERT(channel >= 0 && channel < SGP_TEXTURE_SLOTS);
+    _sgp.state.textures.samplers[channel] = sampler;
+}
+
+void sgp_reset_sampler(int channel) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    sgp_set_sampler(channel, _sgp.nearest_smp);
+}
+
+static bool _sgp_grow_array(void** items, uint32_t* capacity, uint32_t used, uint32_t required, size_t item_size) {
+    if (!_sgp.desc.grow_buffers) {
+        return false;
     }
-    for (uint32_t i=0;i<_SG_PRIMITIVETYPE_NUM*_SGP_BLENDMODE_NUM;++i) {
-        sg_pipeline pip = _sgp.pipelines[i];
-        if (pip.id != SG_INVALID_ID) {
-            sg_destroy_pipeline(pip);
+    // grow geometrically, so growing costs amortized constant time per item
+    uint32_t new_capacity = *capacity;
+    while (new_capacity < required) {
+        if (new_capacity > UINT32_MAX / 2) {
+            return false;
         }
+        new_capacity *= 2;
     }
-    if (_sgp.shader.id != SG_INVALID_ID) {
-        sg_destroy_shader(_sgp.shader);
+    void* new_items = _sg_malloc(new_capacity * item_size);
+    if (!new_items) {
+        return false;
     }
-    if (_sgp.vertex_buf.id != SG_INVALID_ID) {
-        sg_destroy_buffer(_sgp.vertex_buf);
+    memcpy(new_items, *items, used * item_size);
+    _sg_free(*items);
+    *items = new_items;
+    *capacity = new_capacity;
+    return true;
+}
+
+static bool _sgp_reserve_vertices(uint32_t count) {
+    if (SOKOL_LIKELY(_sgp.cur_vertex + count <= _sgp.num_vertices)) {
+        return true;
     }
-    if (_sgp.white_img.id != SG_INVALID_ID) {
-        sg_destroy_image(_sgp.white_img);
+    return _sgp_grow_array((void**)&_sgp.vertices, &_sgp.num_vertices, _sgp.cur_vertex, _sgp.cur_vertex + count, sizeof(sgp_vertex));
+}
+
+static sgp_vertex* _sgp_next_vertices(uint32_t count) {
+    if (SOKOL_LIKELY(_sgp_reserve_vertices(count))) {
+        sgp_vertex *vertices = &_sgp.vertices[_sgp.cur_vertex];
+        _sgp.cur_vertex += count;
+        return vertices;
+    } else {
+        _sgp.marks.num_vertices = _sg_max(_sgp.marks.num_vertices, _sgp.cur_vertex + count);
+        _sgp_set_error(SGP_ERROR_VERTICES_FULL);
+        return NULL;
     }
-    if (_sgp.nearest_smp.id != SG_INVALID_ID) {
-        sg_destroy_sampler(_sgp.nearest_smp);
+}
+
+static sgp_vertex* _sgp_next_quad_vertices(uint32_t num_quads, uint32_t* vertex_index) {
+    // indexed quads must start at a multiple of 4 vertices from the base vertex,
+    // the padding vertices are never drawn
+    uint32_t padding = (4 - ((_sgp.cur_vertex - _sgp.state._base_vertex) & 3)) & 3;
+    sgp_vertex* vertices = _sgp_next_vertices(padding + num_quads * 4);
+    if (SOKOL_UNLIKELY(!vertices)) {
+        return NULL;
     }
-    memset(&_sgp, 0, sizeof(_sgp_context));
+    *vertex_index = _sgp.cur_vertex - num_quads * 4;
+    return vertices + padding;
 }
 
-bool sgp_is_valid(void) {
-    return _sgp.init_cookie == _SGP_INIT_COOKIE;
+static inline bool _sgp_use_quad_indices(void) {
+    // custom pipelines are not indexed
+    return _sgp.index_buf.id != SG_INVALID_ID && _sgp.state.pipeline.id == SG_INVALID_ID;
 }
 
-sgp_error sgp_get_last_error(void) {
-    return _sgp.last_error;
+static sgp_uniform* _sgp_prev_uniform(void) {
+    if (SOKOL_LIKELY(_sgp.cur_uniform > 0)) {
+        return &_sgp.uniforms[_sgp.cur_uniform-1];
+    } else {
+        return NULL;
+    }
 }
 
-const char* sgp_get_error_message(sgp_error error_code) {
-    switch (error_code) {
-        case SGP_NO_ERROR:
-            return "No error";
-        case SGP_ERROR_SOKOL_INVALID:
-            return "Sokol is not initialized";
-        case SGP_ERROR_VERTICES_FULL:
-            return "SGP vertices buffer is full";
-        case SGP_ERROR_UNIFORMS_FULL:
-            return "SGP uniform buffer is full";
-        case SGP_ERROR_COMMANDS_FULL:
-            return "SGP command buffer is full";
-        case SGP_ERROR_VERTICES_OVERFLOW:
-            return "SGP vertices buffer overflow";
-        case SGP_ERROR_TRANSFORM_STACK_OVERFLOW:
-            return "SGP transform stack overflow";
-        case SGP_ERROR_TRANSFORM_STACK_UNDERFLOW:
-            return "SGP transform stack underflow";
-        case SGP_ERROR_STATE_STACK_OVERFLOW:
-            return "SGP state stack overflow";
-        case SGP_ERROR_STATE_STACK_UNDERFLOW:
-            return "SGP state stack underflow";
-        case SGP_ERROR_ALLOC_FAILED:
-            return "SGP failed to allocate buffers";
-        case SGP_ERROR_MAKE_VERTEX_BUFFER_FAILED:
-            return "SGP failed to create vertex buffer";
-        case SGP_ERROR_MAKE_WHITE_IMAGE_FAILED:
-            return "SGP failed to create white image";
-        case SGP_ERROR_MAKE_NEAREST_SAMPLER_FAILED:
-            return "SGP failed to create nearest sampler";
-        case SGP_ERROR_MAKE_COMMON_SHADER_FAILED:
-            return "SGP failed to create the common shader";
-        case SGP_ERROR_MAKE_COMMON_PIPELINE_FAILED:
-            return "SGP failed to create the common pipeline";
-        default:
-            return "Invalid error code";
+static sgp_uniform* _sgp_next_uniform(void) {
+    if (SOKOL_LIKELY(_sgp.cur_uniform < _sgp.num_uniforms) ||
+        _sgp_grow_array((void**)&_sgp.uniforms, &_sgp.num_uniforms, _sgp.cur_uniform, _sgp.cur_uniform + 1, sizeof(sgp_uniform))) {
+        return &_sgp.uniforms[_sgp.cur_uniform++];
+    } else {
+        _sgp.marks.num_uniforms = _sg_max(_sgp.marks.num_uniforms, _sgp.num_uniforms + 1);
+        _sgp_set_error(SGP_ERROR_UNIFORMS_FULL);
+        return NULL;
     }
 }
 
-sg_pipeline sgp_make_pipeline(const sgp_pipeline_desc* desc) {
-    sg_primitive_type primitive_type = _sg_def(desc->primitive_type, SG_PRIMITIVETYPE_TRIANGLES);
-    sgp_blend_mode blend_mode = _sg_def(desc->blend_mode, SGP_BLENDMODE_NONE);
-    sg_pixel_format color_format = _sg_def(desc->color_format, _sgp.desc.color_format);
-    sg_pixel_format depth_format = _sg_def(desc->depth_format, _sgp.desc.depth_format);
-    int sample_count = _sg_def(desc->sample_count, _sgp.desc.sample_count);
-    return _sgp_make_pipeline(desc->shader, primitive_type, blend_mode, color_format, depth_format, sample_count, desc->has_vs_color);
+static _sgp_command* _sgp_prev_command(uint32_t count) {
+    if (SOKOL_LIKELY((_sgp.cur_command - _sgp.state._base_command) >= count)) {
+        return &_sgp.commands[_sgp.cur_command-count];
+    } else {
+        return NULL;
+    }
 }
 
-static inline sgp_mat2x3 _sgp_default_proj(int width, int height) {
-    // matrix to convert screen coordinate system
-    // to the usual the coordinate system used on the backends
-    sgp_mat2x3 mat = {{
-        {2.0f/(float)width,                0.0f, -1.0f},
-        {      0.0f,        -2.0f/(float)height,  1.0f}
-    }};
-    return mat;
+static _sgp_command* _sgp_next_command(void) {
+    if (SOKOL_LIKELY(_sgp.cur_command < _sgp.num_commands) ||
+        _sgp_grow_array((void**)&_sgp.commands, &_sgp.num_commands, _sgp.cur_command, _sgp.cur_command + 1, sizeof(_sgp_command))) {
+        return &_sgp.commands[_sgp.cur_command++];
+    } else {
+        _sgp.marks.num_commands = _sg_max(_sgp.marks.num_commands, _sgp.num_commands + 1);
+        _sgp_set_error(SGP_ERROR_COMMANDS_FULL);
+        return NULL;
+    }
 }
 
-void sgp_begin(int width, int height) {
+void sgp_viewport(int x, int y, int w, int h) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    if (SOKOL_UNLIKELY(_sgp.cur_state >= _SGP_MAX_STACK_DEPTH)) {
-        _sgp_set_error(SGP_ERROR_STATE_STACK_OVERFLOW);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+
+    // skip in case of the same viewport
+    if (_sgp.state.viewport.x == x && _sgp.state.viewport.y == y &&
+       _sgp.state.viewport.w == w && _sgp.state.viewport.h == h) {
         return;
     }
 
-    // begin reset last error
-    _sgp.last_error = SGP_NO_ERROR;
+    // try to reuse last command otherwise use the next one
+    _sgp_command* cmd = _sgp_prev_command(1);
+    if (!cmd || cmd->cmd != SGP_COMMAND_VIEWPORT) {
+        cmd = _sgp_next_command();
+    }
+    if (SOKOL_UNLIKELY(!cmd)) {
+        return;
+    }
 
-    // save current state
-    _sgp.state_stack[_sgp.cur_state++] = _sgp.state;
+    sgp_irect viewport = {x, y, w, h};
 
-    // reset to default state
-    _sgp.state.frame_size.w = width; _sgp.state.frame_size.h = height;
-    _sgp.state.viewport.x = 0; _sgp.state.viewport.y = 0;
-    _sgp.state.viewport.w = width; _sgp.state.viewport.h = height;
-    _sgp.state.scissor.x = 0; _sgp.state.scissor.y = 0;
-    _sgp.state.scissor.w = -1; _sgp.state.scissor.h = -1;
-    _sgp.state.proj = _sgp_default_proj(width, height);
-    _sgp.state.transform = _sgp_mat3_identity;
-    _sgp.state.mvp = _sgp.state.proj;
-    _sgp.state.thickness = _sg_max(1.0f / width, 1.0f / height);
-    _sgp.state.color = _sgp_white_color;
-    memset(&_sgp.state.uniform, 0, sizeof(sgp_uniform));
-    _sgp.state.uniform.vs_size = 0;
-    _sgp.state.uniform.fs_size = 0;
-    _sgp.state.blend_mode = SGP_BLENDMODE_NONE;
-    _sgp.state._base_vertex = _sgp.cur_vertex;
-    _sgp.state._base_uniform = _sgp.cur_uniform;
-    _sgp.state._base_command = _sgp.cur_command;
+    memset(cmd, 0, sizeof(_sgp_command));
+    cmd->cmd = SGP_COMMAND_VIEWPORT;
+    cmd->args.viewport = viewport;
 
-    _sgp.state.textures.count = 1;
-    _sgp.state.textures.images[0] = _sgp.white_img;
-    _sgp.state.textures.samplers[0] = _sgp.nearest_smp;
-    sg_image img = {SG_INVALID_ID};
-    for (int i=1;i<SGP_TEXTURE_SLOTS;++i) {
-        _sgp.state.textures.images[i] = img;
-        _sgp.state.textures.samplers[i] = _sgp.nearest_smp;
+    // adjust current scissor relative offset
+    if (!(_sgp.state.scissor.w < 0 && _sgp.state.scissor.h < 0)) {
+        _sgp.state.scissor.x += x - _sgp.state.viewport.x;
+        _sgp.state.scissor.y += y - _sgp.state.viewport.y;
+    }
+
+    _sgp.state.viewport = viewport;
+    _sgp.state.thickness = _sg_max(1.0f / w, 1.0f / h);
+    _sgp.state.proj = _sgp_default_proj(w, h);
+    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+}
+
+void sgp_reset_viewport(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    sgp_viewport(0, 0, _sgp.state.frame_size.w, _sgp.state.frame_size.h);
+}
+
+static sgp_irect _sgp_frame_scissor(sgp_irect scissor) {
+    // reset scissor
+    if (scissor.w < 0 && scissor.h < 0) {
+        sgp_irect frame_scissor = {0, 0, _sgp.state.frame_size.w, _sgp.state.frame_size.h};
+        return frame_scissor;
+    }
+
+    // coordinate scissor in viewport subspace
+    sgp_irect viewport_scissor = {_sgp.state.viewport.x + scissor.x, _sgp.state.viewport.y + scissor.y, scissor.w, scissor.h};
+    return viewport_scissor;
+}
+
+void sgp_scissor(int x, int y, int w, int h) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+
+    // skip in case of the same scissor
+    if (_sgp.state.scissor.x == x && _sgp.state.scissor.y == y &&
+       _sgp.state.scissor.w == w && _sgp.state.scissor.h == h) {
+        return;
+    }
+
+    // try to reuse last command otherwise use the next one
+    _sgp_command* cmd = _sgp_prev_command(1);
+    if (!cmd || cmd->cmd != SGP_COMMAND_SCISSOR) {
+        cmd = _sgp_next_command();
+    }
+    if (SOKOL_UNLIKELY(!cmd)) {
+        return;
     }
+
+    sgp_irect scissor = {x, y, w, h};
+    memset(cmd, 0, sizeof(_sgp_command));
+    cmd->cmd = SGP_COMMAND_SCISSOR;
+    cmd->args.scissor = _sgp_frame_scissor(scissor);
+    _sgp.state.scissor = scissor;
+}
+
+void sgp_reset_scissor(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    sgp_scissor(0, 0, -1, -1);
 }
 
-void sgp_flush(void) {
+void sgp_reset_state(void) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
     SOKOL_ASSERT(_sgp.cur_state > 0);
+    sgp_reset_viewport();
+    sgp_reset_scissor();
+    sgp_reset_project();
+    sgp_reset_transform();
+    sgp_reset_blend_mode();
+    sgp_reset_gpu_transform();
+    sgp_reset_color();
+    sgp_reset_uniform();
+    sgp_reset_batch_optimizer();
+    sgp_reset_pipeline();
+}
 
-    uint32_t end_command = _sgp.cur_command;
-    uint32_t end_vertex = _sgp.cur_vertex;
+static inline bool _sgp_region_overlaps(_sgp_region a, _sgp_region b) {
+    return !(a.x2 <= b.x1 || b.x2 <= a.x1  || a.y2 <= b.y1 || b.y2 <= a.y1);
+}
 
-    // rewind indexes
-    _sgp.cur_vertex = _sgp.state._base_vertex;
-    _sgp.cur_uniform = _sgp.state._base_uniform;
-    _sgp.cur_command = _sgp.state._base_command;
+typedef struct _sgp_tile_range {
+    int x1, y1, x2, y2;
+} _sgp_tile_range;
+
+// tiles of the merge grid touched by a region, false when there are too many to visit them quickly
+static inline bool _sgp_merge_grid_tiles(_sgp_region region, _sgp_tile_range* range) {
+    float scale = 0.5f * (float)_SGP_MERGE_GRID_SIZE;
+    int max_tile = _SGP_MERGE_GRID_SIZE - 1;
+    range->x1 = _sg_clamp((int)((_sg_max(region.x1, -1.0f) + 1.0f) * scale), 0, max_tile);
+    range->y1 = _sg_clamp((int)((_sg_max(region.y1, -1.0f) + 1.0f) * scale), 0, max_tile);
+    range->x2 = _sg_clamp((int)((_sg_min(region.x2, 1.0f) + 1.0f) * scale), 0, max_tile);
+    range->y2 = _sg_clamp((int)((_sg_min(region.y2, 1.0f) + 1.0f) * scale), 0, max_tile);
+    return (range->x2 - range->x1 + 1) * (range->y2 - range->y1 + 1) <= _SGP_MERGE_GRID_MAX_TILES;
+}
 
-    // draw nothing on errors
-    if (_sgp.last_error != SGP_NO_ERROR) {
+// the grid only pays off when looking back past many draw commands, otherwise checking them is faster
+static inline bool _sgp_merge_grid_enabled(void) {
+    return _sgp.desc.batch_optimizer_depth > _SGP_MERGE_GRID_MIN_INTER_CMDS && !_sgp.desc.sorted_batching;
+}
+
+// marks the tiles touched by a draw command, stale marks of flushed commands only make the grid more conservative
+static void _sgp_merge_grid_add(_sgp_region region, uint32_t command_index) {
+    if (!_sgp_merge_grid_enabled()) {
         return;
     }
-
-    // nothing to be drawn
-    if (end_command <= _sgp.state._base_command) {
+    _sgp_tile_range range;
+    if (!_sgp_merge_grid_tiles(region, &range)) {
+        _sgp.merge_grid_large = _sg_max(_sgp.merge_grid_large, command_index + 1);
         return;
     }
+    for (int y=range.y1;y<=range.y2;++y) {
+        uint32_t* tiles = &_sgp.merge_grid[y * _SGP_MERGE_GRID_SIZE];
+        for (int x=range.x1;x<=range.x2;++x) {
+            tiles[x] = _sg_max(tiles[x], command_index + 1);
+        }
+    }
+}
 
-    // upload vertices
-    uint32_t base_vertex = _sgp.state._base_vertex;
-    uint32_t num_vertices = (end_vertex - base_vertex) * sizeof(sgp_vertex);
-    sg_range vertex_range = {&_sgp.vertices[base_vertex], num_vertices};
-    int offset = sg_append_buffer(_sgp.vertex_buf, &vertex_range);
-    if (sg_query_buffer_overflow(_sgp.vertex_buf)) {
-        _sgp_set_error(SGP_ERROR_VERTICES_OVERFLOW);
+// marks the tiles of the last queued draw command, before queueing a new one
+static void _sgp_merge_grid_push(uint32_t command_index) {
+    if (!_sgp_merge_grid_enabled()) {
         return;
     }
+    if (_sgp.merge_grid_last > 0) {
+        _sgp_merge_grid_add(_sgp.commands[_sgp.merge_grid_last - 1].args.draw.region, _sgp.merge_grid_last - 1);
+    }
+    _sgp.merge_grid_last = command_index + 1;
+}
 
-    uint32_t cur_pip_id = _SGP_IMPOSSIBLE_ID;
-    uint32_t cur_uniform_index = _SGP_IMPOSSIBLE_ID;
-    uint32_t cur_imgs_id[SGP_TEXTURE_SLOTS];
-    for (int i=0;i<SGP_TEXTURE_SLOTS;++i) {
-        cur_imgs_id[i] = _SGP_IMPOSSIBLE_ID;
+// whether a draw command queued after the given one may overlap the region, false when none does
+static bool _sgp_merge_grid_touched_after(_sgp_region region, uint32_t command_index) {
+    uint32_t last = _sgp.merge_grid_last;
+    if (_sgp.merge_grid_large > command_index + 1 ||
+        (last > command_index + 1 && _sgp_region_overlaps(region, _sgp.commands[last - 1].args.draw.region))) {
+        return true;
+    }
+    _sgp_tile_range range;
+    if (!_sgp_merge_grid_tiles(region, &range)) {
+        return true;
+    }
+    for (int y=range.y1;y<=range.y2;++y) {
+        const uint32_t* tiles = &_sgp.merge_grid[y * _SGP_MERGE_GRID_SIZE];
+        for (int x=range.x1;x<=range.x2;++x) {
+            if (tiles[x] > command_index + 1) {
+                return true;
+            }
+        }
     }
+    return false;
+}
 
-    // define the resource bindings
-    sg_bindings bind;
-    memset(&bind, 0, sizeof(sg_bindings));
-    bind.vertex_buffers[0] = _sgp.vertex_buf;
-    bind.vertex_buffer_offsets[0] = offset;
+static bool _sgp_merge_batch_command(sg_pipeline pip, sgp_textures_uniform textures, const sgp_uniform* uniform, _sgp_region region, uint32_t vertex_index, uint32_t num_vertices) {
+    _sgp_command* prev_cmd = NULL;
+    uint32_t* inter_cmds = _sgp.inter_cmds;
+    uint32_t inter_cmd_count = 0;
+    uint32_t max_move_vertices = _sgp.state.batch_optimizer_max_move_vertices;
 
-    // flush commands
-    for (uint32_t i = _sgp.state._base_command; i < end_command; ++i) {
-        _sgp_command* cmd = &_sgp.commands[i];
-        switch (cmd->cmd) {
-            case SGP_COMMAND_VIEWPORT: {
-                sgp_irect* args = &cmd->args.viewport;
-                sg_apply_viewport(args->x, args->y, args->w, args->h, true);
-                break;
-            }
-            case SGP_COMMAND_SCISSOR: {
-                sgp_irect* args = &cmd->args.scissor;
-                sg_apply_scissor_rect(args->x, args->y, args->w, args->h, true);
-                break;
-            }
-            case SGP_COMMAND_DRAW: {
-                _sgp_draw_args* args = &cmd->args.draw;
-                if (args->num_vertices == 0) {
-                    break;
-                }
-                bool apply_bindings = false;
-                bool apply_uniforms = false;
-                // pipeline
-                if (args->pip.id != cur_pip_id) {
-                    // when pipeline changes we need to re-apply uniforms and bindings
-                    cur_uniform_index = _SGP_IMPOSSIBLE_ID;
-                    apply_bindings = true;
-                    cur_pip_id = args->pip.id;
-                    sg_apply_pipeline(args->pip);
-                }
-                // bindings
-                for (uint32_t j=0;j<SGP_TEXTURE_SLOTS;++j) {
-                    uint32_t img_id = SG_INVALID_ID;
-                    uint32_t smp_id = SG_INVALID_ID;
-                    if (j < args->textures.count) {
-                        img_id = args->textures.images[j].id;
-                        if (img_id != SG_INVALID_ID) {
-                            smp_id = args->textures.samplers[j].id;
-                        }
-                    }
-                    if (cur_imgs_id[j] != img_id) {
-                        // when an image binding change we need to re-apply bindings
-                        cur_imgs_id[j] = img_id;
-                        bind.images[j].id = img_id;
-                        bind.samplers[j].id = smp_id;
-                        apply_bindings = true;
-                    }
+    // find a command that is a good candidate to batch
+    uint32_t lookup_depth = _sgp.state.batch_optimizer_depth;
+    for (uint32_t depth=0;depth<lookup_depth;++depth) {
+        _sgp_command* cmd = _sgp_prev_command(depth+1);
+        // stop on nonexistent command
+        if (!cmd) {
+            break;
+        }
+
+        // command was optimized away, search deeper
+        if (cmd->cmd == SGP_COMMAND_NONE) {
+            lookup_depth++;
+            continue;
+        }
+
+        // stop on scissor/viewport
+        if (cmd->cmd != SGP_COMMAND_DRAW) {
+            break;
+        }
+
+        // can only batch commands with the same bindings and uniforms
+        if (cmd->args.draw.pip.id == pip.id &&
+            memcmp(&textures, &cmd->args.draw.textures, sizeof(sgp_textures_uniform)) == 0 &&
+            (!uniform || memcmp(uniform, &_sgp.uniforms[cmd->args.draw.uniform_index], sizeof(sgp_uniform)) == 0)) {
+            prev_cmd = cmd;
+            break;
+        } else {
+            inter_cmds[inter_cmd_count] = _sgp.cur_command - (depth+1);
+            inter_cmd_count++;
+        }
+    }
+    if (!prev_cmd) {
+        return false;
+    }
+
+    // allow batching only if the region of the current or previous draw
+    // is not touched by intermediate commands, the grid skips checking them one by one when neither is
+    bool overlaps_next = false;
+    bool overlaps_prev = false;
+    uint32_t prev_cmd_index = (uint32_t)(prev_cmd - _sgp.commands);
+    _sgp_region prev_region = prev_cmd->args.draw.region;
+    bool use_grid = inter_cmd_count >= _SGP_MERGE_GRID_MIN_INTER_CMDS;
+    if (inter_cmd_count > 0 && (!use_grid || _sgp_merge_grid_touched_after(region, prev_cmd_index))) {
+        bool check_prev = !use_grid || _sgp_merge_grid_touched_after(prev_region, prev_cmd_index);
+        for (uint32_t i=0;i<inter_cmd_count;++i) {
+            _sgp_region inter_region = _sgp.commands[inter_cmds[i]].args.draw.region;
+            if (_sgp_region_overlaps(region, inter_region)) {
+                overlaps_next = true;
+                if (overlaps_prev) {
+                    return false;
                 }
-                if (apply_bindings) {
-                    sg_apply_bindings(&bind);
-                    apply_uniforms = true;
+                if (!check_prev) {
+                    break;
                 }
-                // uniforms
-                if (cur_uniform_index != args->uniform_index) {
-                    cur_uniform_index = args->uniform_index;
-                    apply_uniforms = true;
+            }
+            if (check_prev && _sgp_region_overlaps(prev_region, inter_region)) {
+                overlaps_prev = true;
+                if (overlaps_next) {
+                    return false;
                 }
-                if (apply_uniforms && cur_uniform_index != _SGP_IMPOSSIBLE_ID) {
-                    sgp_uniform* uniform = &_sgp.uniforms[cur_uniform_index];
-                    if (uniform->vs_size > 0) {
-                        sg_range uniform_range = {&uniform->data.bytes[0], uniform->vs_size};
-                        sg_apply_uniforms(SGP_UNIFORM_SLOT_VERTEX, &uniform_range);
-                    }
-                    if (uniform->fs_size > 0) {
-                        sg_range uniform_range = {&uniform->data.bytes[uniform->vs_size], uniform->fs_size};
-                        sg_apply_uniforms(SGP_UNIFORM_SLOT_FRAGMENT, &uniform_range);
+            }
+        }
+    }
+
+    if (!overlaps_next) { // batch in the previous draw command
+        uint32_t prev_end_vertex = prev_cmd->args.draw.vertex_index + prev_cmd->args.draw.num_vertices;
+        if (inter_cmd_count == 0 && vertex_index != prev_end_vertex) {
+            // skip padding vertices left by indexed quads
+            memmove(&_sgp.vertices[prev_end_vertex], &_sgp.vertices[vertex_index], num_vertices * sizeof(sgp_vertex));
+            _sgp.cur_vertex = prev_end_vertex + num_vertices;
+        } else if (inter_cmd_count > 0) {
+            // not enough vertices space, can't do this batch
+            if (SOKOL_UNLIKELY(!_sgp_reserve_vertices(num_vertices))) {
+                return false;
+            }
+
+            uint32_t prev_num_vertices = _sgp.cur_vertex - prev_end_vertex;
+
+            // avoid moving too much memory, to not downgrade performance
+            if (prev_num_vertices > max_move_vertices) {
+                return false;
+            }
+
+            // indexed quads must stay aligned to 4 vertices when moved
+            if (num_vertices % 4 != 0) {
+                for (uint32_t i=0;i<inter_cmd_count;++i) {
+                    if (_sgp.commands[inter_cmds[i]].args.draw.indexed) {
+                        return false;
                     }
                 }
-                //  draw
-                sg_draw((int)(args->vertex_index - base_vertex), (int)args->num_vertices, 1);
-                break;
             }
-            case SGP_COMMAND_NONE: {
-                // this command was optimized away
-                break;
+
+            // rearrange vertices memory for the batch
+            memmove(&_sgp.vertices[prev_end_vertex + num_vertices], &_sgp.vertices[prev_end_vertex], prev_num_vertices * sizeof(sgp_vertex));
+            memcpy(&_sgp.vertices[prev_end_vertex], &_sgp.vertices[vertex_index + num_vertices], num_vertices * sizeof(sgp_vertex));
+            _sgp.state._stats.num_moved_bytes += (uint32_t)((prev_num_vertices + num_vertices) * sizeof(sgp_vertex));
+
+            // offset vertices of intermediate draw commands
+            for (uint32_t i=0;i<inter_cmd_count;++i) {
+                _sgp.commands[inter_cmds[i]].args.draw.vertex_index += num_vertices;
             }
         }
-    }
-}
 
-void sgp_end(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    if (SOKOL_UNLIKELY(_sgp.cur_state <= 0)) {
-        _sgp_set_error(SGP_ERROR_STATE_STACK_UNDERFLOW);
-        return;
-    }
+        // update draw region and vertices
+        prev_region.x1 = _sg_min(prev_region.x1, region.x1);
+        prev_region.y1 = _sg_min(prev_region.y1, region.y1);
+        prev_region.x2 = _sg_max(prev_region.x2, region.x2);
+        prev_region.y2 = _sg_max(prev_region.y2, region.y2);
+        prev_cmd->args.draw.num_vertices += num_vertices;
+        prev_cmd->args.draw.region = prev_region;
+        if (prev_cmd_index + 1 != _sgp.merge_grid_last) {
+            _sgp_merge_grid_add(prev_region, prev_cmd_index);
+        }
+        _sgp.state._stats.num_merged_prev++;
+    } else { // batch in the next draw command
+        SOKOL_ASSERT(inter_cmd_count > 0);
 
-    // restore old state
-    _sgp.state = _sgp.state_stack[--_sgp.cur_state];
-}
+        uint32_t prev_num_vertices = prev_cmd->args.draw.num_vertices;
 
-static inline sgp_mat2x3 _sgp_mul_proj_transform(sgp_mat2x3* proj, sgp_mat2x3* transform) {
-    // this actually multiply matrix projection and transform matrix in an optimized way
-    float x = proj->v[0][0], y = proj->v[1][1];
-    sgp_mat2x3 m = {{
-        {x*transform->v[0][0], x*transform->v[0][1], x*transform->v[0][2]+proj->v[0][2]},
-        {y*transform->v[1][0], y*transform->v[1][1], y*transform->v[1][2]+proj->v[1][2]}
-    }};
-    return m;
-}
+        // avoid moving too much memory, to not downgrade performance
+        if (num_vertices > max_move_vertices) {
+            return false;
+        }
 
-void sgp_project(float left, float right, float top, float bottom) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    float w = right - left;
-    float h = top - bottom;
-    sgp_mat2x3 proj = {{
-        {2.0f/w,   0.0f,  -(right+left)/w},
-        {0.0f,   2.0f/h,  -(top+bottom)/h}
-    }};
-    _sgp.state.proj = proj;
-    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
-}
+        // not enough vertices space, can't do this batch
+        if (SOKOL_UNLIKELY(!_sgp_reserve_vertices(prev_num_vertices))) {
+            return false;
+        }
+
+        // append new draw command, the commands may move in memory when growing
+        _sgp_command* cmd = _sgp_next_command();
+        if (SOKOL_UNLIKELY(!cmd)) {
+            return false;
+        }
+        prev_cmd = &_sgp.commands[prev_cmd_index];
+
+        // rearrange vertices memory for the batch
+        memmove(&_sgp.vertices[vertex_index + prev_num_vertices], &_sgp.vertices[vertex_index], num_vertices * sizeof(sgp_vertex));
+        memcpy(&_sgp.vertices[vertex_index], &_sgp.vertices[prev_cmd->args.draw.vertex_index], prev_num_vertices * sizeof(sgp_vertex));
+        _sgp.state._stats.num_moved_bytes += (uint32_t)((num_vertices + prev_num_vertices) * sizeof(sgp_vertex));
+
+        // update draw region and vertices
+        prev_region.x1 = _sg_min(prev_region.x1, region.x1);
+        prev_region.y1 = _sg_min(prev_region.y1, region.y1);
+        prev_region.x2 = _sg_max(prev_region.x2, region.x2);
+        prev_region.y2 = _sg_max(prev_region.y2, region.y2);
+        _sgp.cur_vertex += prev_num_vertices;
+        num_vertices += prev_num_vertices;
+
+        // configure the draw command
+        cmd->cmd = SGP_COMMAND_DRAW;
+        cmd->args.draw.pip = pip;
+        cmd->args.draw.textures = textures;
+        cmd->args.draw.region = prev_region;
+        cmd->args.draw.uniform_index = prev_cmd->args.draw.uniform_index;
+        cmd->args.draw.vertex_index = vertex_index;
+        cmd->args.draw.num_vertices = num_vertices;
+        cmd->args.draw.indexed = prev_cmd->args.draw.indexed;
+        _sgp_merge_grid_push(_sgp.cur_command - 1);
 
-void sgp_reset_project(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    _sgp.state.proj = _sgp_default_proj(_sgp.state.viewport.w, _sgp.state.viewport.h);
-    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+        // force skipping the previous draw command
+        prev_cmd->cmd = SGP_COMMAND_NONE;
+        _sgp.state._stats.num_merged_next++;
+    }
+    return true;
 }
 
-void sgp_push_transform(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    if (SOKOL_UNLIKELY(_sgp.cur_transform >= _SGP_MAX_STACK_DEPTH)) {
-        _sgp_set_error(SGP_ERROR_TRANSFORM_STACK_OVERFLOW);
+static void _sgp_queue_draw_uniform(sg_pipeline pip, const sgp_uniform* uniform, _sgp_region region, uint32_t vertex_index, uint32_t num_vertices, sg_primitive_type primitive_type, bool indexed) {
+    // invalid pipeline
+    if (SOKOL_UNLIKELY(pip.id == SG_INVALID_ID)) {
+        _sgp.cur_vertex -= num_vertices; // rollback allocated vertices
         return;
     }
-    _sgp.transform_stack[_sgp.cur_transform++] = _sgp.state.transform;
-}
 
-void sgp_pop_transform(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    if (SOKOL_UNLIKELY(_sgp.cur_transform <= 0)) {
-        _sgp_set_error(SGP_ERROR_TRANSFORM_STACK_UNDERFLOW);
+    // region is out of screen bounds, command lists keep it as they may be drawn elsewhere once baked
+    if (!_sgp.command_list && (region.x1 > 1.0f || region.y1 > 1.0f || region.x2 < -1.0f || region.y2 < -1.0f)) {
+        _sgp.cur_vertex -= num_vertices; // rollback allocated vertices
+        _sgp.state._stats.num_culled_draws++;
         return;
     }
-    _sgp.state.transform = _sgp.transform_stack[--_sgp.cur_transform];
-    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
-}
 
-void sgp_reset_transform(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    _sgp.state.transform = _sgp_mat3_identity;
-    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
-}
+    _sgp.state._stats.num_queued_draws++;
 
-void sgp_translate(float x, float y) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    // multiply by translate matrix:
-    // 1.0f, 0.0f,    x,
-    // 0.0f, 1.0f,    y,
-    // 0.0f, 0.0f, 1.0f,
-    _sgp.state.transform.v[0][2] += x*_sgp.state.transform.v[0][0] + y*_sgp.state.transform.v[0][1];
-    _sgp.state.transform.v[1][2] += x*_sgp.state.transform.v[1][0] + y*_sgp.state.transform.v[1][1];
-    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+    // try to merge on previous command to draw in a batch,
+    // sorted batching merges on flush instead, merged draws cover larger regions that would block more draws
+    if (!_sgp.desc.sorted_batching && primitive_type != SG_PRIMITIVETYPE_TRIANGLE_STRIP && primitive_type != SG_PRIMITIVETYPE_LINE_STRIP) {
+        _SGP_TRACE_BEGIN("_sgp_merge_batch_command", num_vertices);
+        bool merged = _sgp_merge_batch_command(pip, _sgp.state.textures, uniform, region, vertex_index, num_vertices);
+        _SGP_TRACE_END("_sgp_merge_batch_command");
+        if (merged) {
+            return;
+        }
+    }
+
+    // setup uniform, try to reuse previous uniform when possible
+    uint32_t uniform_index = _SGP_IMPOSSIBLE_ID;
+    if (uniform) {
+        sgp_uniform *prev_uniform = _sgp_prev_uniform();
+        bool reuse_uniform = prev_uniform && (memcmp(prev_uniform, uniform, sizeof(sgp_uniform)) == 0);
+        if (!reuse_uniform) {
+            // append new uniform
+            sgp_uniform *next_uniform = _sgp_next_uniform();
+            if (SOKOL_UNLIKELY(!next_uniform)) {
+                _sgp.cur_vertex -= num_vertices; // rollback allocated vertices
+                return;
+            }
+            *next_uniform = *uniform;
+        } else {
+            _sgp.state._stats.num_reused_uniforms++;
+        }
+        uniform_index = _sgp.cur_uniform - 1;
+    }
+
+    // append new draw command
+    _sgp_command* cmd = _sgp_next_command();
+    if (SOKOL_UNLIKELY(!cmd)) {
+        _sgp.cur_vertex -= num_vertices; // rollback allocated vertices
+        return;
+    }
+    cmd->cmd = SGP_COMMAND_DRAW;
+    cmd->args.draw.pip = pip;
+    cmd->args.draw.textures = _sgp.state.textures;
+    cmd->args.draw.region = region;
+    cmd->args.draw.uniform_index = uniform_index;
+    cmd->args.draw.vertex_index = vertex_index;
+    cmd->args.draw.num_vertices = num_vertices;
+    cmd->args.draw.indexed = indexed;
+    _sgp_merge_grid_push(_sgp.cur_command - 1);
 }
 
-void sgp_rotate(float theta) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    float sint = sinf(theta), cost = cosf(theta);
-    // multiply by rotation matrix:
-    // cost, -sint, 0.0f,
-    // sint,  cost, 0.0f,
-    // 0.0f,  0.0f, 1.0f,
-    sgp_mat2x3 transform = {{
-       {cost*_sgp.state.transform.v[0][0]+sint*_sgp.state.transform.v[0][1], -sint*_sgp.state.transform.v[0][0]+cost*_sgp.state.transform.v[0][1], _sgp.state.transform.v[0][2]},
-       {cost*_sgp.state.transform.v[1][0]+sint*_sgp.state.transform.v[1][1], -sint*_sgp.state.transform.v[1][0]+cost*_sgp.state.transform.v[1][1], _sgp.state.transform.v[1][2]}
-    }};
-    _sgp.state.transform = transform;
-    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+static void _sgp_queue_draw(sg_pipeline pip, _sgp_region region, uint32_t vertex_index, uint32_t num_vertices, sg_primitive_type primitive_type, bool indexed) {
+    // override pipeline
+    const sgp_uniform* uniform = NULL;
+    if (_sgp.state.pipeline.id != SG_INVALID_ID) {
+        SOKOL_ASSERT(!indexed);
+        pip = _sgp.state.pipeline;
+        uniform = &_sgp.state.uniform;
+    }
+    _sgp_queue_draw_uniform(pip, uniform, region, vertex_index, num_vertices, primitive_type, indexed);
 }
 
-void sgp_rotate_at(float theta, float x, float y) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    sgp_translate(x, y);
-    sgp_rotate(theta);
-    sgp_translate(-x, -y);
+static inline sgp_vec2 _sgp_mat3_vec2_mul(const sgp_mat2x3* m, const sgp_vec2* v) {
+    sgp_vec2 u = {
+        m->v[0][0]*v->x + m->v[0][1]*v->y + m->v[0][2],
+        m->v[1][0]*v->x + m->v[1][1]*v->y + m->v[1][2]
+    };
+    return u;
 }
 
-void sgp_scale(float sx, float sy) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    // multiply by scale matrix:
-    //   sx, 0.0f, 0.0f,
-    // 0.0f,   sy, 0.0f,
-    // 0.0f, 0.0f, 1.0f,
-    _sgp.state.transform.v[0][0] *= sx;
-    _sgp.state.transform.v[1][0] *= sx;
-    _sgp.state.transform.v[0][1] *= sy;
-    _sgp.state.transform.v[1][1] *= sy;
-    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+// bounds of a region transformed by a matrix, expanded by a thickness
+static _sgp_region _sgp_transform_region(const sgp_mat2x3* m, _sgp_region region, float thickness) {
+    sgp_vec2 corners[4] = {
+        {region.x1, region.y1},
+        {region.x2, region.y1},
+        {region.x2, region.y2},
+        {region.x1, region.y2}
+    };
+    _sgp_region bounds = {FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (uint32_t i=0;i<4;++i) {
+        sgp_vec2 p = _sgp_mat3_vec2_mul(m, &corners[i]);
+        bounds.x1 = _sg_min(bounds.x1, p.x);
+        bounds.y1 = _sg_min(bounds.y1, p.y);
+        bounds.x2 = _sg_max(bounds.x2, p.x);
+        bounds.y2 = _sg_max(bounds.y2, p.y);
+    }
+    bounds.x1 -= thickness; bounds.y1 -= thickness;
+    bounds.x2 += thickness; bounds.y2 += thickness;
+    return bounds;
 }
 
-void sgp_scale_at(float sx, float sy, float x, float y) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    sgp_translate(x, y);
-    sgp_scale(sx, sy);
-    sgp_translate(-x, -y);
+// vertex uniform of the transform program, the two rows of the matrix
+static void _sgp_make_transform_uniform(sgp_uniform* uniform, const sgp_mat2x3* m) {
+    memset(uniform, 0, sizeof(sgp_uniform));
+    uniform->vs_size = 8 * sizeof(float);
+    float* floats = uniform->data.floats;
+    floats[0] = m->v[0][0]; floats[1] = m->v[0][1]; floats[2] = m->v[0][2];
+    floats[4] = m->v[1][0]; floats[5] = m->v[1][1]; floats[6] = m->v[1][2];
 }
 
-void sgp_set_pipeline(sg_pipeline pipeline) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    _sgp.state.pipeline = pipeline;
+static void _sgp_transform_uniform_mat(const sgp_uniform* uniform, sgp_mat2x3* m) {
+    const float* floats = uniform->data.floats;
+    m->v[0][0] = floats[0]; m->v[0][1] = floats[1]; m->v[0][2] = floats[2];
+    m->v[1][0] = floats[4]; m->v[1][1] = floats[5]; m->v[1][2] = floats[6];
+}
 
-    // reset uniforms
-    memset(&_sgp.state.uniform, 0, sizeof(sgp_uniform));
+static inline bool _sgp_use_gpu_transform(sg_primitive_type primitive_type) {
+    // custom pipelines and compact vertices need positions in clip space,
+    // command lists can't create pipelines so they use the ones created already
+    return _sgp.state.gpu_transform && _sgp.state.pipeline.id == SG_INVALID_ID && !_sgp.desc.compact_vertices &&
+           (!_sgp.command_list || _sgp.transform_pipelines[(primitive_type * _SGP_BLENDMODE_NUM) + _sgp.state.blend_mode].id != SG_INVALID_ID);
 }
 
-void sgp_reset_pipeline(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    sg_pipeline pip = {SG_INVALID_ID};
-    sgp_set_pipeline(pip);
+// queues a draw of vertices in local space, transformed by the vertex shader with the current MVP
+static void _sgp_queue_transform_draw(sg_primitive_type primitive_type, _sgp_region region, float thickness, uint32_t vertex_index, uint32_t num_vertices) {
+    const sgp_mat2x3* mvp = &_sgp.state.mvp;
+    sgp_uniform uniform;
+    _sgp_make_transform_uniform(&uniform, mvp);
+    sg_pipeline pip = _sgp_lookup_transform_pipeline(primitive_type, _sgp.state.blend_mode);
+    _sgp_queue_draw_uniform(pip, &uniform, _sgp_transform_region(mvp, region, thickness), vertex_index, num_vertices, primitive_type, false);
 }
 
-void sgp_set_uniform(const void* vs_data, uint32_t vs_size, const void *fs_data, uint32_t fs_size) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.state.pipeline.id != SG_INVALID_ID);
-    uint32_t size = vs_size + fs_size;
-    SOKOL_ASSERT(size <= sizeof(float) * SGP_UNIFORM_CONTENT_SLOTS);
-    if (vs_size > 0) {
-        SOKOL_ASSERT(vs_data);
-        memcpy(&_sgp.state.uniform.data.bytes[0], vs_data, vs_size);
-    }
-    if (fs_size > 0) {
-        SOKOL_ASSERT(fs_data);
-        memcpy(&_sgp.state.uniform.data.bytes[vs_size], fs_data, fs_size);
-    }
-    uint32_t old_size = _sgp.state.uniform.vs_size + _sgp.state.uniform.fs_size;
-    if (size < old_size) {
-        // zero old uniform data
-        memset((uint8_t*)(&_sgp.state.uniform) + size, 0, old_size - size);
+/*
+Vertex kernels, they work on 4 floats at once, usually the 4 corners of a rectangle or 4 consecutive points,
+transforming them through the MVP, tracking their bounds and storing interleaved vertices directly.
+The same code runs on SSE2, NEON and WebAssembly SIMD, or on plain floats when SGP_NO_SIMD is defined.
+*/
+#if defined(_SGP_SIMD_SSE2)
+typedef __m128 _sgp_f4;
+static inline _sgp_f4 _sgp_f4_set(float a, float b, float c, float d) { return _mm_setr_ps(a, b, c, d); }
+static inline _sgp_f4 _sgp_f4_splat(float a) { return _mm_set1_ps(a); }
+static inline _sgp_f4 _sgp_f4_add(_sgp_f4 a, _sgp_f4 b) { return _mm_add_ps(a, b); }
+static inline _sgp_f4 _sgp_f4_mul(_sgp_f4 a, _sgp_f4 b) { return _mm_mul_ps(a, b); }
+static inline _sgp_f4 _sgp_f4_min(_sgp_f4 a, _sgp_f4 b) { return _mm_min_ps(a, b); }
+static inline _sgp_f4 _sgp_f4_max(_sgp_f4 a, _sgp_f4 b) { return _mm_max_ps(a, b); }
+static inline void _sgp_f4_store(float* dst, _sgp_f4 a) { _mm_storeu_ps(dst, a); }
+static inline void _sgp_f4_store_vertices(sgp_vertex* dst, _sgp_f4 x, _sgp_f4 y, _sgp_f4 u, _sgp_f4 v) {
+    // transpose to one position and texcoord pair per vertex, they are contiguous in sgp_vertex
+    _sgp_f4 xy_lo = _mm_unpacklo_ps(x, y), xy_hi = _mm_unpackhi_ps(x, y);
+    _sgp_f4 uv_lo = _mm_unpacklo_ps(u, v), uv_hi = _mm_unpackhi_ps(u, v);
+    _mm_storeu_ps(&dst[0].position.x, _mm_movelh_ps(xy_lo, uv_lo));
+    _mm_storeu_ps(&dst[1].position.x, _mm_movehl_ps(uv_lo, xy_lo));
+    _mm_storeu_ps(&dst[2].position.x, _mm_movelh_ps(xy_hi, uv_hi));
+    _mm_storeu_ps(&dst[3].position.x, _mm_movehl_ps(uv_hi, xy_hi));
+}
+#elif defined(_SGP_SIMD_NEON)
+typedef float32x4_t _sgp_f4;
+static inline _sgp_f4 _sgp_f4_set(float a, float b, float c, float d) { float f[4] = {a, b, c, d}; return vld1q_f32(f); }
+static inline _sgp_f4 _sgp_f4_splat(float a) { return vdupq_n_f32(a); }
+static inline _sgp_f4 _sgp_f4_add(_sgp_f4 a, _sgp_f4 b) { return vaddq_f32(a, b); }
+static inline _sgp_f4 _sgp_f4_mul(_sgp_f4 a, _sgp_f4 b) { return vmulq_f32(a, b); }
+static inline _sgp_f4 _sgp_f4_min(_sgp_f4 a, _sgp_f4 b) { return vminq_f32(a, b); }
+static inline _sgp_f4 _sgp_f4_max(_sgp_f4 a, _sgp_f4 b) { return vmaxq_f32(a, b); }
+static inline void _sgp_f4_store(float* dst, _sgp_f4 a) { vst1q_f32(dst, a); }
+static inline void _sgp_f4_store_vertices(sgp_vertex* dst, _sgp_f4 x, _sgp_f4 y, _sgp_f4 u, _sgp_f4 v) {
+    float32x4x2_t xy = vzipq_f32(x, y);
+    float32x4x2_t uv = vzipq_f32(u, v);
+    vst1q_f32(&dst[0].position.x, vcombine_f32(vget_low_f32(xy.val[0]), vget_low_f32(uv.val[0])));
+    vst1q_f32(&dst[1].position.x, vcombine_f32(vget_high_f32(xy.val[0]), vget_high_f32(uv.val[0])));
+    vst1q_f32(&dst[2].position.x, vcombine_f32(vget_low_f32(xy.val[1]), vget_low_f32(uv.val[1])));
+    vst1q_f32(&dst[3].position.x, vcombine_f32(vget_high_f32(xy.val[1]), vget_high_f32(uv.val[1])));
+}
+#elif defined(_SGP_SIMD_WASM)
+typedef v128_t _sgp_f4;
+static inline _sgp_f4 _sgp_f4_set(float a, float b, float c, float d) { return wasm_f32x4_make(a, b, c, d); }
+static inline _sgp_f4 _sgp_f4_splat(float a) { return wasm_f32x4_splat(a); }
+static inline _sgp_f4 _sgp_f4_add(_sgp_f4 a, _sgp_f4 b) { return wasm_f32x4_add(a, b); }
+static inline _sgp_f4 _sgp_f4_mul(_sgp_f4 a, _sgp_f4 b) { return wasm_f32x4_mul(a, b); }
+static inline _sgp_f4 _sgp_f4_min(_sgp_f4 a, _sgp_f4 b) { return wasm_f32x4_pmin(a, b); }
+static inline _sgp_f4 _sgp_f4_max(_sgp_f4 a, _sgp_f4 b) { return wasm_f32x4_pmax(a, b); }
+static inline void _sgp_f4_store(float* dst, _sgp_f4 a) { wasm_v128_store(dst, a); }
+static inline void _sgp_f4_store_vertices(sgp_vertex* dst, _sgp_f4 x, _sgp_f4 y, _sgp_f4 u, _sgp_f4 v) {
+    _sgp_f4 xy_lo = wasm_i32x4_shuffle(x, y, 0, 4, 1, 5), xy_hi = wasm_i32x4_shuffle(x, y, 2, 6, 3, 7);
+    _sgp_f4 uv_lo = wasm_i32x4_shuffle(u, v, 0, 4, 1, 5), uv_hi = wasm_i32x4_shuffle(u, v, 2, 6, 3, 7);
+    wasm_v128_store(&dst[0].position.x, wasm_i32x4_shuffle(xy_lo, uv_lo, 0, 1, 4, 5));
+    wasm_v128_store(&dst[1].position.x, wasm_i32x4_shuffle(xy_lo, uv_lo, 2, 3, 6, 7));
+    wasm_v128_store(&dst[2].position.x, wasm_i32x4_shuffle(xy_hi, uv_hi, 0, 1, 4, 5));
+    wasm_v128_store(&dst[3].position.x, wasm_i32x4_shuffle(xy_hi, uv_hi, 2, 3, 6, 7));
+}
+#else
+typedef struct _sgp_f4 { float v[4]; } _sgp_f4;
+static inline _sgp_f4 _sgp_f4_set(float a, float b, float c, float d) { _sgp_f4 r = {{a, b, c, d}}; return r; }
+static inline _sgp_f4 _sgp_f4_splat(float a) { _sgp_f4 r = {{a, a, a, a}}; return r; }
+static inline _sgp_f4 _sgp_f4_add(_sgp_f4 a, _sgp_f4 b) { for (int i=0;i<4;++i) { a.v[i] += b.v[i]; } return a; }
+static inline _sgp_f4 _sgp_f4_mul(_sgp_f4 a, _sgp_f4 b) { for (int i=0;i<4;++i) { a.v[i] *= b.v[i]; } return a; }
+static inline _sgp_f4 _sgp_f4_min(_sgp_f4 a, _sgp_f4 b) { for (int i=0;i<4;++i) { a.v[i] = _sg_min(a.v[i], b.v[i]); } return a; }
+static inline _sgp_f4 _sgp_f4_max(_sgp_f4 a, _sgp_f4 b) { for (int i=0;i<4;++i) { a.v[i] = _sg_max(a.v[i], b.v[i]); } return a; }
+static inline void _sgp_f4_store(float* dst, _sgp_f4 a) { memcpy(dst, a.v, sizeof(a.v)); }
+static inline void _sgp_f4_store_vertices(sgp_vertex* dst, _sgp_f4 x, _sgp_f4 y, _sgp_f4 u, _sgp_f4 v) {
+    for (int i=0;i<4;++i) {
+        dst[i].position.x = x.v[i]; dst[i].position.y = y.v[i];
+        dst[i].texcoord.x = u.v[i]; dst[i].texcoord.y = v.v[i];
     }
-    _sgp.state.uniform.vs_size = vs_size;
-    _sgp.state.uniform.fs_size = fs_size;
 }
+#endif
 
-void sgp_reset_uniform(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.state.pipeline.id != SG_INVALID_ID);
-    sgp_set_uniform(NULL, 0, NULL, 0);
+// MVP matrix with every element broadcast
+typedef struct _sgp_f4_mat2x3 {
+    _sgp_f4 m00, m01, m02, m10, m11, m12;
+} _sgp_f4_mat2x3;
+
+// bounds of the transformed points, reduced to a region once all of them are processed
+typedef struct _sgp_f4_bounds {
+    _sgp_f4 x1, y1, x2, y2;
+} _sgp_f4_bounds;
+
+static inline _sgp_f4_mat2x3 _sgp_f4_splat_mat2x3(const sgp_mat2x3* m) {
+    _sgp_f4_mat2x3 r;
+    r.m00 = _sgp_f4_splat(m->v[0][0]); r.m01 = _sgp_f4_splat(m->v[0][1]); r.m02 = _sgp_f4_splat(m->v[0][2]);
+    r.m10 = _sgp_f4_splat(m->v[1][0]); r.m11 = _sgp_f4_splat(m->v[1][1]); r.m12 = _sgp_f4_splat(m->v[1][2]);
+    return r;
 }
 
-void sgp_set_blend_mode(sgp_blend_mode blend_mode) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    _sgp.state.blend_mode = blend_mode;
+static inline void _sgp_f4_transform(const _sgp_f4_mat2x3* m, _sgp_f4* x, _sgp_f4* y) {
+    _sgp_f4 tx = _sgp_f4_add(_sgp_f4_add(_sgp_f4_mul(m->m00, *x), _sgp_f4_mul(m->m01, *y)), m->m02);
+    _sgp_f4 ty = _sgp_f4_add(_sgp_f4_add(_sgp_f4_mul(m->m10, *x), _sgp_f4_mul(m->m11, *y)), m->m12);
+    *x = tx;
+    *y = ty;
 }
 
-void sgp_reset_blend_mode(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    sgp_set_blend_mode(SGP_BLENDMODE_NONE);
+static inline void _sgp_f4_bounds_init(_sgp_f4_bounds* b) {
+    b->x1 = _sgp_f4_splat(FLT_MAX); b->y1 = _sgp_f4_splat(FLT_MAX);
+    b->x2 = _sgp_f4_splat(-FLT_MAX); b->y2 = _sgp_f4_splat(-FLT_MAX);
 }
 
-void sgp_set_color(float r, float g, float b, float a) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    _sgp.state.color = (sgp_color_ub4){
-        (uint8_t)_sg_clamp(r*255.0f, 0.0f, 255.0f),
-        (uint8_t)_sg_clamp(g*255.0f, 0.0f, 255.0f),
-        (uint8_t)_sg_clamp(b*255.0f, 0.0f, 255.0f),
-        (uint8_t)_sg_clamp(a*255.0f, 0.0f, 255.0f)
-    };
+static inline void _sgp_f4_bounds_add(_sgp_f4_bounds* b, _sgp_f4 x, _sgp_f4 y) {
+    b->x1 = _sgp_f4_min(b->x1, x); b->y1 = _sgp_f4_min(b->y1, y);
+    b->x2 = _sgp_f4_max(b->x2, x); b->y2 = _sgp_f4_max(b->y2, y);
 }
 
-void sgp_reset_color(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    _sgp.state.color = _sgp_white_color;
+static _sgp_region _sgp_f4_bounds_region(const _sgp_f4_bounds* b, float thickness) {
+    float x1[4], y1[4], x2[4], y2[4];
+    _sgp_f4_store(x1, b->x1); _sgp_f4_store(y1, b->y1);
+    _sgp_f4_store(x2, b->x2); _sgp_f4_store(y2, b->y2);
+    _sgp_region region = {
+        _sg_min(_sg_min(x1[0], x1[1]), _sg_min(x1[2], x1[3])) - thickness,
+        _sg_min(_sg_min(y1[0], y1[1]), _sg_min(y1[2], y1[3])) - thickness,
+        _sg_max(_sg_max(x2[0], x2[1]), _sg_max(x2[2], x2[3])) + thickness,
+        _sg_max(_sg_max(y2[0], y2[1]), _sg_max(y2[2], y2[3])) + thickness
+    };
+    return region;
 }
 
-void sgp_set_image(int channel, sg_image image) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    SOKOL_ASSERT(channel >= 0 && channel < SGP_TEXTURE_SLOTS);
-    if (_sgp.state.textures.images[channel].id == image.id) {
-        return;
+// transforms points into vertices, with texture coordinates when given, returns their bounds
+static _sgp_region _sgp_transform_points(const sgp_mat2x3* mvp, sgp_vertex* dst, const sgp_vec2* points, size_t stride,
+                                         const sgp_vec2* texcoords, uint32_t count, float thickness) {
+    _sgp_f4_mat2x3 m = _sgp_f4_splat_mat2x3(mvp);
+    _sgp_f4_bounds bounds;
+    _sgp_f4_bounds_init(&bounds);
+    _sgp_f4 zero = _sgp_f4_splat(0.0f);
+    const uint8_t* p = (const uint8_t*)points;
+    const uint8_t* t = (const uint8_t*)texcoords;
+    #define _SGP_POINT(base, i) ((const sgp_vec2*)((base) + (i)*stride))
+    uint32_t i = 0;
+    for (;i+4<=count;i+=4) {
+        const sgp_vec2 *p0 = _SGP_POINT(p, i), *p1 = _SGP_POINT(p, i+1), *p2 = _SGP_POINT(p, i+2), *p3 = _SGP_POINT(p, i+3);
+        _sgp_f4 x = _sgp_f4_set(p0->x, p1->x, p2->x, p3->x);
+        _sgp_f4 y = _sgp_f4_set(p0->y, p1->y, p2->y, p3->y);
+        _sgp_f4_transform(&m, &x, &y);
+        _sgp_f4_bounds_add(&bounds, x, y);
+        if (t) {
+            const sgp_vec2 *t0 = _SGP_POINT(t, i), *t1 = _SGP_POINT(t, i+1), *t2 = _SGP_POINT(t, i+2), *t3 = _SGP_POINT(t, i+3);
+            _sgp_f4 u = _sgp_f4_set(t0->x, t1->x, t2->x, t3->x);
+            _sgp_f4 v = _sgp_f4_set(t0->y, t1->y, t2->y, t3->y);
+            _sgp_f4_store_vertices(&dst[i], x, y, u, v);
+        } else {
+            _sgp_f4_store_vertices(&dst[i], x, y, zero, zero);
+        }
     }
-
-    _sgp.state.textures.images[channel] = image;
-
-    // recalculate textures count
-    int textures_count = (int)_sgp.state.textures.count;
-    for (int i=_sg_max(channel, textures_count-1);i>=0;--i) {
-        if (_sgp.state.textures.images[i].id != SG_INVALID_ID) {
-            textures_count = i + 1;
-            break;
+    if (i < count) {
+        // the last 1 to 3 points go through the same kernel, padded by repeating the last one,
+        // so every point is transformed with the same arithmetic wherever the work was split
+        uint32_t last = count - 1;
+        const sgp_vec2 *p0 = _SGP_POINT(p, i), *p1 = _SGP_POINT(p, _sg_min(i+1, last)), *p2 = _SGP_POINT(p, _sg_min(i+2, last)), *p3 = _SGP_POINT(p, last);
+        _sgp_f4 x = _sgp_f4_set(p0->x, p1->x, p2->x, p3->x);
+        _sgp_f4 y = _sgp_f4_set(p0->y, p1->y, p2->y, p3->y);
+        _sgp_f4_transform(&m, &x, &y);
+        _sgp_f4_bounds_add(&bounds, x, y);
+        sgp_vertex tail[4];
+        if (t) {
+            const sgp_vec2 *t0 = _SGP_POINT(t, i), *t1 = _SGP_POINT(t, _sg_min(i+1, last)), *t2 = _SGP_POINT(t, _sg_min(i+2, last)), *t3 = _SGP_POINT(t, last);
+            _sgp_f4_store_vertices(tail, x, y, _sgp_f4_set(t0->x, t1->x, t2->x, t3->x), _sgp_f4_set(t0->y, t1->y, t2->y, t3->y));
+        } else {
+            _sgp_f4_store_vertices(tail, x, y, zero, zero);
+        }
+        for (uint32_t j=0;i+j<count;++j) {
+            dst[i+j].position = tail[j].position;
+            dst[i+j].texcoord = tail[j].texcoord;
         }
     }
-    _sgp.state.textures.count = (uint32_t)textures_count;
-}
-
-void sgp_unset_image(int channel) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    sg_image img = {SG_INVALID_ID};
-    sgp_set_image(channel, img);
+    #undef _SGP_POINT
+    return _sgp_f4_bounds_region(&bounds, thickness);
 }
 
-void sgp_reset_image(int channel) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    if (channel == 0) {
-        // channel 0 always use white image
-        sgp_set_image(channel, _sgp.white_img);
+// stores the transformed corners of a rectangle, with texture coordinates from its source rectangle when given
+static inline void _sgp_store_rect_vertices(sgp_vertex* v, _sgp_f4 x, _sgp_f4 y, const sgp_rect* src, float iw, float ih) {
+    if (src) {
+        float tl = src->x*iw, tt = src->y*ih;
+        float tr = (src->x + src->w)*iw, tb = (src->y + src->h)*ih;
+        _sgp_f4_store_vertices(v, x, y, _sgp_f4_set(tl, tr, tr, tl), _sgp_f4_set(tb, tb, tt, tt));
     } else {
-        sg_image img = {SG_INVALID_ID};
-        sgp_set_image(channel, img);
+        // corners are in bottom left, bottom right, top right and top left order
+        _sgp_f4_store_vertices(v, x, y, _sgp_f4_set(0.0f, 1.0f, 1.0f, 0.0f), _sgp_f4_set(1.0f, 1.0f, 0.0f, 0.0f));
     }
 }
 
-void sgp_set_sampler(int channel, sg_sampler sampler) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    SOKOL_ASSERT(channel >= 0 && channel < SGP_TEXTURE_SLOTS);
-    _sgp.state.textures.samplers[channel] = sampler;
-}
-
-void sgp_reset_sampler(int channel) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    sgp_set_sampler(channel, _sgp.nearest_smp);
-}
-
-static sgp_vertex* _sgp_next_vertices(uint32_t count) {
-    if (SOKOL_LIKELY(_sgp.cur_vertex + count <= _sgp.num_vertices)) {
-        sgp_vertex *vertices = &_sgp.vertices[_sgp.cur_vertex];
-        _sgp.cur_vertex += count;
-        return vertices;
+// transforms rectangles into quads, with texture coordinates from source rectangles when given, returns their bounds
+static _sgp_region _sgp_transform_rects(const sgp_mat2x3* mvp, sgp_vertex* dst, uint32_t rect_vertices, const sgp_rect* rects, size_t stride,
+                                        const sgp_rect* src_rects, float iw, float ih, uint32_t count) {
+    _sgp_f4_bounds bounds;
+    _sgp_f4_bounds_init(&bounds);
+    const uint8_t* r = (const uint8_t*)rects;
+    const uint8_t* s = (const uint8_t*)src_rects;
+    #define _SGP_RECT(base, i) ((const sgp_rect*)((base) + (i)*stride))
+    if (mvp->v[0][1] == 0.0f && mvp->v[1][0] == 0.0f) {
+        // no rotation or shear, only the top left and bottom right corners need to be transformed
+        float sx = mvp->v[0][0], tx = mvp->v[0][2];
+        float sy = mvp->v[1][1], ty = mvp->v[1][2];
+        for (uint32_t i=0;i<count;++i) {
+            const sgp_rect* rect = _SGP_RECT(r, i);
+            float x1 = rect->x*sx + tx, x2 = (rect->x + rect->w)*sx + tx;
+            float y1 = rect->y*sy + ty, y2 = (rect->y + rect->h)*sy + ty;
+            _sgp_f4 x = _sgp_f4_set(x1, x2, x2, x1);
+            _sgp_f4 y = _sgp_f4_set(y2, y2, y1, y1);
+            _sgp_f4_bounds_add(&bounds, x, y);
+            _sgp_store_rect_vertices(&dst[i*rect_vertices], x, y, s ? _SGP_RECT(s, i) : NULL, iw, ih);
+        }
     } else {
-        _sgp_set_error(SGP_ERROR_VERTICES_FULL);
-        return NULL;
+        _sgp_f4_mat2x3 m = _sgp_f4_splat_mat2x3(mvp);
+        for (uint32_t i=0;i<count;++i) {
+            const sgp_rect* rect = _SGP_RECT(r, i);
+            float x2 = rect->x + rect->w, y2 = rect->y + rect->h;
+            _sgp_f4 x = _sgp_f4_set(rect->x, x2, x2, rect->x);
+            _sgp_f4 y = _sgp_f4_set(y2, y2, rect->y, rect->y);
+            _sgp_f4_transform(&m, &x, &y);
+            _sgp_f4_bounds_add(&bounds, x, y);
+            _sgp_store_rect_vertices(&dst[i*rect_vertices], x, y, s ? _SGP_RECT(s, i) : NULL, iw, ih);
+        }
     }
+    #undef _SGP_RECT
+    return _sgp_f4_bounds_region(&bounds, 0.0f);
 }
 
-static sgp_uniform* _sgp_prev_uniform(void) {
-    if (SOKOL_LIKELY(_sgp.cur_uniform > 0)) {
-        return &_sgp.uniforms[_sgp.cur_uniform-1];
-    } else {
-        return NULL;
+// sets the color of quads, and makes them 2 triangles by repeating 2 corners when they are not indexed
+static void _sgp_fill_quads(sgp_vertex* vertices, uint32_t rect_vertices, sgp_color_ub4 color, uint32_t count) {
+    for (uint32_t i=0;i<count;++i) {
+        sgp_vertex* v = &vertices[i*rect_vertices];
+        v[0].color = color;
+        v[1].color = color;
+        v[2].color = color;
+        v[3].color = color;
+        if (rect_vertices == 6) {
+            v[4] = v[0];
+            v[5] = v[2];
+        }
     }
 }
 
-static sgp_uniform* _sgp_next_uniform(void) {
-    if (SOKOL_LIKELY(_sgp.cur_uniform < _sgp.num_uniforms)) {
-        return &_sgp.uniforms[_sgp.cur_uniform++];
-    } else {
-        _sgp_set_error(SGP_ERROR_UNIFORMS_FULL);
-        return NULL;
+// same as above with a color per quad, read from items of the given stride
+static void _sgp_fill_colored_quads(sgp_vertex* vertices, uint32_t rect_vertices, const sgp_color_ub4* colors, size_t stride, uint32_t count) {
+    const uint8_t* c = (const uint8_t*)colors;
+    for (uint32_t i=0;i<count;++i) {
+        sgp_color_ub4 color = *(const sgp_color_ub4*)(c + i*stride);
+        sgp_vertex* v = &vertices[i*rect_vertices];
+        v[0].color = color;
+        v[1].color = color;
+        v[2].color = color;
+        v[3].color = color;
+        if (rect_vertices == 6) {
+            v[4] = v[0];
+            v[5] = v[2];
+        }
     }
 }
 
-static _sgp_command* _sgp_prev_command(uint32_t count) {
-    if (SOKOL_LIKELY((_sgp.cur_command - _sgp.state._base_command) >= count)) {
-        return &_sgp.commands[_sgp.cur_command-count];
+// vertex generation of a draw split in tasks, each task writes its own vertices and region
+typedef struct _sgp_vertex_job {
+    sgp_mat2x3 mvp;
+    sgp_vertex* dst;
+    const uint8_t* items; // points or rectangles
+    const uint8_t* src_items; // texture coordinates or source rectangles, may be NULL
+    const sgp_vertex* colors; // vertex colors, the color below is used when NULL
+    const uint8_t* item_colors; // rectangle colors, the color below is used when NULL
+    size_t stride;
+    sgp_color_ub4 color;
+    uint32_t rect_vertices; // 0 for points
+    float iw, ih;
+    float thickness;
+    uint32_t count;
+    uint32_t chunk;
+    _sgp_region regions[_SGP_MAX_TASKS];
+} _sgp_vertex_job;
+
+static void _sgp_vertex_task(void* task_data, uint32_t task_index) {
+    _sgp_vertex_job* job = (_sgp_vertex_job*)task_data;
+    uint32_t first = task_index * job->chunk;
+    uint32_t count = _sg_min(job->chunk, job->count - first);
+    const uint8_t* items = job->items + first * job->stride;
+    const uint8_t* src_items = job->src_items ? job->src_items + first * job->stride : NULL;
+    if (job->rect_vertices > 0) {
+        sgp_vertex* dst = &job->dst[first * job->rect_vertices];
+        job->regions[task_index] = _sgp_transform_rects(&job->mvp, dst, job->rect_vertices, (const sgp_rect*)items, job->stride,
+                                                        (const sgp_rect*)src_items, job->iw, job->ih, count);
+        if (job->item_colors) {
+            _sgp_fill_colored_quads(dst, job->rect_vertices, (const sgp_color_ub4*)(job->item_colors + first * job->stride), job->stride, count);
+        } else {
+            _sgp_fill_quads(dst, job->rect_vertices, job->color, count);
+        }
     } else {
-        return NULL;
+        sgp_vertex* dst = &job->dst[first];
+        job->regions[task_index] = _sgp_transform_points(&job->mvp, dst, (const sgp_vec2*)items, job->stride,
+                                                         (const sgp_vec2*)src_items, count, job->thickness);
+        if (job->colors) {
+            for (uint32_t i=0;i<count;++i) {
+                dst[i].color = job->colors[first + i].color;
+            }
+        } else {
+            for (uint32_t i=0;i<count;++i) {
+                dst[i].color = job->color;
+            }
+        }
     }
 }
 
-static _sgp_command* _sgp_next_command(void) {
-    if (SOKOL_LIKELY(_sgp.cur_command < _sgp.num_commands)) {
-        return &_sgp.commands[_sgp.cur_command++];
-    } else {
-        _sgp_set_error(SGP_ERROR_COMMANDS_FULL);
-        return NULL;
+static inline bool _sgp_use_tasks(uint32_t num_vertices) {
+    return _sgp.desc.dispatcher.func && num_vertices >= _sgp.desc.dispatcher.min_vertices;
+}
+
+static _sgp_region _sgp_dispatch_vertex_job(_sgp_vertex_job* job) {
+    // chunks are multiple of 4 items to keep the SIMD kernels busy, the result does not depend on how work is split
+    // as every item goes through the same kernels, the last ones of a draw included
+    uint32_t max_tasks = _sg_max(_sgp.desc.dispatcher.max_tasks, 1U);
+    job->chunk = ((job->count + max_tasks - 1) / max_tasks + 3) & ~3U;
+    uint32_t num_tasks = (job->count + job->chunk - 1) / job->chunk;
+    _SGP_TRACE_BEGIN("_sgp_dispatch_vertex_job", num_tasks);
+    _sgp.desc.dispatcher.func(_sgp_vertex_task, job, num_tasks, _sgp.desc.dispatcher.user_data);
+    _sgp_region region = job->regions[0];
+    for (uint32_t i=1;i<num_tasks;++i) {
+        region.x1 = _sg_min(region.x1, job->regions[i].x1);
+        region.y1 = _sg_min(region.y1, job->regions[i].y1);
+        region.x2 = _sg_max(region.x2, job->regions[i].x2);
+        region.y2 = _sg_max(region.y2, job->regions[i].y2);
     }
+    _SGP_TRACE_END("_sgp_dispatch_vertex_job");
+    return region;
 }
 
-void sgp_viewport(int x, int y, int w, int h) {
+void sgp_clear(void) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
     SOKOL_ASSERT(_sgp.cur_state > 0);
+    _SGP_TRACE_BEGIN("sgp_clear", 1);
 
-    // skip in case of the same viewport
-    if (_sgp.state.viewport.x == x && _sgp.state.viewport.y == y &&
-       _sgp.state.viewport.w == w && _sgp.state.viewport.h == h) {
-        return;
-    }
-
-    // try to reuse last command otherwise use the next one
-    _sgp_command* cmd = _sgp_prev_command(1);
-    if (!cmd || cmd->cmd != SGP_COMMAND_VIEWPORT) {
-        cmd = _sgp_next_command();
-    }
-    if (SOKOL_UNLIKELY(!cmd)) {
+    // setup vertices
+    bool indexed = _sgp_use_quad_indices();
+    uint32_t num_vertices = indexed ? 4 : 6;
+    uint32_t vertex_index = _sgp.cur_vertex;
+    sgp_vertex* vertices = indexed ? _sgp_next_quad_vertices(1, &vertex_index) : _sgp_next_vertices(num_vertices);
+    if (SOKOL_UNLIKELY(!vertices)) {
+        _SGP_TRACE_END("sgp_clear");
         return;
     }
 
-    sgp_irect viewport = {x, y, w, h};
-
-    memset(cmd, 0, sizeof(_sgp_command));
-    cmd->cmd = SGP_COMMAND_VIEWPORT;
-    cmd->args.viewport = viewport;
+    // compute vertices
+    sgp_vertex* v = vertices;
+    const sgp_vec2 quad[4] = {
+        {-1.0f, -1.0f}, // bottom left
+        { 1.0f, -1.0f}, // bottom right
+        { 1.0f,  1.0f}, // top right
+        {-1.0f,  1.0f}, // top left
+    };
+    const sgp_vec2 texcoord = {0.0f, 0.0f};
+    sgp_color_ub4 color = _sgp.state.color;
 
-    // adjust current scissor relative offset
-    if (!(_sgp.state.scissor.w < 0 && _sgp.state.scissor.h < 0)) {
-        _sgp.state.scissor.x += x - _sgp.state.viewport.x;
-        _sgp.state.scissor.y += y - _sgp.state.viewport.y;
+    // make a quad composed of 2 triangles
+    v[0].position = quad[0]; v[0].texcoord = texcoord; v[0].color = color;
+    v[1].position = quad[1]; v[1].texcoord = texcoord; v[1].color = color;
+    v[2].position = quad[2]; v[2].texcoord = texcoord; v[2].color = color;
+    v[3].position = quad[3]; v[3].texcoord = texcoord; v[3].color = color;
+    if (!indexed) {
+        v[4].position = quad[0]; v[4].texcoord = texcoord; v[4].color = color;
+        v[5].position = quad[2]; v[5].texcoord = texcoord; v[5].color = color;
     }
 
-    _sgp.state.viewport = viewport;
-    _sgp.state.thickness = _sg_max(1.0f / w, 1.0f / h);
-    _sgp.state.proj = _sgp_default_proj(w, h);
-    _sgp.state.mvp = _sgp_mul_proj_transform(&_sgp.state.proj, &_sgp.state.transform);
+    _sgp_region region = {-1.0f, -1.0f, 1.0f, 1.0f};
+
+    sg_pipeline pip = indexed ? _sgp_lookup_quad_pipeline(SGP_BLENDMODE_NONE) : _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLES, SGP_BLENDMODE_NONE);
+    _sgp_queue_draw(pip, region, vertex_index, num_vertices, SG_PRIMITIVETYPE_TRIANGLES, indexed);
+    _SGP_TRACE_END("sgp_clear");
 }
 
-void sgp_reset_viewport(void) {
+void sgp_draw(sg_primitive_type primitive_type, const sgp_vertex* vertices, uint32_t count) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
     SOKOL_ASSERT(_sgp.cur_state > 0);
-    sgp_viewport(0, 0, _sgp.state.frame_size.w, _sgp.state.frame_size.h);
+    _SGP_TRACE_BEGIN("sgp_draw", count);
+    if (SOKOL_UNLIKELY(count == 0)) {
+        _SGP_TRACE_END("sgp_draw");
+        return;
+    }
+
+    // setup vertices
+    uint32_t vertex_index = _sgp.cur_vertex;
+    sgp_vertex* v = _sgp_next_vertices(count);
+    if (SOKOL_UNLIKELY(!v)) {
+        _SGP_TRACE_END("sgp_draw");
+        return;
+    }
+
+    // fill vertices, in local space when transformed on the GPU
+    float thickness = (primitive_type == SG_PRIMITIVETYPE_POINTS || primitive_type == SG_PRIMITIVETYPE_LINES || primitive_type == SG_PRIMITIVETYPE_LINE_STRIP) ? _sgp.state.thickness : 0.0f;
+    bool gpu_transform = _sgp_use_gpu_transform(primitive_type);
+    sgp_mat2x3 mvp = gpu_transform ? _sgp_mat3_identity : _sgp.state.mvp; // copy to stack for more efficiency
+    float vertex_thickness = gpu_transform ? 0.0f : thickness;
+    _sgp_region region;
+    if (SOKOL_UNLIKELY(_sgp_use_tasks(count))) {
+        _sgp_vertex_job job;
+        memset(&job, 0, sizeof(_sgp_vertex_job));
+        job.mvp = mvp; job.dst = v; job.count = count; job.thickness = vertex_thickness;
+        job.items = (const uint8_t*)&vertices[0].position; job.src_items = (const uint8_t*)&vertices[0].texcoord;
+        job.colors = vertices; job.stride = sizeof(sgp_vertex);
+        region = _sgp_dispatch_vertex_job(&job);
+    } else {
+        region = _sgp_transform_points(&mvp, v, &vertices[0].position, sizeof(sgp_vertex), &vertices[0].texcoord, count, vertex_thickness);
+        for (uint32_t i=0;i<count;++i) {
+            v[i].color = vertices[i].color;
+        }
+    }
+
+    // queue draw
+    if (gpu_transform) {
+        _sgp_queue_transform_draw(primitive_type, region, thickness, vertex_index, count);
+    } else {
+        sg_pipeline pip = _sgp_lookup_pipeline(primitive_type, _sgp.state.blend_mode);
+        _sgp_queue_draw(pip, region, vertex_index, count, primitive_type, false);
+    }
+    _SGP_TRACE_END("sgp_draw");
 }
 
-void sgp_scissor(int x, int y, int w, int h) {
+static void _sgp_draw_solid_pip(sg_primitive_type primitive_type, const sgp_vec2* vertices, uint32_t num_vertices) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
     SOKOL_ASSERT(_sgp.cur_state > 0);
-
-    // skip in case of the same scissor
-    if (_sgp.state.scissor.x == x && _sgp.state.scissor.y == y &&
-       _sgp.state.scissor.w == w && _sgp.state.scissor.h == h) {
+    if (SOKOL_UNLIKELY(num_vertices == 0)) {
         return;
     }
 
-    // try to reuse last command otherwise use the next one
-    _sgp_command* cmd = _sgp_prev_command(1);
-    if (!cmd || cmd->cmd != SGP_COMMAND_SCISSOR) {
-        cmd = _sgp_next_command();
-    }
-    if (SOKOL_UNLIKELY(!cmd)) {
+    // setup vertices
+    uint32_t vertex_index = _sgp.cur_vertex;
+    sgp_vertex* v = _sgp_next_vertices(num_vertices);
+    if (SOKOL_UNLIKELY(!v)) {
         return;
     }
 
-    // coordinate scissor in viewport subspace
-    sgp_irect viewport_scissor = {_sgp.state.viewport.x + x, _sgp.state.viewport.y + y, w, h};
+    // fill vertices, in local space when transformed on the GPU
+    float thickness = (primitive_type == SG_PRIMITIVETYPE_POINTS || primitive_type == SG_PRIMITIVETYPE_LINES || primitive_type == SG_PRIMITIVETYPE_LINE_STRIP) ? _sgp.state.thickness : 0.0f;
+    sgp_color_ub4 color = _sgp.state.color;
+    bool gpu_transform = _sgp_use_gpu_transform(primitive_type);
+    sgp_mat2x3 mvp = gpu_transform ? _sgp_mat3_identity : _sgp.state.mvp; // copy to stack for more efficiency
+    float vertex_thickness = gpu_transform ? 0.0f : thickness;
+    _sgp_region region;
+    if (SOKOL_UNLIKELY(_sgp_use_tasks(num_vertices))) {
+        _sgp_vertex_job job;
+        memset(&job, 0, sizeof(_sgp_vertex_job));
+        job.mvp = mvp; job.dst = v; job.count = num_vertices; job.thickness = vertex_thickness;
+        job.items = (const uint8_t*)vertices; job.stride = sizeof(sgp_vec2); job.color = color;
+        region = _sgp_dispatch_vertex_job(&job);
+    } else {
+        region = _sgp_transform_points(&mvp, v, vertices, sizeof(sgp_vec2), NULL, num_vertices, vertex_thickness);
+        for (uint32_t i=0;i<num_vertices;++i) {
+            v[i].color = color;
+        }
+    }
 
-    // reset scissor
-    if (w < 0 && h  < 0) {
-        viewport_scissor.x = 0; viewport_scissor.y = 0;
-        viewport_scissor.w = _sgp.state.frame_size.w; viewport_scissor.h = _sgp.state.frame_size.h;
+    // queue draw
+    if (gpu_transform) {
+        _sgp_queue_transform_draw(primitive_type, region, thickness, vertex_index, num_vertices);
+    } else {
+        sg_pipeline pip = _sgp_lookup_pipeline(primitive_type, _sgp.state.blend_mode);
+        _sgp_queue_draw(pip, region, vertex_index, num_vertices, primitive_type, false);
     }
+}
 
-    memset(cmd, 0, sizeof(_sgp_command));
-    cmd->cmd = SGP_COMMAND_SCISSOR;
-    cmd->args.scissor = viewport_scissor;
+void sgp_draw_points(const sgp_point* points, uint32_t count) {
+    _SGP_TRACE_BEGIN("sgp_draw_points", count);
+    _sgp_draw_solid_pip(SG_PRIMITIVETYPE_POINTS, points, count);
+    _SGP_TRACE_END("sgp_draw_points");
+}
 
-    sgp_irect scissor = {x, y, w, h};
-    _sgp.state.scissor = scissor;
+void sgp_draw_point(float x, float y) {
+    _SGP_TRACE_BEGIN("sgp_draw_point", 1);
+    sgp_point point = {x, y};
+    sgp_draw_points(&point, 1);
+    _SGP_TRACE_END("sgp_draw_point");
 }
 
-void sgp_reset_scissor(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    sgp_scissor(0, 0, -1, -1);
+void sgp_draw_lines(const sgp_line* lines, uint32_t count) {
+    _SGP_TRACE_BEGIN("sgp_draw_lines", count);
+    _sgp_draw_solid_pip(SG_PRIMITIVETYPE_LINES, (const sgp_point*)lines, count*2);
+    _SGP_TRACE_END("sgp_draw_lines");
 }
 
-void sgp_reset_state(void) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    sgp_reset_viewport();
-    sgp_reset_scissor();
-    sgp_reset_project();
-    sgp_reset_transform();
-    sgp_reset_blend_mode();
-    sgp_reset_color();
-    sgp_reset_uniform();
-    sgp_reset_pipeline();
+void sgp_draw_line(float ax, float ay, float bx, float by) {
+    _SGP_TRACE_BEGIN("sgp_draw_line", 1);
+    sgp_line line = {{ax,ay},{bx, by}};
+    sgp_draw_lines(&line, 1);
+    _SGP_TRACE_END("sgp_draw_line");
 }
 
-static inline bool _sgp_region_overlaps(_sgp_region a, _sgp_region b) {
-    return !(a.x2 <= b.x1 || b.x2 <= a.x1  || a.y2 <= b.y1 || b.y2 <= a.y1);
+void sgp_draw_lines_strip(const sgp_point* points, uint32_t count) {
+    _SGP_TRACE_BEGIN("sgp_draw_lines_strip", count);
+    _sgp_draw_solid_pip(SG_PRIMITIVETYPE_LINE_STRIP, points, count);
+    _SGP_TRACE_END("sgp_draw_lines_strip");
 }
 
-static bool _sgp_merge_batch_command(sg_pipeline pip, sgp_textures_uniform textures, sgp_uniform* uniform, _sgp_region region, uint32_t vertex_index, uint32_t num_vertices) {
-#if SGP_BATCH_OPTIMIZER_DEPTH > 0
-    _sgp_command* prev_cmd = NULL;
-    _sgp_command* inter_cmds[SGP_BATCH_OPTIMIZER_DEPTH];
-    uint32_t inter_cmd_count = 0;
+void sgp_draw_filled_triangles(const sgp_triangle* triangles, uint32_t count) {
+    _SGP_TRACE_BEGIN("sgp_draw_filled_triangles", count);
+    _sgp_draw_solid_pip(SG_PRIMITIVETYPE_TRIANGLES, (const sgp_point*)triangles, count*3);
+    _SGP_TRACE_END("sgp_draw_filled_triangles");
+}
 
-    // find a command that is a good candidate to batch
-    uint32_t lookup_depth = SGP_BATCH_OPTIMIZER_DEPTH;
-    for (uint32_t depth=0;depth<lookup_depth;++depth) {
-        _sgp_command* cmd = _sgp_prev_command(depth+1);
-        // stop on nonexistent command
-        if (!cmd) {
-            break;
-        }
+void sgp_draw_filled_triangle(float ax, float ay, float bx, float by, float cx, float cy) {
+    _SGP_TRACE_BEGIN("sgp_draw_filled_triangle", 1);
+    sgp_triangle triangle = {{ax,ay},{bx, by},{cx, cy}};
+    sgp_draw_filled_triangles(&triangle, 1);
+    _SGP_TRACE_END("sgp_draw_filled_triangle");
+}
 
-        // command was optimized away, search deeper
-        if (cmd->cmd == SGP_COMMAND_NONE) {
-            lookup_depth++;
-            continue;
-        }
+void sgp_draw_filled_triangles_strip(const sgp_point* points, uint32_t count) {
+    _SGP_TRACE_BEGIN("sgp_draw_filled_triangles_strip", count);
+    _sgp_draw_solid_pip(SG_PRIMITIVETYPE_TRIANGLE_STRIP, points, count);
+    _SGP_TRACE_END("sgp_draw_filled_triangles_strip");
+}
 
-        // stop on scissor/viewport
-        if (cmd->cmd != SGP_COMMAND_DRAW) {
-            break;
-        }
+// draws rectangles of the given stride with the current color, or with the color of each one when given
+static void _sgp_draw_rects(const sgp_rect* rects, size_t stride, const sgp_color_ub4* colors, uint32_t count) {
+    SOKOL_ASSERT(count > 0);
 
-        // can only batch commands with the same bindings and uniforms
-        if (cmd->args.draw.pip.id == pip.id &&
-            memcmp(&textures, &cmd->args.draw.textures, sizeof(sgp_textures_uniform)) == 0 &&
-            (!uniform || memcmp(uniform, &_sgp.uniforms[cmd->args.draw.uniform_index], sizeof(sgp_uniform)) == 0)) {
-            prev_cmd = cmd;
-            break;
-        } else {
-            inter_cmds[inter_cmd_count] = cmd;
-            inter_cmd_count++;
-        }
-    }
-    if (!prev_cmd) {
-        return false;
+    // setup vertices, rectangles are indexed quads when enabled, except when transformed on the GPU
+    bool gpu_transform = _sgp_use_gpu_transform(SG_PRIMITIVETYPE_TRIANGLES);
+    bool indexed = !gpu_transform && _sgp_use_quad_indices();
+    uint32_t rect_vertices = indexed ? 4 : 6;
+    uint32_t num_vertices = count * rect_vertices;
+    uint32_t vertex_index = _sgp.cur_vertex;
+    sgp_vertex* vertices = indexed ? _sgp_next_quad_vertices(count, &vertex_index) : _sgp_next_vertices(num_vertices);
+    if (SOKOL_UNLIKELY(!vertices)) {
+        return;
     }
 
-    // allow batching only if the region of the current or previous draw
-    // is not touched by intermediate commands
-    bool overlaps_next = false;
-    bool overlaps_prev = false;
-    _sgp_region prev_region = prev_cmd->args.draw.region;
-    for (uint32_t i=0;i<inter_cmd_count;++i) {
-        _sgp_region inter_region = inter_cmds[i]->args.draw.region;
-        if (_sgp_region_overlaps(region, inter_region)) {
-            overlaps_next = true;
-            if (overlaps_prev) {
-                return false;
-            }
-        }
-        if (_sgp_region_overlaps(prev_region, inter_region)) {
-            overlaps_prev = true;
-            if (overlaps_next) {
-                return false;
-            }
+    // compute vertices, in local space when transformed on the GPU
+    sgp_mat2x3 mvp = gpu_transform ? _sgp_mat3_identity : _sgp.state.mvp; // copy to stack for more efficiency
+    _sgp_region region;
+    if (SOKOL_UNLIKELY(_sgp_use_tasks(num_vertices))) {
+        _sgp_vertex_job job;
+        memset(&job, 0, sizeof(_sgp_vertex_job));
+        job.mvp = mvp; job.dst = vertices; job.count = count; job.rect_vertices = rect_vertices;
+        job.items = (const uint8_t*)rects; job.item_colors = (const uint8_t*)colors; job.stride = stride; job.color = _sgp.state.color;
+        region = _sgp_dispatch_vertex_job(&job);
+    } else {
+        region = _sgp_transform_rects(&mvp, vertices, rect_vertices, rects, stride, NULL, 0.0f, 0.0f, count);
+        if (colors) {
+            _sgp_fill_colored_quads(vertices, rect_vertices, colors, stride, count);
+        } else {
+            _sgp_fill_quads(vertices, rect_vertices, _sgp.state.color, count);
         }
     }
 
-    if (!overlaps_next) { // batch in the previous draw command
-        if (inter_cmd_count > 0) {
-            // not enough vertices space, can't do this batch
-            if (SOKOL_UNLIKELY(_sgp.cur_vertex + num_vertices > _sgp.num_vertices)) {
-                return false;
-            }
-
-            uint32_t prev_end_vertex = prev_cmd->args.draw.vertex_index + prev_cmd->args.draw.num_vertices;
-            uint32_t prev_num_vertices = _sgp.cur_vertex - prev_end_vertex;
-
-            // avoid moving too much memory, to not downgrade performance
-            if (prev_num_vertices > _SGP_MAX_MOVE_VERTICES) {
-                return false;
-            }
+    // queue draw
+    if (gpu_transform) {
+        _sgp_queue_transform_draw(SG_PRIMITIVETYPE_TRIANGLES, region, 0.0f, vertex_index, num_vertices);
+    } else {
+        sg_pipeline pip = indexed ? _sgp_lookup_quad_pipeline(_sgp.state.blend_mode) : _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLES, _sgp.state.blend_mode);
+        _sgp_queue_draw(pip, region, vertex_index, num_vertices, SG_PRIMITIVETYPE_TRIANGLES, indexed);
+    }
+}
 
-            // rearrange vertices memory for the batch
-            memmove(&_sgp.vertices[prev_end_vertex + num_vertices], &_sgp.vertices[prev_end_vertex], prev_num_vertices * sizeof(sgp_vertex));
-            memcpy(&_sgp.vertices[prev_end_vertex], &_sgp.vertices[vertex_index + num_vertices], num_vertices * sizeof(sgp_vertex));
+void sgp_draw_filled_rects(const sgp_rect* rects, uint32_t count) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    _SGP_TRACE_BEGIN("sgp_draw_filled_rects", count);
+    if (SOKOL_LIKELY(count > 0)) {
+        _sgp_draw_rects(rects, sizeof(sgp_rect), NULL, count);
+    }
+    _SGP_TRACE_END("sgp_draw_filled_rects");
+}
 
-            // offset vertices of intermediate draw commands
-            for (uint32_t i=0;i<inter_cmd_count;++i) {
-                inter_cmds[i]->args.draw.vertex_index += num_vertices;
-            }
-        }
+void sgp_draw_filled_rect(float x, float y, float w, float h) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    _SGP_TRACE_BEGIN("sgp_draw_filled_rect", 1);
+    sgp_rect rect = {x,y,w,h};
+    sgp_draw_filled_rects(&rect, 1);
+    _SGP_TRACE_END("sgp_draw_filled_rect");
+}
 
-        // update draw region and vertices
-        prev_region.x1 = _sg_min(prev_region.x1, region.x1);
-        prev_region.y1 = _sg_min(prev_region.y1, region.y1);
-        prev_region.x2 = _sg_max(prev_region.x2, region.x2);
-        prev_region.y2 = _sg_max(prev_region.y2, region.y2);
-        prev_cmd->args.draw.num_vertices += num_vertices;
-        prev_cmd->args.draw.region = prev_region;
-    } else { // batch in the next draw command
-        SOKOL_ASSERT(inter_cmd_count > 0);
+static sgp_isize _sgp_query_image_size(sg_image img_id) {
+    const _sg_image_t* img = _sg_lookup_image(&_sg.pools, img_id.id);
+    SOKOL_ASSERT(img);
+    sgp_isize size = {img ? img->cmn.width : 0, img ? img->cmn.height : 0};
+    return size;
+}
 
-        // append new draw command
-        _sgp_command* cmd = _sgp_next_command();
-        if (SOKOL_UNLIKELY(!cmd)) {
-            return false;
-        }
+// draws textured rectangles of the given stride with the current color, or with the color of each one when given
+static void _sgp_draw_textured_rects(int channel, const sgp_rect* dst_rects, const sgp_rect* src_rects, size_t stride,
+                                     const sgp_color_ub4* colors, uint32_t count) {
+    SOKOL_ASSERT(channel >= 0 && channel < SGP_TEXTURE_SLOTS);
+    SOKOL_ASSERT(count > 0);
+    sg_image image = _sgp.state.textures.images[channel];
+    if (SOKOL_UNLIKELY(image.id == SG_INVALID_ID)) {
+        return;
+    }
 
-        uint32_t prev_num_vertices = prev_cmd->args.draw.num_vertices;
+    // setup vertices, rectangles are indexed quads when enabled, except when transformed on the GPU
+    bool gpu_transform = _sgp_use_gpu_transform(SG_PRIMITIVETYPE_TRIANGLES);
+    bool indexed = !gpu_transform && _sgp_use_quad_indices();
+    uint32_t rect_vertices = indexed ? 4 : 6;
+    uint32_t num_vertices = count * rect_vertices;
+    uint32_t vertex_index = _sgp.cur_vertex;
+    sgp_vertex* vertices = indexed ? _sgp_next_quad_vertices(count, &vertex_index) : _sgp_next_vertices(num_vertices);
+    if (SOKOL_UNLIKELY(!vertices)) {
+        return;
+    }
 
-        // not enough vertices space, can't do this batch
-        if (SOKOL_UNLIKELY(_sgp.cur_vertex + prev_num_vertices > _sgp.num_vertices)) {
-            return false;
-        }
+    // compute image values used for texture coords transform
+    sgp_isize image_size = _sgp_query_image_size(image);
+    if (SOKOL_UNLIKELY(image_size.w == 0 || image_size.h == 0)) {
+        return;
+    }
+    float iw = 1.0f/(float)image_size.w, ih = 1.0f/(float)image_size.h;
 
-        // avoid moving too much memory, to not downgrade performance
-        if (num_vertices > _SGP_MAX_MOVE_VERTICES) {
-            return false;
+    // compute vertices and texture coords, in local space when transformed on the GPU
+    sgp_mat2x3 mvp = gpu_transform ? _sgp_mat3_identity : _sgp.state.mvp; // copy to stack for more efficiency
+    _sgp_region region;
+    if (SOKOL_UNLIKELY(_sgp_use_tasks(num_vertices))) {
+        _sgp_vertex_job job;
+        memset(&job, 0, sizeof(_sgp_vertex_job));
+        job.mvp = mvp; job.dst = vertices; job.count = count; job.rect_vertices = rect_vertices;
+        job.items = (const uint8_t*)dst_rects; job.src_items = (const uint8_t*)src_rects; job.item_colors = (const uint8_t*)colors; job.stride = stride;
+        job.iw = iw; job.ih = ih; job.color = _sgp.state.color;
+        region = _sgp_dispatch_vertex_job(&job);
+    } else {
+        region = _sgp_transform_rects(&mvp, vertices, rect_vertices, dst_rects, stride, src_rects, iw, ih, count);
+        if (colors) {
+            _sgp_fill_colored_quads(vertices, rect_vertices, colors, stride, count);
+        } else {
+            _sgp_fill_quads(vertices, rect_vertices, _sgp.state.color, count);
         }
+    }
 
-        // rearrange vertices memory for the batch
-        memmove(&_sgp.vertices[vertex_index + prev_num_vertices], &_sgp.vertices[vertex_index], num_vertices * sizeof(sgp_vertex));
-        memcpy(&_sgp.vertices[vertex_index], &_sgp.vertices[prev_cmd->args.draw.vertex_index], prev_num_vertices * sizeof(sgp_vertex));
+    // queue draw
+    if (gpu_transform) {
+        _sgp_queue_transform_draw(SG_PRIMITIVETYPE_TRIANGLES, region, 0.0f, vertex_index, num_vertices);
+    } else {
+        sg_pipeline pip = indexed ? _sgp_lookup_quad_pipeline(_sgp.state.blend_mode) : _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLES, _sgp.state.blend_mode);
+        _sgp_queue_draw(pip, region, vertex_index, num_vertices, SG_PRIMITIVETYPE_TRIANGLES, indexed);
+    }
+}
 
-        // update draw region and vertices
-        prev_region.x1 = _sg_min(prev_region.x1, region.x1);
-        prev_region.y1 = _sg_min(prev_region.y1, region.y1);
-        prev_region.x2 = _sg_max(prev_region.x2, region.x2);
-        prev_region.y2 = _sg_max(prev_region.y2, region.y2);
-        _sgp.cur_vertex += prev_num_vertices;
-        num_vertices += prev_num_vertices;
+void sgp_draw_textured_rects(int channel, const sgp_textured_rect* rects, uint32_t count) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    _SGP_TRACE_BEGIN("sgp_draw_textured_rects", count);
+    if (SOKOL_LIKELY(count > 0)) {
+        _sgp_draw_textured_rects(channel, &rects[0].dst, &rects[0].src, sizeof(sgp_textured_rect), NULL, count);
+    }
+    _SGP_TRACE_END("sgp_draw_textured_rects");
+}
 
-        // configure the draw command
-        cmd->cmd = SGP_COMMAND_DRAW;
-        cmd->args.draw.pip = pip;
-        cmd->args.draw.textures = textures;
-        cmd->args.draw.region = prev_region;
-        cmd->args.draw.uniform_index = prev_cmd->args.draw.uniform_index;
-        cmd->args.draw.vertex_index = vertex_index;
-        cmd->args.draw.num_vertices = num_vertices;
+void sgp_draw_textured_rect(int channel, sgp_rect dest_rect, sgp_rect src_rect) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    _SGP_TRACE_BEGIN("sgp_draw_textured_rect", 1);
+    sgp_textured_rect rect = {dest_rect, src_rect};
+    sgp_draw_textured_rects(channel, &rect, 1);
+    _SGP_TRACE_END("sgp_draw_textured_rect");
+}
 
-        // force skipping the previous draw command
-        prev_cmd->cmd = SGP_COMMAND_NONE;
+void sgp_draw_colored_rects(const sgp_colored_rect* rects, uint32_t count) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    _SGP_TRACE_BEGIN("sgp_draw_colored_rects", count);
+    if (SOKOL_LIKELY(count > 0)) {
+        _sgp_draw_rects(&rects[0].rect, sizeof(sgp_colored_rect), &rects[0].color, count);
     }
-    return true;
-#else
-    _SOKOL_UNUSED(pip);
-    _SOKOL_UNUSED(textures);
-    _SOKOL_UNUSED(uniform);
-    _SOKOL_UNUSED(region);
-    _SOKOL_UNUSED(vertex_index);
-    _SOKOL_UNUSED(num_vertices);
-    return false;
-#endif // SGP_BATCH_OPTIMIZER_DEPTH > 0
+    _SGP_TRACE_END("sgp_draw_colored_rects");
 }
 
-static void _sgp_queue_draw(sg_pipeline pip, _sgp_region region, uint32_t vertex_index, uint32_t num_vertices, sg_primitive_type primitive_type) {
-    // override pipeline
-    sgp_uniform* uniform = NULL;
-    if (_sgp.state.pipeline.id != SG_INVALID_ID) {
-        pip = _sgp.state.pipeline;
-        uniform = &_sgp.state.uniform;
+void sgp_draw_colored_textured_rects(int channel, const sgp_colored_textured_rect* rects, uint32_t count) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    _SGP_TRACE_BEGIN("sgp_draw_colored_textured_rects", count);
+    if (SOKOL_LIKELY(count > 0)) {
+        _sgp_draw_textured_rects(channel, &rects[0].dst, &rects[0].src, sizeof(sgp_colored_textured_rect), &rects[0].color, count);
+    }
+    _SGP_TRACE_END("sgp_draw_colored_textured_rects");
+}
+
+static sgp_sprite* _sgp_next_sprites(uint32_t count) {
+    if (SOKOL_LIKELY(_sgp.cur_sprite + count <= _sgp.num_sprites) ||
+        _sgp_grow_array((void**)&_sgp.sprites, &_sgp.num_sprites, _sgp.cur_sprite, _sgp.cur_sprite + count, sizeof(sgp_sprite))) {
+        sgp_sprite* sprites = &_sgp.sprites[_sgp.cur_sprite];
+        _sgp.cur_sprite += count;
+        return sprites;
+    } else {
+        _sgp.marks.num_sprites = _sg_max(_sgp.marks.num_sprites, _sgp.cur_sprite + count);
+        _sgp_set_error(SGP_ERROR_SPRITES_FULL);
+        return NULL;
     }
+}
 
+static void _sgp_queue_sprites(sg_pipeline pip, const sgp_uniform* uniform, const sgp_sprite* sprites, uint32_t count) {
     // invalid pipeline
     if (SOKOL_UNLIKELY(pip.id == SG_INVALID_ID)) {
-        _sgp.cur_vertex -= num_vertices; // rollback allocated vertices
         return;
     }
 
-    // region is out of screen bounds
-    if (region.x1 > 1.0f || region.y1 > 1.0f || region.x2 < -1.0f || region.y2 < -1.0f) {
-        _sgp.cur_vertex -= num_vertices; // rollback allocated vertices
+    sgp_sprite* dst = _sgp_next_sprites(count);
+    if (SOKOL_UNLIKELY(!dst)) {
         return;
     }
+    memcpy(dst, sprites, count * sizeof(sgp_sprite));
+    uint32_t sprite_index = _sgp.cur_sprite - count;
 
-    // try to merge on previous command to draw in a batch
-    if (primitive_type != SG_PRIMITIVETYPE_TRIANGLE_STRIP && primitive_type != SG_PRIMITIVETYPE_LINE_STRIP &&
-        _sgp_merge_batch_command(pip, _sgp.state.textures, uniform, region, vertex_index, num_vertices)) {
-        return;
-    }
+    _sgp.state._stats.num_queued_draws++;
 
     // setup uniform, try to reuse previous uniform when possible
-    uint32_t uniform_index = _SGP_IMPOSSIBLE_ID;
-    if (uniform) {
-        sgp_uniform *prev_uniform = _sgp_prev_uniform();
-        bool reuse_uniform = prev_uniform && (memcmp(prev_uniform, uniform, sizeof(sgp_uniform)) == 0);
-        if (!reuse_uniform) {
-            // append new uniform
-            sgp_uniform *next_uniform = _sgp_next_uniform();
-            if (SOKOL_UNLIKELY(!next_uniform)) {
-                _sgp.cur_vertex -= num_vertices; // rollback allocated vertices
-                return;
-            }
-            *next_uniform = _sgp.state.uniform;
+    uint32_t uniform_index;
+    sgp_uniform *prev_uniform = _sgp_prev_uniform();
+    if (prev_uniform && memcmp(prev_uniform, uniform, sizeof(sgp_uniform)) == 0) {
+        uniform_index = _sgp.cur_uniform - 1;
+        _sgp.state._stats.num_reused_uniforms++;
+
+        // sprites are not culled nor reordered, they can only extend the previous instanced draw
+        _sgp_command* prev_cmd = _sgp_prev_command(1);
+        if (_sgp.state.batch_optimizer_depth > 0 && prev_cmd && prev_cmd->cmd == SGP_COMMAND_DRAW_INSTANCED &&
+            prev_cmd->args.draw.pip.id == pip.id &&
+            prev_cmd->args.draw.uniform_index == uniform_index &&
+            prev_cmd->args.draw.vertex_index + prev_cmd->args.draw.num_vertices == sprite_index &&
+            memcmp(&prev_cmd->args.draw.textures, &_sgp.state.textures, sizeof(sgp_textures_uniform)) == 0) {
+            prev_cmd->args.draw.num_vertices += count;
+            _sgp.state._stats.num_merged_prev++;
+            return;
+        }
+    } else {
+        sgp_uniform *next_uniform = _sgp_next_uniform();
+        if (SOKOL_UNLIKELY(!next_uniform)) {
+            _sgp.cur_sprite -= count; // rollback allocated sprites
+            return;
         }
+        *next_uniform = *uniform;
         uniform_index = _sgp.cur_uniform - 1;
     }
 
     // append new draw command
     _sgp_command* cmd = _sgp_next_command();
     if (SOKOL_UNLIKELY(!cmd)) {
-        _sgp.cur_vertex -= num_vertices; // rollback allocated vertices
+        _sgp.cur_sprite -= count; // rollback allocated sprites
         return;
     }
-    cmd->cmd = SGP_COMMAND_DRAW;
+    _sgp_region region = {-1.0f, -1.0f, 1.0f, 1.0f};
+    cmd->cmd = SGP_COMMAND_DRAW_INSTANCED;
     cmd->args.draw.pip = pip;
     cmd->args.draw.textures = _sgp.state.textures;
     cmd->args.draw.region = region;
     cmd->args.draw.uniform_index = uniform_index;
-    cmd->args.draw.vertex_index = vertex_index;
-    cmd->args.draw.num_vertices = num_vertices;
+    cmd->args.draw.vertex_index = sprite_index;
+    cmd->args.draw.num_vertices = count;
+    cmd->args.draw.indexed = false;
 }
 
-static inline sgp_vec2 _sgp_mat3_vec2_mul(const sgp_mat2x3* m, const sgp_vec2* v) {
-    sgp_vec2 u = {
-        m->v[0][0]*v->x + m->v[0][1]*v->y + m->v[0][2],
-        m->v[1][0]*v->x + m->v[1][1]*v->y + m->v[1][2]
-    };
-    return u;
+void sgp_draw_sprites_instanced(int channel, const sgp_sprite* sprites, uint32_t count) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    SOKOL_ASSERT(channel >= 0 && channel < SGP_TEXTURE_SLOTS);
+    _SGP_TRACE_BEGIN("sgp_draw_sprites_instanced", count);
+    sg_image image = _sgp.state.textures.images[channel];
+    if (SOKOL_UNLIKELY(count == 0 || image.id == SG_INVALID_ID)) {
+        _SGP_TRACE_END("sgp_draw_sprites_instanced");
+        return;
+    }
+    sgp_isize image_size = _sgp_query_image_size(image);
+    if (SOKOL_UNLIKELY(image_size.w <= 0 || image_size.h <= 0)) {
+        _SGP_TRACE_END("sgp_draw_sprites_instanced");
+        return;
+    }
+
+    // the sprites are transformed on the GPU, only the transform and texture size are uploaded per draw
+    sgp_uniform uniform;
+    memset(&uniform, 0, sizeof(sgp_uniform));
+    uniform.vs_size = 8 * sizeof(float);
+    float* floats = uniform.data.floats;
+    const sgp_mat2x3* mvp = &_sgp.state.mvp;
+    floats[0] = mvp->v[0][0]; floats[1] = mvp->v[0][1]; floats[2] = mvp->v[0][2]; floats[3] = 1.0f / image_size.w;
+    floats[4] = mvp->v[1][0]; floats[5] = mvp->v[1][1]; floats[6] = mvp->v[1][2]; floats[7] = 1.0f / image_size.h;
+    _sgp_queue_sprites(_sgp_lookup_sprite_pipeline(_sgp.state.blend_mode), &uniform, sprites, count);
+    _SGP_TRACE_END("sgp_draw_sprites_instanced");
 }
 
-static void _sgp_transform_vec2(sgp_mat2x3* matrix, sgp_vec2* dst, const sgp_vec2 *src, uint32_t count) {
-    for (uint32_t i=0;i<count;++i) {
-        dst[i] = _sgp_mat3_vec2_mul(matrix, &src[i]);
+sgp_desc sgp_query_desc(void) {
+    return _sgp.desc;
+}
+
+sgp_state* sgp_query_state(void) {
+    return &_sgp.state;
+}
+
+sgp_stats sgp_query_stats(void) {
+    return _sgp.stats;
+}
+
+sgp_high_water_marks sgp_query_high_water_marks(void) {
+    return _sgp.marks;
+}
+
+static uint32_t _sgp_capture_resource_index(sgp_capture_resource* resources, uint32_t* num_resources, sgp_capture_resource_type type, uint32_t id) {
+    if (id == SG_INVALID_ID) {
+        return 0;
+    }
+    // resources are few, a linear search is enough
+    for (uint32_t i=0;i<*num_resources;++i) {
+        if (resources[i].type == type && resources[i].id == id) {
+            return i+1;
+        }
+    }
+    sgp_capture_resource* res = &resources[(*num_resources)++];
+    memset(res, 0, sizeof(sgp_capture_resource));
+    res->type = type;
+    res->id = id;
+    switch (type) {
+        case SGP_CAPTURE_RESOURCE_IMAGE: {
+            res->builtin = id == _sgp.white_img.id;
+            const _sg_image_t* img = _sg_lookup_image(&_sg.pools, id);
+            if (img) {
+                res->width = img->cmn.width;
+                res->height = img->cmn.height;
+                res->pixel_format = img->cmn.pixel_format;
+            }
+            break;
+        }
+        case SGP_CAPTURE_RESOURCE_SAMPLER: {
+            res->builtin = id == _sgp.nearest_smp.id;
+            break;
+        }
+        case SGP_CAPTURE_RESOURCE_PIPELINE: {
+            for (uint32_t i=0;i<_SG_PRIMITIVETYPE_NUM*_SGP_BLENDMODE_NUM;++i) {
+                if (_sgp.pipelines[i].id == id || _sgp.transform_pipelines[i].id == id) {
+                    res->builtin = true;
+                    res->primitive_type = (sg_primitive_type)(i / _SGP_BLENDMODE_NUM);
+                    res->blend_mode = (sgp_blend_mode)(i % _SGP_BLENDMODE_NUM);
+                    res->gpu_transform = _sgp.transform_pipelines[i].id == id;
+                    break;
+                }
+            }
+            for (uint32_t i=0;i<_SGP_BLENDMODE_NUM && !res->builtin;++i) {
+                if (_sgp.quad_pipelines[i].id == id) {
+                    // indexed quads are replayed as triangles when quads are not indexed on replay
+                    res->builtin = true;
+                    res->primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
+                    res->blend_mode = (sgp_blend_mode)i;
+                }
+            }
+            for (uint32_t i=0;i<_SGP_BLENDMODE_NUM && !res->builtin;++i) {
+                if (_sgp.sprite_pipelines[i].id == id) {
+                    // instanced sprites are replayed with the sprite pipeline of the same blend mode
+                    res->builtin = true;
+                    res->primitive_type = SG_PRIMITIVETYPE_TRIANGLE_STRIP;
+                    res->blend_mode = (sgp_blend_mode)i;
+                }
+            }
+            if (!res->builtin) {
+                const _sg_pipeline_t* pip = _sg_lookup_pipeline(&_sg.pools, id);
+                res->primitive_type = pip ? pip->cmn.primitive_type : SG_PRIMITIVETYPE_TRIANGLES;
+            }
+            break;
+        }
     }
+    return *num_resources;
 }
 
-void sgp_clear(void) {
+size_t sgp_capture(void* data, size_t size) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
     SOKOL_ASSERT(_sgp.cur_state > 0);
 
-    // setup vertices
-    uint32_t num_vertices = 6;
-    uint32_t vertex_index = _sgp.cur_vertex;
-    sgp_vertex* vertices = _sgp_next_vertices(num_vertices);
-    if (SOKOL_UNLIKELY(!vertices)) {
-        return;
+    uint32_t base_command = _sgp.state._base_command;
+    uint32_t base_vertex = _sgp.state._base_vertex;
+    uint32_t base_uniform = _sgp.state._base_uniform;
+    uint32_t base_sprite = _sgp.state._base_sprite;
+
+    // every draw command may reference one pipeline, plus one image and sampler per texture slot
+    uint32_t max_resources = _sg_max(_sgp.cur_command - base_command, 1) * (1 + 2*SGP_TEXTURE_SLOTS);
+    sgp_capture_resource* resources = (sgp_capture_resource*) _sg_malloc(max_resources * sizeof(sgp_capture_resource));
+    if (!resources) {
+        _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+        return 0;
     }
 
-    // compute vertices
-    sgp_vertex* v = vertices;
-    const sgp_vec2 quad[4] = {
-        {-1.0f, -1.0f}, // bottom left
-        { 1.0f, -1.0f}, // bottom right
-        { 1.0f,  1.0f}, // top right
-        {-1.0f,  1.0f}, // top left
-    };
-    const sgp_vec2 texcoord = {0.0f, 0.0f};
-    sgp_color_ub4 color = _sgp.state.color;
+    // collect referenced resources
+    _sgp_capture_header header;
+    memset(&header, 0, sizeof(_sgp_capture_header));
+    for (uint32_t i=base_command;i<_sgp.cur_command;++i) {
+        const _sgp_command* cmd = &_sgp.commands[i];
+        if (cmd->cmd == SGP_COMMAND_NONE || cmd->cmd == SGP_COMMAND_DRAW_STATIC) {
+            continue;
+        }
+        header.num_commands++;
+        if (cmd->cmd == SGP_COMMAND_DRAW || cmd->cmd == SGP_COMMAND_DRAW_INSTANCED) {
+            const _sgp_draw_args* args = &cmd->args.draw;
+            _sgp_capture_resource_index(resources, &header.num_resources, SGP_CAPTURE_RESOURCE_PIPELINE, args->pip.id);
+            for (uint32_t j=0;j<SGP_TEXTURE_SLOTS;++j) {
+                _sgp_capture_resource_index(resources, &header.num_resources, SGP_CAPTURE_RESOURCE_IMAGE, args->textures.images[j].id);
+                _sgp_capture_resource_index(resources, &header.num_resources, SGP_CAPTURE_RESOURCE_SAMPLER, args->textures.samplers[j].id);
+            }
+        }
+    }
+    header.magic = _SGP_CAPTURE_MAGIC;
+    header.version = _SGP_CAPTURE_VERSION;
+    header.vertex_size = sizeof(sgp_vertex);
+    header.uniform_size = sizeof(sgp_uniform);
+    header.command_size = sizeof(_sgp_command);
+    header.resource_size = sizeof(sgp_capture_resource);
+    header.sprite_size = sizeof(sgp_sprite);
+    header.texture_slots = SGP_TEXTURE_SLOTS;
+    header.frame_width = _sgp.state.frame_size.w;
+    header.frame_height = _sgp.state.frame_size.h;
+    header.num_vertices = _sgp.cur_vertex - base_vertex;
+    header.num_uniforms = _sgp.cur_uniform - base_uniform;
+    header.num_sprites = _sgp.cur_sprite - base_sprite;
+
+    size_t capture_size = sizeof(_sgp_capture_header) +
+                          header.num_resources * sizeof(sgp_capture_resource) +
+                          header.num_commands * sizeof(_sgp_command) +
+                          header.num_vertices * sizeof(sgp_vertex) +
+                          header.num_uniforms * sizeof(sgp_uniform) +
+                          header.num_sprites * sizeof(sgp_sprite);
+    if (!data || size < capture_size) {
+        _sg_free(resources);
+        return capture_size;
+    }
 
-    // make a quad composed of 2 triangles
-    v[0].position = quad[0]; v[0].texcoord = texcoord; v[0].color = color;
-    v[1].position = quad[1]; v[1].texcoord = texcoord; v[1].color = color;
-    v[2].position = quad[2]; v[2].texcoord = texcoord; v[2].color = color;
-    v[3].position = quad[3]; v[3].texcoord = texcoord; v[3].color = color;
-    v[4].position = quad[0]; v[4].texcoord = texcoord; v[4].color = color;
-    v[5].position = quad[2]; v[5].texcoord = texcoord; v[5].color = color;
+    // write header and resources
+    uint8_t* p = (uint8_t*)data;
+    memcpy(p, &header, sizeof(_sgp_capture_header));
+    p += sizeof(_sgp_capture_header);
+    memcpy(p, resources, header.num_resources * sizeof(sgp_capture_resource));
+    p += header.num_resources * sizeof(sgp_capture_resource);
+
+    // write commands, with resources replaced by their capture index and indexes rebased
+    uint32_t num_resources = header.num_resources;
+    for (uint32_t i=base_command;i<_sgp.cur_command;++i) {
+        const _sgp_command* cmd = &_sgp.commands[i];
+        if (cmd->cmd == SGP_COMMAND_NONE || cmd->cmd == SGP_COMMAND_DRAW_STATIC) {
+            continue;
+        }
+        _sgp_command out;
+        memset(&out, 0, sizeof(_sgp_command));
+        out.cmd = cmd->cmd;
+        switch (cmd->cmd) {
+            case SGP_COMMAND_VIEWPORT:
+                out.args.viewport = cmd->args.viewport;
+                break;
+            case SGP_COMMAND_SCISSOR:
+                out.args.scissor = cmd->args.scissor;
+                break;
+            case SGP_COMMAND_DRAW:
+            case SGP_COMMAND_DRAW_INSTANCED: {
+                const _sgp_draw_args* args = &cmd->args.draw;
+                out.args.draw.pip.id = _sgp_capture_resource_index(resources, &num_resources, SGP_CAPTURE_RESOURCE_PIPELINE, args->pip.id);
+                out.args.draw.textures.count = args->textures.count;
+                for (uint32_t j=0;j<SGP_TEXTURE_SLOTS;++j) {
+                    out.args.draw.textures.images[j].id = _sgp_capture_resource_index(resources, &num_resources, SGP_CAPTURE_RESOURCE_IMAGE, args->textures.images[j].id);
+                    out.args.draw.textures.samplers[j].id = _sgp_capture_resource_index(resources, &num_resources, SGP_CAPTURE_RESOURCE_SAMPLER, args->textures.samplers[j].id);
+                }
+                out.args.draw.region = args->region;
+                out.args.draw.uniform_index = args->uniform_index != _SGP_IMPOSSIBLE_ID ? args->uniform_index - base_uniform : _SGP_IMPOSSIBLE_ID;
+                out.args.draw.vertex_index = args->vertex_index - (cmd->cmd == SGP_COMMAND_DRAW_INSTANCED ? base_sprite : base_vertex);
+                out.args.draw.num_vertices = args->num_vertices;
+                out.args.draw.indexed = args->indexed;
+                break;
+            }
+            default:
+                break;
+        }
+        memcpy(p, &out, sizeof(_sgp_command));
+        p += sizeof(_sgp_command);
+    }
+    SOKOL_ASSERT(num_resources == header.num_resources);
+    _sg_free(resources);
+
+    // write vertices, uniforms and sprites
+    memcpy(p, &_sgp.vertices[base_vertex], header.num_vertices * sizeof(sgp_vertex));
+    p += header.num_vertices * sizeof(sgp_vertex);
+    memcpy(p, &_sgp.uniforms[base_uniform], header.num_uniforms * sizeof(sgp_uniform));
+    p += header.num_uniforms * sizeof(sgp_uniform);
+    memcpy(p, &_sgp.sprites[base_sprite], header.num_sprites * sizeof(sgp_sprite));
+    p += header.num_sprites * sizeof(sgp_sprite);
+    SOKOL_ASSERT((size_t)(p - (uint8_t*)data) == capture_size);
+    return capture_size;
+}
+
+static const _sgp_capture_header* _sgp_validate_capture(const void* data, size_t size) {
+    if (!data || size < sizeof(_sgp_capture_header)) {
+        return NULL;
+    }
+    const _sgp_capture_header* header = (const _sgp_capture_header*)data;
+    if (header->magic != _SGP_CAPTURE_MAGIC ||
+        header->version != _SGP_CAPTURE_VERSION ||
+        header->vertex_size != sizeof(sgp_vertex) ||
+        header->uniform_size != sizeof(sgp_uniform) ||
+        header->command_size != sizeof(_sgp_command) ||
+        header->resource_size != sizeof(sgp_capture_resource) ||
+        header->sprite_size != sizeof(sgp_sprite) ||
+        header->texture_slots != SGP_TEXTURE_SLOTS) {
+        return NULL;
+    }
+    uint64_t capture_size = sizeof(_sgp_capture_header) +
+                            (uint64_t)header->num_resources * sizeof(sgp_capture_resource) +
+                            (uint64_t)header->num_commands * sizeof(_sgp_command) +
+                            (uint64_t)header->num_vertices * sizeof(sgp_vertex) +
+                            (uint64_t)header->num_uniforms * sizeof(sgp_uniform) +
+                            (uint64_t)header->num_sprites * sizeof(sgp_sprite);
+    if (capture_size != size) {
+        return NULL;
+    }
+    return header;
+}
+
+bool sgp_query_capture_info(const void* data, size_t size, sgp_capture_info* info) {
+    const _sgp_capture_header* header = _sgp_validate_capture(data, size);
+    if (!header) {
+        return false;
+    }
+    memset(info, 0, sizeof(sgp_capture_info));
+    info->frame_size.w = header->frame_width;
+    info->frame_size.h = header->frame_height;
+    info->num_resources = header->num_resources;
+    info->num_commands = header->num_commands;
+    info->num_vertices = header->num_vertices;
+    info->num_uniforms = header->num_uniforms;
+    info->num_sprites = header->num_sprites;
+    return true;
+}
+
+static uint32_t _sgp_resolve_capture_resource(const sgp_capture_resource* res, const sgp_replay_desc* desc) {
+    if (res->builtin) {
+        switch (res->type) {
+            case SGP_CAPTURE_RESOURCE_IMAGE:
+                return _sgp.white_img.id;
+            case SGP_CAPTURE_RESOURCE_SAMPLER:
+                return _sgp.nearest_smp.id;
+            case SGP_CAPTURE_RESOURCE_PIPELINE:
+                if (res->gpu_transform && !_sgp.desc.compact_vertices) {
+                    return _sgp_lookup_transform_pipeline(res->primitive_type, res->blend_mode).id;
+                }
+                return _sgp_lookup_pipeline(res->primitive_type, res->blend_mode).id;
+        }
+    }
+    if (desc && desc->resolve) {
+        return desc->resolve(res, desc->user_data);
+    }
+    return SG_INVALID_ID;
+}
+
+bool sgp_replay(const void* data, size_t size, const sgp_replay_desc* desc) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.cur_state > 0);
+    const _sgp_capture_header* header = _sgp_validate_capture(data, size);
+    if (!header) {
+        _sgp_set_error(SGP_ERROR_CAPTURE_INVALID);
+        return false;
+    }
+    const uint8_t* p = (const uint8_t*)data + sizeof(_sgp_capture_header);
+    const sgp_capture_resource* resources = (const sgp_capture_resource*)p;
+    p += header->num_resources * sizeof(sgp_capture_resource);
+    const _sgp_command* commands = (const _sgp_command*)p;
+    p += header->num_commands * sizeof(_sgp_command);
+    const sgp_vertex* vertices = (const sgp_vertex*)p;
+    p += header->num_vertices * sizeof(sgp_vertex);
+    const sgp_uniform* uniforms = (const sgp_uniform*)p;
+    p += header->num_uniforms * sizeof(sgp_uniform);
+    const sgp_sprite* sprites = (const sgp_sprite*)p;
+
+    // resolve resources, index 0 is reserved for invalid resources
+    uint32_t* ids = (uint32_t*) _sg_malloc((header->num_resources + 1) * sizeof(uint32_t));
+    if (!ids) {
+        _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+        return false;
+    }
+    ids[0] = SG_INVALID_ID;
+    for (uint32_t i=0;i<header->num_resources;++i) {
+        ids[i+1] = _sgp_resolve_capture_resource(&resources[i], desc);
+        if (ids[i+1] == SG_INVALID_ID) {
+            _sg_free(ids);
+            _sgp_set_error(SGP_ERROR_CAPTURE_UNRESOLVED);
+            return false;
+        }
+    }
+
+    // queue the commands again, they pass through the batch optimizer,
+    // so the captured queue is reproduced exactly when it is disabled
+    bool ok = true;
+    sgp_state state = _sgp.state;
+    for (uint32_t i=0;i<header->num_commands && ok;++i) {
+        const _sgp_command* cmd = &commands[i];
+        switch (cmd->cmd) {
+            case SGP_COMMAND_VIEWPORT:
+            case SGP_COMMAND_SCISSOR: {
+                _sgp_command* next_cmd = _sgp_next_command();
+                if (SOKOL_UNLIKELY(!next_cmd)) {
+                    ok = false;
+                    break;
+                }
+                *next_cmd = *cmd;
+                break;
+            }
+            case SGP_COMMAND_DRAW: {
+                const _sgp_draw_args* args = &cmd->args.draw;
+                if (args->pip.id > header->num_resources ||
+                    args->vertex_index > header->num_vertices || args->num_vertices > header->num_vertices - args->vertex_index ||
+                    (args->uniform_index != _SGP_IMPOSSIBLE_ID && args->uniform_index >= header->num_uniforms) ||
+                    (args->indexed && (args->pip.id == 0 || !resources[args->pip.id-1].builtin || args->num_vertices % 4 != 0)) ||
+                    (args->pip.id > 0 && resources[args->pip.id-1].gpu_transform && (args->uniform_index == _SGP_IMPOSSIBLE_ID || args->indexed))) {
+                    _sgp_set_error(SGP_ERROR_CAPTURE_INVALID);
+                    ok = false;
+                    break;
+                }
+                _sgp.state.textures.count = args->textures.count;
+                for (uint32_t j=0;j<SGP_TEXTURE_SLOTS;++j) {
+                    uint32_t img_index = _sg_min(args->textures.images[j].id, header->num_resources);
+                    uint32_t smp_index = _sg_min(args->textures.samplers[j].id, header->num_resources);
+                    _sgp.state.textures.images[j].id = ids[img_index];
+                    _sgp.state.textures.samplers[j].id = ids[smp_index];
+                }
+                sg_pipeline pip = {ids[args->pip.id]};
+                sg_primitive_type primitive_type = args->pip.id > 0 ? resources[args->pip.id-1].primitive_type : SG_PRIMITIVETYPE_TRIANGLES;
+                // compact vertices can't be in local space, so draws transformed on the GPU are transformed here
+                bool cpu_transform = args->pip.id > 0 && resources[args->pip.id-1].gpu_transform && _sgp.desc.compact_vertices;
+                if (args->uniform_index != _SGP_IMPOSSIBLE_ID && !cpu_transform) {
+                    // custom or transform pipeline, its uniform is applied through the state
+                    _sgp.state.pipeline = pip;
+                    _sgp.state.uniform = uniforms[args->uniform_index];
+                } else {
+                    _sgp.state.pipeline.id = SG_INVALID_ID;
+                }
+                const sgp_vertex* src = &vertices[args->vertex_index];
+                uint32_t vertex_index = _sgp.cur_vertex;
+                if (!args->indexed) {
+                    sgp_vertex* v = _sgp_next_vertices(args->num_vertices);
+                    if (SOKOL_UNLIKELY(!v)) {
+                        ok = false;
+                        break;
+                    }
+                    memcpy(v, src, args->num_vertices * sizeof(sgp_vertex));
+                    if (cpu_transform) {
+                        sgp_mat2x3 mvp;
+                        _sgp_transform_uniform_mat(&uniforms[args->uniform_index], &mvp);
+                        for (uint32_t j=0;j<args->num_vertices;++j) {
+                            v[j].position = _sgp_mat3_vec2_mul(&mvp, &v[j].position);
+                        }
+                    }
+                    _sgp_queue_draw(pip, args->region, vertex_index, args->num_vertices, primitive_type, false);
+                } else if (_sgp_use_quad_indices()) {
+                    uint32_t num_quads = args->num_vertices / 4;
+                    sgp_vertex* v = _sgp_next_quad_vertices(num_quads, &vertex_index);
+                    if (SOKOL_UNLIKELY(!v)) {
+                        ok = false;
+                        break;
+                    }
+                    memcpy(v, src, args->num_vertices * sizeof(sgp_vertex));
+                    pip = _sgp_lookup_quad_pipeline(resources[args->pip.id-1].blend_mode);
+                    _sgp_queue_draw(pip, args->region, vertex_index, args->num_vertices, primitive_type, true);
+                } else {
+                    // quads are not indexed in this context, expand them to triangles
+                    uint32_t num_quads = args->num_vertices / 4;
+                    sgp_vertex* v = _sgp_next_vertices(num_quads * 6);
+                    if (SOKOL_UNLIKELY(!v)) {
+                        ok = false;
+                        break;
+                    }
+                    for (uint32_t j=0;j<num_quads*6;++j) {
+                        v[j] = src[(j / 6) * 4 + _sgp_quad_indices[j % 6]];
+                    }
+                    _sgp_queue_draw(pip, args->region, vertex_index, num_quads * 6, primitive_type, false);
+                }
+                break;
+            }
+            case SGP_COMMAND_DRAW_INSTANCED: {
+                const _sgp_draw_args* args = &cmd->args.draw;
+                if (args->pip.id == 0 || args->pip.id > header->num_resources || !resources[args->pip.id-1].builtin ||
+                    args->vertex_index > header->num_sprites || args->num_vertices > header->num_sprites - args->vertex_index ||
+                    args->uniform_index >= header->num_uniforms) {
+                    _sgp_set_error(SGP_ERROR_CAPTURE_INVALID);
+                    ok = false;
+                    break;
+                }
+                _sgp.state.textures.count = args->textures.count;
+                for (uint32_t j=0;j<SGP_TEXTURE_SLOTS;++j) {
+                    uint32_t img_index = _sg_min(args->textures.images[j].id, header->num_resources);
+                    uint32_t smp_index = _sg_min(args->textures.samplers[j].id, header->num_resources);
+                    _sgp.state.textures.images[j].id = ids[img_index];
+                    _sgp.state.textures.samplers[j].id = ids[smp_index];
+                }
+                sg_pipeline pip = _sgp_lookup_sprite_pipeline(resources[args->pip.id-1].blend_mode);
+                _sgp_queue_sprites(pip, &uniforms[args->uniform_index], &sprites[args->vertex_index], args->num_vertices);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    _sg_free(ids);
 
-    _sgp_region region = {-1.0f, -1.0f, 1.0f, 1.0f};
+    // restore the draw state, keeping the statistics of the replayed draws
+    state._stats = _sgp.state._stats;
+    _sgp.state = state;
+    return ok;
+}
 
-    sg_pipeline pip = _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLES, SGP_BLENDMODE_NONE);
-    _sgp_queue_draw(pip, region, vertex_index, num_vertices, SG_PRIMITIVETYPE_TRIANGLES);
+static bool _sgp_make_builtin_pipelines(void) {
+    bool pips_ok = true;
+    for (int primitive_type=SG_PRIMITIVETYPE_POINTS;primitive_type<_SG_PRIMITIVETYPE_NUM;++primitive_type) {
+        for (int blend_mode=0;blend_mode<_SGP_BLENDMODE_NUM;++blend_mode) {
+            pips_ok = pips_ok && _sgp_lookup_pipeline((sg_primitive_type)primitive_type, (sgp_blend_mode)blend_mode).id != SG_INVALID_ID;
+        }
+    }
+    for (int blend_mode=0;blend_mode<_SGP_BLENDMODE_NUM;++blend_mode) {
+        if (_sgp.index_buf.id != SG_INVALID_ID) {
+            pips_ok = pips_ok && _sgp_lookup_quad_pipeline((sgp_blend_mode)blend_mode).id != SG_INVALID_ID;
+        }
+        pips_ok = pips_ok && _sgp_lookup_sprite_pipeline((sgp_blend_mode)blend_mode).id != SG_INVALID_ID;
+    }
+    return pips_ok;
 }
 
-void sgp_draw(sg_primitive_type primitive_type, const sgp_vertex* vertices, uint32_t count) {
+sgp_command_list* sgp_make_command_list(const sgp_command_list_desc* desc) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    if (SOKOL_UNLIKELY(count == 0)) {
-        return;
+    SOKOL_ASSERT(!_sgp.command_list);
+    SOKOL_ASSERT(desc);
+
+    // pipelines can't be created while recording in other threads, so all builtin pipelines are created now
+    if (!_sgp_make_builtin_pipelines()) {
+        _sgp_set_error(SGP_ERROR_MAKE_COMMON_PIPELINE_FAILED);
+        return NULL;
     }
 
-    // setup vertices
-    uint32_t vertex_index = _sgp.cur_vertex;
-    sgp_vertex* v = _sgp_next_vertices(count);
-    if (SOKOL_UNLIKELY(!v)) {
-        return;
+    sgp_command_list* list = (sgp_command_list*) _sg_malloc(sizeof(sgp_command_list));
+    if (!list) {
+        _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+        return NULL;
     }
+    memset(list, 0, sizeof(sgp_command_list));
+    _sgp_context* ctx = &list->ctx;
+    ctx->init_cookie = _SGP_INIT_COOKIE;
+    ctx->command_list = true;
+    ctx->owner_ctx = _sgp_ctx;
+
+    // lists always grow, callbacks are not called from other threads, nor tasks dispatched from them,
+    // and their draws are merged while recording, as they may be baked into static batches
+    ctx->desc = _sgp.desc;
+    ctx->desc.sorted_batching = false;
+    ctx->desc.max_vertices = _sg_def(desc->max_vertices, _SGP_DEFAULT_LIST_MAX_VERTICES);
+    ctx->desc.max_commands = _sg_def(desc->max_commands, _SGP_DEFAULT_LIST_MAX_COMMANDS);
+    ctx->desc.max_sprites = _sg_def(desc->max_sprites, _SGP_DEFAULT_LIST_MAX_SPRITES);
+    ctx->desc.grow_buffers = true;
+    memset(&ctx->desc.tracer, 0, sizeof(sgp_tracer));
+    memset(&ctx->desc.capacity_callback, 0, sizeof(sgp_capacity_callback));
+    memset(&ctx->desc.dispatcher, 0, sizeof(sgp_task_dispatcher));
+
+    // resources are shared, the list only references them
+    ctx->shader = _sgp.shader;
+    ctx->index_buf = _sgp.index_buf;
+    ctx->index_type = _sgp.index_type;
+    ctx->white_img = _sgp.white_img;
+    ctx->nearest_smp = _sgp.nearest_smp;
+    ctx->sprite_shader = _sgp.sprite_shader;
+    memcpy(ctx->pipelines, _sgp.pipelines, sizeof(_sgp.pipelines));
+    memcpy(ctx->quad_pipelines, _sgp.quad_pipelines, sizeof(_sgp.quad_pipelines));
+    memcpy(ctx->sprite_pipelines, _sgp.sprite_pipelines, sizeof(_sgp.sprite_pipelines));
+    memcpy(ctx->transform_pipelines, _sgp.transform_pipelines, sizeof(_sgp.transform_pipelines));
 
-    // fill vertices
-    float thickness = (primitive_type == SG_PRIMITIVETYPE_POINTS || primitive_type == SG_PRIMITIVETYPE_LINES || primitive_type == SG_PRIMITIVETYPE_LINE_STRIP) ? _sgp.state.thickness : 0.0f;
-    sgp_mat2x3 mvp = _sgp.state.mvp; // copy to stack for more efficiency
-    _sgp_region region = {FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX};
-    for (uint32_t i=0;i<count;++i) {
-        sgp_vec2 p = _sgp_mat3_vec2_mul(&mvp, &vertices[i].position);
-        region.x1 = _sg_min(region.x1, p.x - thickness);
-        region.y1 = _sg_min(region.y1, p.y - thickness);
-        region.x2 = _sg_max(region.x2, p.x + thickness);
-        region.y2 = _sg_max(region.y2, p.y + thickness);
-        v[i].position = p;
-        v[i].texcoord = vertices[i].texcoord;
-        v[i].color = vertices[i].color;
+    // allocate buffers
+    ctx->num_vertices = ctx->desc.max_vertices;
+    ctx->num_commands = ctx->desc.max_commands;
+    ctx->num_uniforms = ctx->desc.max_commands;
+    ctx->num_sprites = ctx->desc.max_sprites;
+    ctx->vertices = (sgp_vertex*) _sg_malloc(ctx->num_vertices * sizeof(sgp_vertex));
+    ctx->uniforms = (sgp_uniform*) _sg_malloc(ctx->num_uniforms * sizeof(sgp_uniform));
+    ctx->commands = (_sgp_command*) _sg_malloc(ctx->num_commands * sizeof(_sgp_command));
+    ctx->sprites = (sgp_sprite*) _sg_malloc(ctx->num_sprites * sizeof(sgp_sprite));
+    if (ctx->desc.batch_optimizer_depth > 0) {
+        ctx->inter_cmds = (uint32_t*) _sg_malloc(ctx->desc.batch_optimizer_depth * sizeof(uint32_t));
+    }
+    if (!ctx->vertices || !ctx->uniforms || !ctx->commands || !ctx->sprites ||
+        (ctx->desc.batch_optimizer_depth > 0 && !ctx->inter_cmds)) {
+        sgp_destroy_command_list(list);
+        _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+        return NULL;
     }
+    return list;
+}
 
-    // queue draw
-    sg_pipeline pip = _sgp_lookup_pipeline(primitive_type, _sgp.state.blend_mode);
-    _sgp_queue_draw(pip, region, vertex_index, count, primitive_type);
+void sgp_destroy_command_list(sgp_command_list* list) {
+    if (!list) {
+        return;
+    }
+    _sgp_context* ctx = &list->ctx;
+    SOKOL_ASSERT(ctx->init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(ctx->cur_state == 0);
+    if (ctx->vertices) {
+        _sg_free(ctx->vertices);
+    }
+    if (ctx->uniforms) {
+        _sg_free(ctx->uniforms);
+    }
+    if (ctx->commands) {
+        _sg_free(ctx->commands);
+    }
+    if (ctx->sprites) {
+        _sg_free(ctx->sprites);
+    }
+    if (ctx->inter_cmds) {
+        _sg_free(ctx->inter_cmds);
+    }
+    _sg_free(list);
 }
 
-static void _sgp_draw_solid_pip(sg_primitive_type primitive_type, const sgp_vec2* vertices, uint32_t num_vertices) {
+void sgp_begin_command_list(sgp_command_list* list, int width, int height) {
+    SOKOL_ASSERT(list && list->ctx.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(list->ctx.cur_state == 0);
+    SOKOL_ASSERT(!_sgp.command_list);
+
+    // the draw functions of this thread record into the list until it ends
+    list->ctx.prev_ctx = _sgp_ctx;
+    _sgp_ctx = &list->ctx;
+
+    // discard previous commands
+    _sgp.cur_vertex = 0;
+    _sgp.cur_uniform = 0;
+    _sgp.cur_command = 0;
+    _sgp.cur_sprite = 0;
+    memset(_sgp.merge_grid, 0, sizeof(_sgp.merge_grid));
+    _sgp.merge_grid_last = 0;
+    _sgp.merge_grid_large = 0;
+    _sgp.list_projected = false;
+    memset(&_sgp.stats, 0, sizeof(sgp_stats));
+    sgp_begin(width, height);
+}
+
+void sgp_end_command_list(void) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(_sgp.command_list);
+    SOKOL_ASSERT(_sgp.cur_state == 1);
+
+    // keep the recording statistics, they are added to the queue the list is submitted to,
+    // and the frame size, static batches made from the list are in its coordinates
+    _sgp.stats = _sgp.state._stats;
+    _sgp.list_frame_size = _sgp.state.frame_size;
+    sgp_end();
+    _sgp_ctx = _sgp.prev_ctx;
+}
+
+void sgp_submit_command_list(const sgp_command_list* list) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
     SOKOL_ASSERT(_sgp.cur_state > 0);
-    if (SOKOL_UNLIKELY(num_vertices == 0)) {
+    SOKOL_ASSERT(!_sgp.command_list);
+    SOKOL_ASSERT(list && list->ctx.init_cookie == _SGP_INIT_COOKIE);
+    const _sgp_context* src = &list->ctx;
+    SOKOL_ASSERT(src->cur_state == 0);
+    SOKOL_ASSERT(src->owner_ctx == _sgp_ctx); // resources of other contexts are not valid here
+    if (SOKOL_UNLIKELY(src->last_error != SGP_NO_ERROR)) {
+        _sgp_set_error(src->last_error);
+        return;
+    }
+    if (src->cur_command == 0) {
         return;
     }
+    _SGP_TRACE_BEGIN("sgp_submit_command_list", src->cur_command);
 
-    // setup vertices
-    uint32_t vertex_index = _sgp.cur_vertex;
-    sgp_vertex* v = _sgp_next_vertices(num_vertices);
-    if (SOKOL_UNLIKELY(!v)) {
+    // copy vertices, indexed quads must stay aligned to 4 vertices from the base vertex
+    uint32_t padding = (4 - ((_sgp.cur_vertex - _sgp.state._base_vertex) & 3)) & 3;
+    sgp_vertex* vertices = _sgp_next_vertices(padding + src->cur_vertex);
+    if (SOKOL_UNLIKELY(!vertices)) {
+        _SGP_TRACE_END("sgp_submit_command_list");
         return;
     }
+    uint32_t base_vertex = _sgp.cur_vertex - src->cur_vertex;
+    memcpy(vertices + padding, src->vertices, src->cur_vertex * sizeof(sgp_vertex));
+
+    // copy uniforms and sprites
+    uint32_t base_uniform = _sgp.cur_uniform;
+    for (uint32_t i=0;i<src->cur_uniform;++i) {
+        sgp_uniform* uniform = _sgp_next_uniform();
+        if (SOKOL_UNLIKELY(!uniform)) {
+            _SGP_TRACE_END("sgp_submit_command_list");
+            return;
+        }
+        *uniform = src->uniforms[i];
+    }
+    uint32_t base_sprite = _sgp.cur_sprite;
+    if (src->cur_sprite > 0) {
+        sgp_sprite* sprites = _sgp_next_sprites(src->cur_sprite);
+        if (SOKOL_UNLIKELY(!sprites)) {
+            _SGP_TRACE_END("sgp_submit_command_list");
+            return;
+        }
+        memcpy(sprites, src->sprites, src->cur_sprite * sizeof(sgp_sprite));
+    }
 
-    // fill vertices
-    float thickness = (primitive_type == SG_PRIMITIVETYPE_POINTS || primitive_type == SG_PRIMITIVETYPE_LINES || primitive_type == SG_PRIMITIVETYPE_LINE_STRIP) ? _sgp.state.thickness : 0.0f;
-    sgp_color_ub4 color = _sgp.state.color;
-    sgp_mat2x3 mvp = _sgp.state.mvp; // copy to stack for more efficiency
-    _sgp_region region = {FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX};
-    for (uint32_t i=0;i<num_vertices;++i) {
-        sgp_vec2 p = _sgp_mat3_vec2_mul(&mvp, &vertices[i]);
-        region.x1 = _sg_min(region.x1, p.x - thickness);
-        region.y1 = _sg_min(region.y1, p.y - thickness);
-        region.x2 = _sg_max(region.x2, p.x + thickness);
-        region.y2 = _sg_max(region.y2, p.y + thickness);
-        v[i].position = p;
-        v[i].texcoord.x = 0.0f;
-        v[i].texcoord.y = 0.0f;
-        v[i].color = color;
+    // copy commands, offsetting where their vertices, uniforms and sprites are,
+    // draws out of screen were kept while recording and are skipped now
+    bool restore_viewport = false;
+    bool restore_scissor = false;
+    uint32_t num_culled = 0;
+    for (uint32_t i=0;i<src->cur_command;++i) {
+        const _sgp_command* src_cmd = &src->commands[i];
+        if (src_cmd->cmd == SGP_COMMAND_NONE) {
+            continue;
+        }
+        if (src_cmd->cmd == SGP_COMMAND_DRAW) {
+            _sgp_region region = src_cmd->args.draw.region;
+            if (region.x1 > 1.0f || region.y1 > 1.0f || region.x2 < -1.0f || region.y2 < -1.0f) {
+                num_culled++;
+                continue;
+            }
+        }
+        _sgp_command* cmd = _sgp_next_command();
+        if (SOKOL_UNLIKELY(!cmd)) {
+            _SGP_TRACE_END("sgp_submit_command_list");
+            return;
+        }
+        *cmd = *src_cmd;
+        switch (cmd->cmd) {
+            case SGP_COMMAND_DRAW:
+                cmd->args.draw.vertex_index += base_vertex;
+                // later draws may be merged across it
+                _sgp_merge_grid_add(cmd->args.draw.region, _sgp.cur_command - 1);
+                break;
+            case SGP_COMMAND_DRAW_INSTANCED:
+                cmd->args.draw.vertex_index += base_sprite;
+                break;
+            case SGP_COMMAND_DRAW_STATIC:
+                // its vertices are in the static batch buffer
+                break;
+            case SGP_COMMAND_VIEWPORT:
+                restore_viewport = true;
+                break;
+            case SGP_COMMAND_SCISSOR:
+                restore_scissor = true;
+                break;
+            default:
+                break;
+        }
+        if (cmd->cmd != SGP_COMMAND_VIEWPORT && cmd->cmd != SGP_COMMAND_SCISSOR && cmd->args.draw.uniform_index != _SGP_IMPOSSIBLE_ID) {
+            cmd->args.draw.uniform_index += base_uniform;
+        }
     }
 
-    // queue draw
-    sg_pipeline pip = _sgp_lookup_pipeline(primitive_type, _sgp.state.blend_mode);
-    _sgp_queue_draw(pip, region, vertex_index, num_vertices, primitive_type);
-}
+    // the list may have changed the viewport or scissor, the current ones are applied again
+    if (restore_viewport) {
+        _sgp_command* cmd = _sgp_next_command();
+        if (SOKOL_UNLIKELY(!cmd)) {
+            _SGP_TRACE_END("sgp_submit_command_list");
+            return;
+        }
+        memset(cmd, 0, sizeof(_sgp_command));
+        cmd->cmd = SGP_COMMAND_VIEWPORT;
+        cmd->args.viewport = _sgp.state.viewport;
+    }
+    if (restore_scissor || restore_viewport) {
+        _sgp_command* cmd = _sgp_next_command();
+        if (SOKOL_UNLIKELY(!cmd)) {
+            _SGP_TRACE_END("sgp_submit_command_list");
+            return;
+        }
+        memset(cmd, 0, sizeof(_sgp_command));
+        cmd->cmd = SGP_COMMAND_SCISSOR;
+        cmd->args.scissor = _sgp_frame_scissor(_sgp.state.scissor);
+    }
 
-void sgp_draw_points(const sgp_point* points, uint32_t count) {
-    _sgp_draw_solid_pip(SG_PRIMITIVETYPE_POINTS, points, count);
+    // add the recording statistics of the list
+    sgp_stats* stats = &_sgp.state._stats;
+    stats->num_queued_draws += src->stats.num_queued_draws - num_culled;
+    stats->num_culled_draws += src->stats.num_culled_draws + num_culled;
+    stats->num_merged_prev += src->stats.num_merged_prev;
+    stats->num_merged_next += src->stats.num_merged_next;
+    stats->num_moved_bytes += src->stats.num_moved_bytes;
+    stats->num_reused_uniforms += src->stats.num_reused_uniforms;
+    _SGP_TRACE_END("sgp_submit_command_list");
 }
 
-void sgp_draw_point(float x, float y) {
-    sgp_point point = {x, y};
-    sgp_draw_points(&point, 1);
+// finds the primitive type and blend mode of a builtin pipeline, indexed quads are triangles
+static bool _sgp_query_builtin_pipeline(sg_pipeline pip, sg_primitive_type* primitive_type, sgp_blend_mode* blend_mode, bool* gpu_transform) {
+    *gpu_transform = false;
+    for (uint32_t i=0;i<_SG_PRIMITIVETYPE_NUM*_SGP_BLENDMODE_NUM;++i) {
+        if (_sgp.pipelines[i].id == pip.id || _sgp.transform_pipelines[i].id == pip.id) {
+            *primitive_type = (sg_primitive_type)(i / _SGP_BLENDMODE_NUM);
+            *blend_mode = (sgp_blend_mode)(i % _SGP_BLENDMODE_NUM);
+            *gpu_transform = _sgp.transform_pipelines[i].id == pip.id;
+            return true;
+        }
+    }
+    for (uint32_t i=0;i<_SGP_BLENDMODE_NUM;++i) {
+        if (_sgp.quad_pipelines[i].id == pip.id) {
+            *primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
+            *blend_mode = (sgp_blend_mode)i;
+            return true;
+        }
+    }
+    return false;
 }
 
-void sgp_draw_lines(const sgp_line* lines, uint32_t count) {
-    _sgp_draw_solid_pip(SG_PRIMITIVETYPE_LINES, (const sgp_point*)lines, count*2);
-}
+sgp_static_batch* sgp_make_static_batch(const sgp_command_list* list) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(!_sgp.command_list);
+    SOKOL_ASSERT(list && list->ctx.init_cookie == _SGP_INIT_COOKIE);
+    const _sgp_context* src = &list->ctx;
+    SOKOL_ASSERT(src->cur_state == 0);
+    SOKOL_ASSERT(src->owner_ctx == _sgp_ctx); // its pipelines are looked up in this context
+    if (SOKOL_UNLIKELY(src->last_error != SGP_NO_ERROR)) {
+        _sgp_set_error(src->last_error);
+        return NULL;
+    }
+    // the vertices are un-projected with the projection of the list frame, they would be misplaced otherwise
+    if (SOKOL_UNLIKELY(src->list_projected)) {
+        _sgp_set_error(SGP_ERROR_STATIC_BATCH_PROJECTED);
+        return NULL;
+    }
+    _SGP_TRACE_BEGIN("sgp_make_static_batch", src->cur_command);
 
-void sgp_draw_line(float ax, float ay, float bx, float by) {
-    sgp_line line = {{ax,ay},{bx, by}};
-    sgp_draw_lines(&line, 1);
-}
+    // only draws with builtin pipelines can be transformed on the GPU, indexed quads become triangles
+    uint32_t num_draws = 0;
+    uint32_t num_vertices = 0;
+    for (uint32_t i=0;i<src->cur_command;++i) {
+        const _sgp_command* cmd = &src->commands[i];
+        if (cmd->cmd == SGP_COMMAND_NONE) {
+            continue;
+        }
+        sg_primitive_type primitive_type;
+        sgp_blend_mode blend_mode;
+        bool gpu_transform;
+        if (cmd->cmd != SGP_COMMAND_DRAW || !_sgp_query_builtin_pipeline(cmd->args.draw.pip, &primitive_type, &blend_mode, &gpu_transform)) {
+            _sgp_set_error(SGP_ERROR_STATIC_BATCH_UNSUPPORTED);
+            _SGP_TRACE_END("sgp_make_static_batch");
+            return NULL;
+        }
+        num_draws++;
+        num_vertices += cmd->args.draw.indexed ? cmd->args.draw.num_vertices / 4 * 6 : cmd->args.draw.num_vertices;
+    }
 
-void sgp_draw_lines_strip(const sgp_point* points, uint32_t count) {
-    _sgp_draw_solid_pip(SG_PRIMITIVETYPE_LINE_STRIP, points, count);
-}
+    sgp_static_batch* batch = (sgp_static_batch*) _sg_malloc(sizeof(sgp_static_batch) + num_draws * sizeof(_sgp_draw_args));
+    sgp_vertex* vertices = num_vertices > 0 ? (sgp_vertex*) _sg_malloc(num_vertices * sizeof(sgp_vertex)) : NULL;
+    if (!batch || (num_vertices > 0 && !vertices)) {
+        if (batch) {
+            _sg_free(batch);
+        }
+        if (vertices) {
+            _sg_free(vertices);
+        }
+        _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+        _SGP_TRACE_END("sgp_make_static_batch");
+        return NULL;
+    }
+    memset(batch, 0, sizeof(sgp_static_batch));
+    batch->owner_ctx = _sgp_ctx;
+    batch->draws = (_sgp_draw_args*)(batch + 1);
+    batch->region.x1 = FLT_MAX; batch->region.y1 = FLT_MAX;
+    batch->region.x2 = -FLT_MAX; batch->region.y2 = -FLT_MAX;
+
+    // copy the vertices of every draw in order, from clip space back to the coordinates of the list frame,
+    // consecutive draws with the same pipeline and textures become a single draw
+    float half_w = (float)src->list_frame_size.w * 0.5f;
+    float half_h = (float)src->list_frame_size.h * 0.5f;
+    uint32_t vertex_index = 0;
+    _sgp_draw_args* prev_draw = NULL;
+    for (uint32_t i=0;i<src->cur_command;++i) {
+        const _sgp_command* cmd = &src->commands[i];
+        if (cmd->cmd == SGP_COMMAND_NONE) {
+            continue;
+        }
+        const _sgp_draw_args* args = &cmd->args.draw;
+        sg_primitive_type primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
+        sgp_blend_mode blend_mode = SGP_BLENDMODE_NONE;
+        bool gpu_transform = false;
+        _sgp_query_builtin_pipeline(args->pip, &primitive_type, &blend_mode, &gpu_transform);
+        sg_pipeline pip = _sgp_lookup_transform_pipeline(primitive_type, blend_mode);
+        if (SOKOL_UNLIKELY(pip.id == SG_INVALID_ID)) {
+            _sg_free(vertices);
+            _sg_free(batch);
+            _sgp_set_error(SGP_ERROR_MAKE_COMMON_PIPELINE_FAILED);
+            _SGP_TRACE_END("sgp_make_static_batch");
+            return NULL;
+        }
 
-void sgp_draw_filled_triangles(const sgp_triangle* triangles, uint32_t count) {
-    _sgp_draw_solid_pip(SG_PRIMITIVETYPE_TRIANGLES, (const sgp_point*)triangles, count*3);
-}
+        // draws transformed on the GPU are in local space, their MVP is in their uniform
+        sgp_mat2x3 mvp = _sgp_mat3_identity;
+        if (gpu_transform) {
+            _sgp_transform_uniform_mat(&src->uniforms[args->uniform_index], &mvp);
+        }
+        const sgp_vertex* v = &src->vertices[args->vertex_index];
+        uint32_t count = args->indexed ? args->num_vertices / 4 * 6 : args->num_vertices;
+        sgp_vertex* dst = &vertices[vertex_index];
+        for (uint32_t j=0;j<count;++j) {
+            sgp_vertex vertex = args->indexed ? v[(j / 6) * 4 + _sgp_quad_indices[j % 6]] : v[j];
+            vertex.position = _sgp_mat3_vec2_mul(&mvp, &vertex.position);
+            vertex.position.x = (vertex.position.x + 1.0f) * half_w;
+            vertex.position.y = (1.0f - vertex.position.y) * half_h;
+            batch->region.x1 = _sg_min(batch->region.x1, vertex.position.x);
+            batch->region.y1 = _sg_min(batch->region.y1, vertex.position.y);
+            batch->region.x2 = _sg_max(batch->region.x2, vertex.position.x);
+            batch->region.y2 = _sg_max(batch->region.y2, vertex.position.y);
+            dst[j] = vertex;
+        }
 
-void sgp_draw_filled_triangle(float ax, float ay, float bx, float by, float cx, float cy) {
-    sgp_triangle triangle = {{ax,ay},{bx, by},{cx, cy}};
-    sgp_draw_filled_triangles(&triangle, 1);
+        if (prev_draw && prev_draw->pip.id == pip.id &&
+            memcmp(&prev_draw->textures, &args->textures, sizeof(sgp_textures_uniform)) == 0 &&
+            primitive_type != SG_PRIMITIVETYPE_TRIANGLE_STRIP && primitive_type != SG_PRIMITIVETYPE_LINE_STRIP) {
+            prev_draw->num_vertices += count;
+        } else {
+            prev_draw = &batch->draws[batch->num_draws++];
+            memset(prev_draw, 0, sizeof(_sgp_draw_args));
+            prev_draw->pip = pip;
+            prev_draw->textures = args->textures;
+            prev_draw->uniform_index = _SGP_IMPOSSIBLE_ID;
+            prev_draw->vertex_index = vertex_index;
+            prev_draw->num_vertices = count;
+        }
+        vertex_index += count;
+    }
+
+    // upload the vertices once
+    if (num_vertices > 0) {
+        sg_buffer_desc vertex_buf_desc;
+        memset(&vertex_buf_desc, 0, sizeof(sg_buffer_desc));
+        vertex_buf_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+        vertex_buf_desc.usage = SG_USAGE_IMMUTABLE;
+        vertex_buf_desc.data.ptr = vertices;
+        vertex_buf_desc.data.size = num_vertices * sizeof(sgp_vertex);
+        vertex_buf_desc.label = "sgp-static-batch";
+        batch->vertex_buf = sg_make_buffer(&vertex_buf_desc);
+        _sg_free(vertices);
+        if (sg_query_buffer_state(batch->vertex_buf) != SG_RESOURCESTATE_VALID) {
+            sgp_destroy_static_batch(batch);
+            _sgp_set_error(SGP_ERROR_MAKE_VERTEX_BUFFER_FAILED);
+            _SGP_TRACE_END("sgp_make_static_batch");
+            return NULL;
+        }
+        for (uint32_t i=0;i<batch->num_draws;++i) {
+            batch->draws[i].vertex_buf = batch->vertex_buf;
+        }
+    }
+    _SGP_TRACE_END("sgp_make_static_batch");
+    return batch;
 }
 
-void sgp_draw_filled_triangles_strip(const sgp_point* points, uint32_t count) {
-    _sgp_draw_solid_pip(SG_PRIMITIVETYPE_TRIANGLE_STRIP, points, count);
+void sgp_destroy_static_batch(sgp_static_batch* batch) {
+    if (!batch) {
+        return;
+    }
+    if (batch->vertex_buf.id != SG_INVALID_ID) {
+        sg_destroy_buffer(batch->vertex_buf);
+    }
+    _sg_free(batch);
 }
 
-void sgp_draw_filled_rects(const sgp_rect* rects, uint32_t count) {
+void sgp_draw_static_batch(const sgp_static_batch* batch) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
     SOKOL_ASSERT(_sgp.cur_state > 0);
-    if (SOKOL_UNLIKELY(count == 0)) {
+    SOKOL_ASSERT(batch);
+    SOKOL_ASSERT(batch->owner_ctx == (_sgp.command_list ? _sgp.owner_ctx : _sgp_ctx));
+    if (SOKOL_UNLIKELY(batch->num_draws == 0)) {
         return;
     }
+    _SGP_TRACE_BEGIN("sgp_draw_static_batch", batch->num_draws);
 
-    // setup vertices
-    uint32_t num_vertices = count * 6;
-    uint32_t vertex_index = _sgp.cur_vertex;
-    sgp_vertex* vertices = _sgp_next_vertices(num_vertices);
-    if (SOKOL_UNLIKELY(!vertices)) {
+    // skip the batch when its transformed bounds are out of screen
+    const sgp_mat2x3* mvp = &_sgp.state.mvp;
+    _sgp_region region = _sgp_transform_region(mvp, batch->region, 0.0f);
+    if (region.x1 > 1.0f || region.y1 > 1.0f || region.x2 < -1.0f || region.y2 < -1.0f) {
+        _sgp.state._stats.num_culled_draws += batch->num_draws;
+        _SGP_TRACE_END("sgp_draw_static_batch");
         return;
     }
 
-    // compute vertices
-    sgp_vertex* v = vertices;
-    const sgp_rect* rect = rects;
-    sgp_color_ub4 color = _sgp.state.color;
-    sgp_mat2x3 mvp = _sgp.state.mvp; // copy to stack for more efficiency
-    _sgp_region region = {FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX};
-    for (uint32_t i=0;i<count;v+=6, rect++, i++) {
-        sgp_vec2 quad[4] = {
-            {rect->x,           rect->y + rect->h}, // bottom left
-            {rect->x + rect->w, rect->y + rect->h}, // bottom right
-            {rect->x + rect->w, rect->y}, // top right
-            {rect->x,  rect->y}, // top left
-        };
-        _sgp_transform_vec2(&mvp, quad, quad, 4);
-
-        for (uint32_t j=0;j<4;++j) {
-            region.x1 = _sg_min(region.x1, quad[j].x);
-            region.y1 = _sg_min(region.y1, quad[j].y);
-            region.x2 = _sg_max(region.x2, quad[j].x);
-            region.y2 = _sg_max(region.y2, quad[j].y);
+    // only the transform is uploaded, the vertices are already in the GPU
+    sgp_uniform uniform;
+    _sgp_make_transform_uniform(&uniform, mvp);
+    uint32_t uniform_index;
+    sgp_uniform* prev_uniform = _sgp_prev_uniform();
+    if (prev_uniform && memcmp(prev_uniform, &uniform, sizeof(sgp_uniform)) == 0) {
+        uniform_index = _sgp.cur_uniform - 1;
+        _sgp.state._stats.num_reused_uniforms++;
+    } else {
+        sgp_uniform* next_uniform = _sgp_next_uniform();
+        if (SOKOL_UNLIKELY(!next_uniform)) {
+            _SGP_TRACE_END("sgp_draw_static_batch");
+            return;
         }
-
-        const sgp_vec2 vtexquad[4] = {
-            {0.0f, 1.0f}, // bottom left
-            {1.0f, 1.0f}, // bottom right
-            {1.0f, 0.0f}, // top right
-            {0.0f, 0.0f}, // top left
-        };
-
-        // make a quad composed of 2 triangles
-        v[0].position = quad[0]; v[0].texcoord = vtexquad[0]; v[0].color = color;
-        v[1].position = quad[1]; v[1].texcoord = vtexquad[1]; v[1].color = color;
-        v[2].position = quad[2]; v[2].texcoord = vtexquad[2]; v[2].color = color;
-        v[3].position = quad[3]; v[3].texcoord = vtexquad[3]; v[3].color = color;
-        v[4].position = quad[0]; v[4].texcoord = vtexquad[0]; v[4].color = color;
-        v[5].position = quad[2]; v[5].texcoord = vtexquad[2]; v[5].color = color;
+        *next_uniform = uniform;
+        uniform_index = _sgp.cur_uniform - 1;
     }
 
-    // queue draw
-    sg_pipeline pip = _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLES, _sgp.state.blend_mode);
-    _sgp_queue_draw(pip, region, vertex_index, num_vertices, SG_PRIMITIVETYPE_TRIANGLES);
+    // the draws are merged already, they are never batched with other draws
+    for (uint32_t i=0;i<batch->num_draws;++i) {
+        _sgp_command* cmd = _sgp_next_command();
+        if (SOKOL_UNLIKELY(!cmd)) {
+            break;
+        }
+        cmd->cmd = SGP_COMMAND_DRAW_STATIC;
+        cmd->args.draw = batch->draws[i];
+        cmd->args.draw.region = region;
+        cmd->args.draw.uniform_index = uniform_index;
+        _sgp.state._stats.num_queued_draws++;
+    }
+    _SGP_TRACE_END("sgp_draw_static_batch");
 }
 
-void sgp_draw_filled_rect(float x, float y, float w, float h) {
+sgp_atlas* sgp_make_atlas(const sgp_atlas_desc* desc) {
     SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    sgp_rect rect = {x,y,w,h};
-    sgp_draw_filled_rects(&rect, 1);
-}
-
-static sgp_isize _sgp_query_image_size(sg_image img_id) {
-    const _sg_image_t* img = _sg_lookup_image(&_sg.pools, img_id.id);
-    SOKOL_ASSERT(img);
-    sgp_isize size = {img ? img->cmn.width : 0, img ? img->cmn.height : 0};
-    return size;
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT(desc->page_width >= 0 && desc->page_height >= 0 && desc->padding >= 0);
+    uint32_t max_pages = _sg_def(desc->max_pages, 4);
+    sgp_atlas* atlas = (sgp_atlas*) _sg_malloc(sizeof(sgp_atlas) + max_pages * sizeof(_sgp_atlas_page));
+    if (!atlas) {
+        _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+        return NULL;
+    }
+    memset(atlas, 0, sizeof(sgp_atlas) + max_pages * sizeof(_sgp_atlas_page));
+    atlas->desc = *desc;
+    atlas->desc.page_width = _sg_def(desc->page_width, 1024);
+    atlas->desc.page_height = _sg_def(desc->page_height, 1024);
+    atlas->desc.max_pages = max_pages;
+    atlas->pages = (_sgp_atlas_page*)(atlas + 1);
+    return atlas;
 }
 
-void sgp_draw_textured_rects(int channel, const sgp_textured_rect* rects, uint32_t count) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    SOKOL_ASSERT(channel >= 0 && channel < SGP_TEXTURE_SLOTS);
-    sg_image image = _sgp.state.textures.images[channel];
-    if (SOKOL_UNLIKELY(count == 0 || image.id == SG_INVALID_ID)) {
+void sgp_destroy_atlas(sgp_atlas* atlas) {
+    if (!atlas) {
         return;
     }
+    for (uint32_t i=0;i<atlas->num_pages;++i) {
+        _sgp_atlas_page* page = &atlas->pages[i];
+        if (page->image.id != SG_INVALID_ID) {
+            sg_destroy_image(page->image);
+        }
+        _sg_free(page->pixels);
+        _sg_free(page->nodes);
+    }
+    _sg_free(atlas);
+}
 
-    // setup vertices
-    uint32_t num_vertices = count * 6;
-    uint32_t vertex_index = _sgp.cur_vertex;
-    sgp_vertex* vertices = _sgp_next_vertices(num_vertices);
-    if (SOKOL_UNLIKELY(!vertices)) {
-        return;
+static bool _sgp_atlas_add_page(sgp_atlas* atlas) {
+    int w = atlas->desc.page_width, h = atlas->desc.page_height;
+    _sgp_atlas_page* page = &atlas->pages[atlas->num_pages];
+    memset(page, 0, sizeof(_sgp_atlas_page));
+    page->pixels = (uint8_t*) _sg_malloc((size_t)w * (size_t)h * 4);
+    page->nodes = (_sgp_atlas_node*) _sg_malloc((size_t)(w + 1) * sizeof(_sgp_atlas_node));
+    if (!page->pixels || !page->nodes) {
+        _sg_free(page->pixels);
+        _sg_free(page->nodes);
+        _sgp_set_error(SGP_ERROR_ALLOC_FAILED);
+        return false;
     }
+    // pixels not covered by images are transparent
+    memset(page->pixels, 0, (size_t)w * (size_t)h * 4);
+    page->nodes[0].x = 0;
+    page->nodes[0].y = 0;
+    page->nodes[0].w = w;
+    page->num_nodes = 1;
+
+    sg_image_desc image_desc;
+    memset(&image_desc, 0, sizeof(sg_image_desc));
+    image_desc.width = w;
+    image_desc.height = h;
+    image_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
+    image_desc.usage = SG_USAGE_DYNAMIC;
+    image_desc.label = "sgp-atlas-page";
+    page->image = sg_make_image(&image_desc);
+    if (sg_query_image_state(page->image) != SG_RESOURCESTATE_VALID) {
+        sg_destroy_image(page->image);
+        _sg_free(page->pixels);
+        _sg_free(page->nodes);
+        _sgp_set_error(SGP_ERROR_MAKE_ATLAS_PAGE_FAILED);
+        return false;
+    }
+    atlas->num_pages++;
+    return true;
+}
 
-    // compute image values used for texture coords transform
-    sgp_isize image_size = _sgp_query_image_size(image);
-    if (SOKOL_UNLIKELY(image_size.w == 0 || image_size.h == 0)) {
-        return;
+// returns the top of a rectangle resting on the skyline from a node, or -1 when it doesn't fit
+static int _sgp_atlas_fit(const _sgp_atlas_page* page, int node_index, int w, int h, int page_w, int page_h) {
+    int x = page->nodes[node_index].x;
+    if (x + w > page_w) {
+        return -1;
     }
-    float iw = 1.0f/(float)image_size.w, ih = 1.0f/(float)image_size.h;
+    int y = 0;
+    int width_left = w;
+    for (int i=node_index;width_left>0;++i) {
+        SOKOL_ASSERT(i < page->num_nodes);
+        y = _sg_max(y, page->nodes[i].y);
+        if (y + h > page_h) {
+            return -1;
+        }
+        width_left -= page->nodes[i].w;
+    }
+    return y;
+}
 
-    // compute vertices
-    sgp_mat2x3 mvp = _sgp.state.mvp; // copy to stack for more efficiency
-    _sgp_region region = {FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX};
-    for (uint32_t i=0;i<count;i++) {
-        sgp_vec2 quad[4] = {
-            {rects[i].dst.x,                  rects[i].dst.y + rects[i].dst.h}, // bottom left
-            {rects[i].dst.x + rects[i].dst.w, rects[i].dst.y + rects[i].dst.h}, // bottom right
-            {rects[i].dst.x + rects[i].dst.w, rects[i].dst.y}, // top right
-            {rects[i].dst.x,  rects[i].dst.y}, // top left
-        };
-        _sgp_transform_vec2(&mvp, quad, quad, 4);
+// packs a rectangle with the bottom left heuristic, keeping the skyline as low as possible
+static bool _sgp_atlas_pack(_sgp_atlas_page* page, int w, int h, int page_w, int page_h, int* out_x, int* out_y) {
+    int best_index = -1, best_top = page_h + 1, best_width = page_w + 1, best_y = 0;
+    for (int i=0;i<page->num_nodes;++i) {
+        int y = _sgp_atlas_fit(page, i, w, h, page_w, page_h);
+        if (y < 0) {
+            continue;
+        }
+        if (y + h < best_top || (y + h == best_top && page->nodes[i].w < best_width)) {
+            best_index = i;
+            best_top = y + h;
+            best_width = page->nodes[i].w;
+            best_y = y;
+        }
+    }
+    if (best_index < 0) {
+        return false;
+    }
+    *out_x = page->nodes[best_index].x;
+    *out_y = best_y;
+
+    // raise the skyline over the rectangle, then shrink or remove the nodes it covers
+    memmove(&page->nodes[best_index+1], &page->nodes[best_index], (size_t)(page->num_nodes - best_index) * sizeof(_sgp_atlas_node));
+    page->num_nodes++;
+    page->nodes[best_index].y = best_y + h;
+    page->nodes[best_index].w = w;
+    int end_x = page->nodes[best_index].x + w;
+    int i = best_index + 1;
+    while (i < page->num_nodes && page->nodes[i].x < end_x) {
+        _sgp_atlas_node* node = &page->nodes[i];
+        int shrink = end_x - node->x;
+        if (node->w > shrink) {
+            node->x += shrink;
+            node->w -= shrink;
+            break;
+        }
+        memmove(node, node + 1, (size_t)(page->num_nodes - i - 1) * sizeof(_sgp_atlas_node));
+        page->num_nodes--;
+    }
 
-        for (uint32_t j=0;j<4;++j) {
-            region.x1 = _sg_min(region.x1, quad[j].x);
-            region.y1 = _sg_min(region.y1, quad[j].y);
-            region.x2 = _sg_max(region.x2, quad[j].x);
-            region.y2 = _sg_max(region.y2, quad[j].y);
+    // merge neighbor nodes at the same height
+    for (i=0;i+1<page->num_nodes;) {
+        if (page->nodes[i].y == page->nodes[i+1].y) {
+            page->nodes[i].w += page->nodes[i+1].w;
+            memmove(&page->nodes[i+1], &page->nodes[i+2], (size_t)(page->num_nodes - i - 2) * sizeof(_sgp_atlas_node));
+            page->num_nodes--;
+        } else {
+            ++i;
         }
+    }
+    return true;
+}
 
-        sgp_vertex* v = &vertices[i*6];
-        v[0].position = quad[0];
-        v[1].position = quad[1];
-        v[2].position = quad[2];
-        v[3].position = quad[3];
-        v[4].position = quad[0];
-        v[5].position = quad[2];
+sgp_atlas_image sgp_atlas_add_image(sgp_atlas* atlas, int width, int height, const void* pixels) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(atlas && pixels);
+    SOKOL_ASSERT(width > 0 && height > 0);
+    sgp_atlas_image result;
+    memset(&result, 0, sizeof(sgp_atlas_image));
+    int page_w = atlas->desc.page_width, page_h = atlas->desc.page_height;
+    int padding = atlas->desc.padding;
+
+    // the padding is kept at the right and bottom of every image, the page edges need none
+    int w = _sg_min(width + padding, page_w);
+    int h = _sg_min(height + padding, page_h);
+    if (SOKOL_UNLIKELY(width > page_w || height > page_h)) {
+        _sgp_set_error(SGP_ERROR_ATLAS_FULL);
+        return result;
+    }
+    int x = 0, y = 0;
+    _sgp_atlas_page* page = NULL;
+    for (uint32_t i=0;i<atlas->num_pages;++i) {
+        if (_sgp_atlas_pack(&atlas->pages[i], w, h, page_w, page_h, &x, &y)) {
+            page = &atlas->pages[i];
+            break;
+        }
+    }
+    if (!page) {
+        if (atlas->num_pages >= atlas->desc.max_pages) {
+            _sgp_set_error(SGP_ERROR_ATLAS_FULL);
+            return result;
+        }
+        if (!_sgp_atlas_add_page(atlas)) {
+            return result;
+        }
+        page = &atlas->pages[atlas->num_pages - 1];
+        // an empty page fits any image not larger than it
+        _sgp_atlas_pack(page, w, h, page_w, page_h, &x, &y);
     }
 
-    // compute texture coords
-    sgp_color_ub4 color = _sgp.state.color;
-    for (uint32_t i=0;i<count;i++) {
-        // compute source rect
-        float tl = rects[i].src.x*iw;
-        float tt = rects[i].src.y*ih;
-        float tr = (rects[i].src.x + rects[i].src.w)*iw;
-        float tb = (rects[i].src.y + rects[i].src.h)*ih;
-        sgp_vec2 vtexquad[4] = {
-            {tl, tb}, // bottom left
-            {tr, tb}, // bottom right
-            {tr, tt}, // top right
-            {tl, tt}, // top left
-        };
+    // copy the rows into the page, to be uploaded with the other images added to it
+    const uint8_t* src = (const uint8_t*)pixels;
+    size_t row_size = (size_t)width * 4;
+    for (int row=0;row<height;++row) {
+        memcpy(&page->pixels[((size_t)(y + row) * (size_t)page_w + (size_t)x) * 4], &src[(size_t)row * row_size], row_size);
+    }
+    page->dirty = true;
+    result.image = page->image;
+    result.src.x = (float)x;
+    result.src.y = (float)y;
+    result.src.w = (float)width;
+    result.src.h = (float)height;
+    return result;
+}
 
-        // make a quad composed of 2 triangles
-        sgp_vertex* v = &vertices[i*6];
-        v[0].texcoord = vtexquad[0]; v[0].color = color;
-        v[1].texcoord = vtexquad[1]; v[1].color = color;
-        v[2].texcoord = vtexquad[2]; v[2].color = color;
-        v[3].texcoord = vtexquad[3]; v[3].color = color;
-        v[4].texcoord = vtexquad[0]; v[4].color = color;
-        v[5].texcoord = vtexquad[2]; v[5].color = color;
+void sgp_atlas_upload(sgp_atlas* atlas) {
+    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
+    SOKOL_ASSERT(atlas);
+    for (uint32_t i=0;i<atlas->num_pages;++i) {
+        _sgp_atlas_page* page = &atlas->pages[i];
+        // images can be updated only once per frame, pages changed again are uploaded on the next one
+        if (!page->dirty || page->upload_frame_index == _sg.frame_index) {
+            continue;
+        }
+        sg_image_data data;
+        memset(&data, 0, sizeof(sg_image_data));
+        data.subimage[0][0].ptr = page->pixels;
+        data.subimage[0][0].size = (size_t)atlas->desc.page_width * (size_t)atlas->desc.page_height * 4;
+        sg_update_image(page->image, &data);
+        page->upload_frame_index = _sg.frame_index;
+        page->dirty = false;
     }
+}
 
-    // queue draw
-    sg_pipeline pip = _sgp_lookup_pipeline(SG_PRIMITIVETYPE_TRIANGLES, _sgp.state.blend_mode);
-    _sgp_queue_draw(pip, region, vertex_index, num_vertices, SG_PRIMITIVETYPE_TRIANGLES);
+sgp_rect sgp_atlas_src_rect(const sgp_atlas_image* image, sgp_rect src_rect) {
+    SOKOL_ASSERT(image);
+    sgp_rect rect = {image->src.x + src_rect.x, image->src.y + src_rect.y, src_rect.w, src_rect.h};
+    return rect;
 }
 
-void sgp_draw_textured_rect(int channel, sgp_rect dest_rect, sgp_rect src_rect) {
-    SOKOL_ASSERT(_sgp.init_cookie == _SGP_INIT_COOKIE);
-    SOKOL_ASSERT(_sgp.cur_state > 0);
-    sgp_textured_rect rect = {dest_rect, src_rect};
-    sgp_draw_textured_rects(channel, &rect, 1);
+#ifdef SGP_TRACE
+void sgp_chrome_trace_begin(sgp_chrome_trace* trace, FILE* file) {
+    SOKOL_ASSERT(trace && file);
+    trace->file = file;
+    trace->num_events = 0;
+    fputs("[\n", file);
 }
 
-sgp_desc sgp_query_desc(void) {
-    return _sgp.desc;
+void sgp_chrome_trace_end(sgp_chrome_trace* trace) {
+    SOKOL_ASSERT(trace && trace->file);
+    fputs("\n]\n", trace->file);
+    fflush(trace->file);
+    trace->file = NULL;
 }
 
-sgp_state* sgp_query_state(void) {
-    return &_sgp.state;
+void sgp_chrome_trace_func(const sgp_trace_event* event, void* user_data) {
+    sgp_chrome_trace* trace = (sgp_chrome_trace*)user_data;
+    if (!trace || !trace->file) {
+        return;
+    }
+    // timestamps are in microseconds in the Chrome trace format
+    double ts = (double)event->time_ns / 1000.0;
+    const char* sep = trace->num_events > 0 ? ",\n" : "";
+    if (event->phase == SGP_TRACE_BEGIN) {
+        fprintf(trace->file, "%s{\"name\":\"%s\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":1,\"tid\":1,\"args\":{\"arg\":%u}}",
+                sep, event->name, ts, event->arg);
+    } else {
+        fprintf(trace->file, "%s{\"name\":\"%s\",\"ph\":\"E\",\"ts\":%.3f,\"pid\":1,\"tid\":1}",
+                sep, event->name, ts);
+    }
+    trace->num_events++;
 }
+#endif // SGP_TRACE
 
 #endif // SOKOL_GP_IMPL_INCLUDED
 #endif // SOKOL_GP_IMPL